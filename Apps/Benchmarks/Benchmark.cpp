@@ -0,0 +1,316 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Benchmark.h"
+#include "OctaneGUI/OctaneGUI.h"
+#include "OctaneGUI/Profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+
+// Count every allocation made by the library while a workload is running. The counts are read
+// back from the profiler's per-frame allocation counter.
+PROFILER_TRACK_ALLOCATIONS()
+
+namespace Benchmarks
+{
+
+template <typename T>
+static OctaneGUI::Json Summarize(std::vector<T> Samples, bool Percentiles)
+{
+    OctaneGUI::Json Result(OctaneGUI::Json::Type::Object);
+    if (Samples.empty())
+    {
+        return Result;
+    }
+
+    std::sort(Samples.begin(), Samples.end());
+
+    double Total = 0.0;
+    for (const T& Sample : Samples)
+    {
+        Total += (double)Sample;
+    }
+
+    const auto Percentile = [&](float Value) -> float
+    {
+        const size_t Index = std::min(Samples.size() - 1, (size_t)(Value * (float)Samples.size()));
+        return (float)Samples[Index];
+    };
+
+    Result["Mean"] = (float)(Total / (double)Samples.size());
+    if (Percentiles)
+    {
+        Result["P50"] = Percentile(0.5f);
+        Result["P90"] = Percentile(0.9f);
+        Result["P99"] = Percentile(0.99f);
+    }
+    Result["Max"] = (float)Samples.back();
+
+    return Result;
+}
+
+void Benchmark::Run(OctaneGUI::Application& Application, int Argc, char** Argv)
+{
+    if (s_Benchmarks == nullptr)
+    {
+        fprintf(stderr, "No benchmarks to run.\n");
+        return;
+    }
+
+    bool Verbose = false;
+    int Frames = 60;
+    std::string BenchmarkName;
+    std::string WorkloadName;
+    std::string Output;
+    for (int I = 1; I < Argc; I++)
+    {
+        const std::string Arg { Argv[I] };
+        if (Arg == "Verbose")
+        {
+            Verbose = true;
+        }
+        else if (Arg == "--Benchmark" && I + 1 < Argc)
+        {
+            BenchmarkName = Argv[I + 1];
+        }
+        else if (Arg == "--Workload" && I + 1 < Argc)
+        {
+            WorkloadName = Argv[I + 1];
+        }
+        else if (Arg == "--Frames" && I + 1 < Argc)
+        {
+            Frames = std::max(1, std::atoi(Argv[I + 1]));
+        }
+        else if (Arg == "--Output" && I + 1 < Argc)
+        {
+            Output = Argv[I + 1];
+        }
+        else if (Arg == "--Compact")
+        {
+            Application.SetCompactVertices(true);
+        }
+    }
+
+    OctaneGUI::Json Results(OctaneGUI::Json::Type::Object);
+    Results["Frames"] = (float)Frames;
+    Results["Compact"] = Application.CompactVertices();
+    Results["Benchmarks"] = OctaneGUI::Json(OctaneGUI::Json::Type::Object);
+
+#if TOOLS
+    // Only the latest frame is kept, which is read back for its allocation counter. The
+    // results are printed as JSON, so the profiler must not print anything of its own.
+    OctaneGUI::Tools::Profiler::Get().SetQuiet(true).EnableContinuous(1, std::numeric_limits<int64_t>::max(), 0);
+#endif
+
+    for (const Benchmark* Item : *s_Benchmarks)
+    {
+        if (!BenchmarkName.empty() && BenchmarkName != Item->m_Name)
+        {
+            continue;
+        }
+
+        if (Verbose)
+        {
+            fprintf(stderr, "Running benchmark '%s'\n", Item->m_Name.c_str());
+        }
+
+        Application.ClearKeys();
+        Application.GetMainWindow()->Clear();
+
+        OctaneGUI::Clock Clock;
+        Item->m_OnSetup(Application);
+        Application.GetMainWindow()->Update();
+        OctaneGUI::Paint Brush(Application.GetTheme());
+        Brush.SetCompact(Application.CompactVertices());
+        Application.GetMainWindow()->DoPaint(Brush);
+
+        OctaneGUI::Json Result(OctaneGUI::Json::Type::Object);
+        Result["Setup"] = Clock.Measure() * 1000.0f;
+        Result["Workloads"] = OctaneGUI::Json(OctaneGUI::Json::Type::Object);
+
+        for (const std::pair<const std::string, OnFrameSignature>& Workload : Item->m_Workloads)
+        {
+            if (!WorkloadName.empty() && WorkloadName != Workload.first)
+            {
+                continue;
+            }
+
+            if (Verbose)
+            {
+                fprintf(stderr, "    Workload '%s'\n", Workload.first.c_str());
+            }
+
+            Result["Workloads"][Workload.first] = Run(Application, *Item, Workload.first, Frames);
+        }
+
+        Results["Benchmarks"][Item->m_Name] = std::move(Result);
+    }
+
+#if TOOLS
+    OctaneGUI::Tools::Profiler::Get().Disable();
+#endif
+
+    if (Output.empty())
+    {
+        printf("%s\n", Results.ToStringPretty().c_str());
+    }
+    else if (Application.FS().WriteContents(Output, Results.ToStringPretty()))
+    {
+        printf("Wrote benchmark results to '%s'.\n", Output.c_str());
+    }
+    else
+    {
+        fprintf(stderr, "Failed to write benchmark results to '%s'.\n", Output.c_str());
+    }
+
+    delete s_Benchmarks;
+    s_Benchmarks = nullptr;
+}
+
+Benchmark::Benchmark(const char* Name, OnSetupSignature&& OnSetup, const WorkloadsMap& Workloads)
+    : m_Name(Name)
+    , m_OnSetup(std::move(OnSetup))
+    , m_Workloads(Workloads)
+{
+    if (s_Benchmarks == nullptr)
+    {
+        s_Benchmarks = new std::vector<Benchmark*>();
+    }
+
+    s_Benchmarks->push_back(this);
+}
+
+Benchmark::~Benchmark()
+{
+}
+
+OctaneGUI::Json Benchmark::Run(OctaneGUI::Application& Application, const Benchmark& Item, const std::string& Workload, int Frames)
+{
+    std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const OctaneGUI::Vector2 Size = Window->GetSize();
+    const OnFrameSignature& OnFrame = Item.m_Workloads.at(Workload);
+
+    uint32_t Vertices = 0;
+    uint32_t Indices = 0;
+    uint32_t DrawCommands = 0;
+    size_t Bytes = 0;
+    Application.SetOnPaint([&](OctaneGUI::Window*, const OctaneGUI::VertexBuffer& Buffer) -> void
+        {
+            Vertices = Buffer.GetVertexCount();
+            Indices = Buffer.GetIndexCount();
+            DrawCommands = (uint32_t)Buffer.Commands().size();
+            Bytes = Buffer.GetByteSize();
+        });
+
+    std::vector<float> FrameTimes;
+    std::vector<float> LayoutTimes;
+    std::vector<float> PaintTimes;
+    std::vector<uint64_t> Allocations;
+    std::vector<uint32_t> VertexCounts;
+    std::vector<uint32_t> IndexCounts;
+    std::vector<uint32_t> DrawCommandCounts;
+    std::vector<size_t> ByteCounts;
+    FrameTimes.reserve(Frames);
+    LayoutTimes.reserve(Frames);
+    PaintTimes.reserve(Frames);
+    Allocations.reserve(Frames);
+    VertexCounts.reserve(Frames);
+    IndexCounts.reserve(Frames);
+    DrawCommandCounts.reserve(Frames);
+    ByteCounts.reserve(Frames);
+
+    // The profiler frame ends after the timings are taken so that coalescing is not measured.
+    const auto RunFrame = [&](int Index) -> void
+    {
+        PROFILER_FRAME();
+        OctaneGUI::Clock FrameClock;
+
+        OnFrame(Application, Index);
+
+        OctaneGUI::Clock LayoutClock;
+        Window->Update();
+        const float LayoutTime = LayoutClock.Measure();
+
+        OctaneGUI::Clock PaintClock;
+        OctaneGUI::Paint Brush(Application.GetTheme());
+        Brush.SetCompact(Application.CompactVertices());
+        Window->DoPaint(Brush);
+        const float PaintTime = PaintClock.Measure();
+
+        FrameTimes.push_back(FrameClock.Measure() * 1000.0f);
+        LayoutTimes.push_back(LayoutTime * 1000.0f);
+        PaintTimes.push_back(PaintTime * 1000.0f);
+    };
+
+    for (int Frame = 0; Frame < Frames; Frame++)
+    {
+        Vertices = 0;
+        Indices = 0;
+        DrawCommands = 0;
+        Bytes = 0;
+
+        RunFrame(Frame);
+
+#if TOOLS
+        const OctaneGUI::Tools::Profiler::Frame& Profiled = OctaneGUI::Tools::Profiler::Get().Frames().back();
+        Allocations.push_back(Profiled.CounterValue(OctaneGUI::Tools::Profiler::Counter::Allocations));
+#endif
+        VertexCounts.push_back(Vertices);
+        IndexCounts.push_back(Indices);
+        DrawCommandCounts.push_back(DrawCommands);
+        ByteCounts.push_back(Bytes);
+    }
+
+    Application.SetOnPaint([](OctaneGUI::Window*, const OctaneGUI::VertexBuffer&) -> void {});
+
+    // Restore the window state so the next workload starts from the same scene.
+    Window->SetSize(Size);
+    Window->Update();
+
+    OctaneGUI::Json Result(OctaneGUI::Json::Type::Object);
+    Result["FrameTime"] = Summarize(FrameTimes, true);
+    Result["Layout"] = Summarize(LayoutTimes, true);
+    Result["Paint"] = Summarize(PaintTimes, true);
+    if (!Allocations.empty())
+    {
+        Result["Allocations"] = Summarize(Allocations, false);
+    }
+    Result["Vertices"] = Summarize(VertexCounts, false);
+    Result["Indices"] = Summarize(IndexCounts, false);
+    Result["DrawCommands"] = Summarize(DrawCommandCounts, false);
+    Result["Bytes"] = Summarize(ByteCounts, false);
+    return Result;
+}
+
+Benchmark::Benchmark()
+{
+}
+
+std::vector<Benchmark*>* Benchmark::s_Benchmarks = nullptr;
+
+}
@@ -0,0 +1,79 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class Application;
+class Json;
+
+}
+
+namespace Benchmarks
+{
+
+/// @brief A scene and the set of scripted workloads that are run against it.
+///
+/// Each benchmark builds its scene once in the main window and then runs every
+/// workload for a fixed number of frames. A frame consists of the workload's input
+/// events, the window update (layout) and the window paint. Results are reported
+/// as JSON so they can be compared across commits.
+class Benchmark
+{
+public:
+    typedef std::function<void(OctaneGUI::Application&)> OnSetupSignature;
+    typedef std::function<void(OctaneGUI::Application&, int)> OnFrameSignature;
+    typedef std::map<std::string, OnFrameSignature> WorkloadsMap;
+
+    static void Run(OctaneGUI::Application& Application, int Argc, char** Argv);
+
+    Benchmark(const char* Name, OnSetupSignature&& OnSetup, const WorkloadsMap& Workloads);
+    ~Benchmark();
+
+private:
+    static OctaneGUI::Json Run(OctaneGUI::Application& Application, const Benchmark& Item, const std::string& Workload, int Frames);
+
+    Benchmark();
+
+    // Allocated on the heap due to static initialization order, same as Tests::TestSuite.
+    static std::vector<Benchmark*>* s_Benchmarks;
+
+    std::string m_Name {};
+    OnSetupSignature m_OnSetup { nullptr };
+    WorkloadsMap m_Workloads;
+};
+
+#define BENCHMARK(Name, Setup, Workloads) Benchmark Name(#Name, Setup, {Workloads});
+#define WORKLOAD(Name, Fn) {#Name, Fn},
+
+}
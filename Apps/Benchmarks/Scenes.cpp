@@ -0,0 +1,501 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Benchmark.h"
+#include "OctaneGUI/Controls/Tree.h"
+#include "OctaneGUI/Icons.h"
+#include "OctaneGUI/OctaneGUI.h"
+#include "Workloads.h"
+
+#include <cmath>
+#include <filesystem>
+#include <sstream>
+#include <string>
+
+namespace Benchmarks
+{
+
+static void Load(OctaneGUI::Application& Application, const char* BodyJson, OctaneGUI::ControlList& List)
+{
+    std::stringstream Stream;
+    Stream << "{\"Width\": 1280, \"Height\": 720, \"Body\": {\"Controls\": [" << BodyJson << "]}}";
+    Application.GetMainWindow()->Load(Stream.str().c_str(), List);
+}
+
+static void ListBoxScene(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "ListBox", "ID": "ListBox", "Expand": "Both"})", List);
+
+    std::shared_ptr<OctaneGUI::ListBox> ListBox = List.To<OctaneGUI::ListBox>("ListBox");
+    for (int I = 0; I < 10000; I++)
+    {
+        ListBox->AddItem<OctaneGUI::TextSelectable>()->SetText(("Item " + std::to_string(I)).c_str());
+    }
+}
+
+static void TreeScene(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "ScrollableViewControl", "Expand": "Both", "Controls": [{"Type": "Tree", "ID": "Tree", "Text": "Root"}]})", List);
+
+    // A chain 12 levels deep where every level also has a few leaf siblings.
+    std::shared_ptr<OctaneGUI::Tree> Node = List.To<OctaneGUI::Tree>("Tree");
+    std::shared_ptr<OctaneGUI::Tree> Root = Node;
+    for (int Depth = 0; Depth < 12; Depth++)
+    {
+        for (int Leaf = 0; Leaf < 8; Leaf++)
+        {
+            Node->AddChild(("Leaf " + std::to_string(Depth) + "." + std::to_string(Leaf)).c_str());
+        }
+
+        Node = Node->AddChild(("Node " + std::to_string(Depth)).c_str());
+    }
+
+    Root->SetExpandedAll(true);
+}
+
+static void TableScene(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "Table", "ID": "Table", "Expand": "Both"})", List);
+
+    std::shared_ptr<OctaneGUI::Table> Table = List.To<OctaneGUI::Table>("Table");
+    for (int Column = 0; Column < 20; Column++)
+    {
+        Table->AddColumn(OctaneGUI::String::ToUTF32("Column " + std::to_string(Column)).c_str());
+    }
+
+    for (int Row = 0; Row < 1000; Row++)
+    {
+        Table->AddRow();
+        for (int Column = 0; Column < 20; Column++)
+        {
+            Table->Cell(Row, Column)->AddControl<OctaneGUI::Text>()->SetText(std::to_string(Row * 20 + Column).c_str());
+        }
+    }
+}
+
+// 100000 rows of 10 columns displayed from a TableData instead of controls.
+static void TableDataScene(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "Table", "ID": "Table", "Expand": "Both", "RowSelectable": true})", List);
+
+    std::shared_ptr<OctaneGUI::TableData> Data = std::make_shared<OctaneGUI::TableData>();
+    Data->AddColumn("Name", OctaneGUI::TableData::Type::Text);
+    for (int Column = 1; Column < 10; Column++)
+    {
+        Data->AddColumn(("Column " + std::to_string(Column)).c_str(), Column % 2 == 0 ? OctaneGUI::TableData::Type::Number : OctaneGUI::TableData::Type::Integer);
+    }
+
+    Data->Resize(100000);
+    for (size_t Row = 0; Row < Data->Rows(); Row++)
+    {
+        Data->SetText(Row, 0, "Row " + std::to_string(Row));
+        for (size_t Column = 1; Column < Data->Columns(); Column++)
+        {
+            if (Data->ColumnType(Column) == OctaneGUI::TableData::Type::Number)
+            {
+                Data->SetNumber(Row, Column, (double)(Row * Column) * 0.25);
+            }
+            else
+            {
+                Data->SetInteger(Row, Column, (int64_t)(Row * Column));
+            }
+        }
+    }
+
+    std::shared_ptr<OctaneGUI::Table> Table = List.To<OctaneGUI::Table>("Table");
+    Table->SetData(Data);
+    for (size_t Column = 0; Column < Table->Columns(); Column++)
+    {
+        Table->FitColumn(Column);
+    }
+}
+
+static std::weak_ptr<OctaneGUI::LogView> LogViewControl {};
+static std::string LogViewLines {};
+
+static void LogViewScene(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "LogView", "ID": "LogView", "Expand": "Both"})", List);
+
+    LogViewLines.clear();
+    for (int I = 0; I < 20000; I++)
+    {
+        LogViewLines += "[info] service.request id=" + std::to_string(I) + " status=200 latency=12ms\n";
+    }
+
+    std::shared_ptr<OctaneGUI::LogView> LogView = List.To<OctaneGUI::LogView>("LogView");
+    for (int I = 0; I < 3; I++)
+    {
+        LogView->Append(LogViewLines);
+    }
+    LogViewControl = LogView;
+}
+
+// Appends 20000 lines each frame, which is 1.2 million lines per second at 60 frames per second.
+static void LogViewIngest(OctaneGUI::Application&, int)
+{
+    if (std::shared_ptr<OctaneGUI::LogView> LogView = LogViewControl.lock())
+    {
+        LogView->Append(LogViewLines);
+    }
+}
+
+// Time series of a few million samples, appended in batches as a dashboard would
+// receive them.
+static std::weak_ptr<OctaneGUI::Plot> PlotControl {};
+static size_t PlotSamples = 0;
+
+static void AppendPlotSamples(OctaneGUI::Plot& Plot, size_t Count)
+{
+    std::vector<double> X(Count);
+    std::vector<std::vector<float>> Values(Plot.Data().SeriesCount(), std::vector<float>(Count));
+    for (size_t I = 0; I < Count; I++)
+    {
+        const size_t Index = PlotSamples + I;
+        X[I] = (double)Index * 0.01;
+        for (size_t Series = 0; Series < Values.size(); Series++)
+        {
+            const uint32_t Hash = (uint32_t)(Index * (Series + 1)) * 2654435761u;
+            Values[Series][I] = std::sin((float)Index * 1e-5f + (float)Series) * 50.0f + (float)(Hash >> 24) * 0.1f;
+        }
+    }
+
+    Plot.Append(X, Values);
+    PlotSamples += Count;
+}
+
+static void PlotScene(OctaneGUI::Application& Application, size_t Count)
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "Plot", "ID": "Plot", "Expand": "Both", "Series": [{}, {}]})", List);
+
+    std::shared_ptr<OctaneGUI::Plot> Plot = List.To<OctaneGUI::Plot>("Plot");
+    PlotSamples = 0;
+    for (size_t Start = 0; Start < Count; Start += 1000000)
+    {
+        AppendPlotSamples(*Plot, std::min<size_t>(1000000, Count - Start));
+    }
+    PlotControl = Plot;
+}
+
+static void Plot1MScene(OctaneGUI::Application& Application)
+{
+    PlotScene(Application, 1000000);
+}
+
+static void Plot10MScene(OctaneGUI::Application& Application)
+{
+    PlotScene(Application, 10000000);
+}
+
+// Appends 10000 samples each frame while following the newest samples.
+static void PlotStream(OctaneGUI::Application&, int Frame)
+{
+    if (std::shared_ptr<OctaneGUI::Plot> Plot = PlotControl.lock())
+    {
+        if (Frame == 0)
+        {
+            const double Last = Plot->Data().X(Plot->Data().Count() - 1);
+            Plot->SetView(Last - 1000.0, Last).SetFollow(true);
+        }
+
+        AppendPlotSamples(*Plot, 10000);
+    }
+}
+
+static void TextEditorScene(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "TextEditor", "ID": "TextEditor", "Expand": "Both"})", List);
+
+    // Roughly 1MB of text split into 64 character lines.
+    std::string Contents;
+    Contents.reserve(1 << 20);
+    while (Contents.size() < (1 << 20))
+    {
+        Contents += "int Value = Compute(Input, Output); // Line ";
+        Contents += std::to_string(Contents.size() / 64);
+        Contents += std::string(64 - (Contents.size() % 64) - 1, ' ');
+        Contents += "\n";
+    }
+
+    std::shared_ptr<OctaneGUI::TextEditor> TextEditor = List.To<OctaneGUI::TextEditor>("TextEditor");
+    TextEditor->SetText(Contents.c_str());
+    Application.GetMainWindow()->SetFocus(TextEditor->Interaction());
+}
+
+static void AddBoxes(const std::shared_ptr<OctaneGUI::Container>& Parent, int Depth)
+{
+    for (int I = 0; I < 4; I++)
+    {
+        if (Depth == 0)
+        {
+            Parent->AddControl<OctaneGUI::TextButton>()->SetText(("Button " + std::to_string(I)).c_str());
+            continue;
+        }
+
+        std::shared_ptr<OctaneGUI::Container> Child;
+        if (Depth % 2 == 0)
+        {
+            Child = Parent->AddControl<OctaneGUI::HorizontalContainer>();
+        }
+        else
+        {
+            Child = Parent->AddControl<OctaneGUI::VerticalContainer>();
+        }
+
+        Child->SetExpand(OctaneGUI::Expand::Both);
+        AddBoxes(Child, Depth - 1);
+    }
+}
+
+static void BoxContainersScene(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "VerticalContainer", "ID": "Root", "Expand": "Both"})", List);
+    AddBoxes(List.To<OctaneGUI::Container>("Root"), 4);
+}
+
+// Rows of rounded buttons and radio buttons, which are mostly arcs and circles.
+static void ShapesScene(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "VerticalContainer", "ID": "Root", "Expand": "Both"})", List);
+
+    std::shared_ptr<OctaneGUI::Container> Root = List.To<OctaneGUI::Container>("Root");
+    for (int Row = 0; Row < 25; Row++)
+    {
+        std::shared_ptr<OctaneGUI::HorizontalContainer> Columns = Root->AddControl<OctaneGUI::HorizontalContainer>();
+        for (int Column = 0; Column < 10; Column++)
+        {
+            Columns->AddControl<OctaneGUI::TextButton>()->SetText("Rounded")->SetRadius(6.0f);
+            Columns->AddControl<OctaneGUI::RadioButton>()->SetText(U"Radio");
+        }
+    }
+}
+
+// A grid of small images that are packed into the texture atlas.
+static void ImageGridScene(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"Type": "VerticalContainer", "ID": "Root", "Expand": "Both"})", List);
+
+    const char* Paths[] = { "Resources/thumbs_up.png", "Resources/Check.svg", "Resources/Close.svg", "Resources/Folder.svg" };
+    std::shared_ptr<OctaneGUI::Container> Root = List.To<OctaneGUI::Container>("Root");
+    for (int Row = 0; Row < 20; Row++)
+    {
+        std::shared_ptr<OctaneGUI::HorizontalContainer> Columns = Root->AddControl<OctaneGUI::HorizontalContainer>();
+        for (int Column = 0; Column < 40; Column++)
+        {
+            Columns->AddControl<OctaneGUI::Image>()->SetTexture(Paths[(Row + Column) % 4]);
+        }
+    }
+
+    Application.GetAssetLoader().Wait();
+}
+
+// Layout-like document of roughly 1MB with about 5k controls shared by the Json workloads.
+static std::string JsonDocument {};
+static std::string JsonBinary {};
+
+static void AddJsonControls(std::string& Stream, int Depth, int& Count)
+{
+    Stream += "\"Controls\": [";
+    for (int I = 0; I < 8; I++)
+    {
+        const std::string ID = std::to_string(Count++);
+        Stream += I > 0 ? ", {" : "{";
+        Stream += "\"ID\": \"Control" + ID + "\", \"Type\": \"" + (Depth > 0 ? "VerticalContainer" : "Text") + "\", ";
+        Stream += "\"Expand\": \"Width\", \"Visible\": true, \"Size\": [" + ID + ".5, -24.25], ";
+        Stream += "\"Text\": {\"Text\": \"Label " + ID + "\\n\\u00e9\\u4e2d\"}, \"Tooltip\": null";
+        if (Depth > 0)
+        {
+            Stream += ", ";
+            AddJsonControls(Stream, Depth - 1, Count);
+        }
+        Stream += "}";
+    }
+    Stream += "]";
+}
+
+static void JsonScene(OctaneGUI::Application&)
+{
+    JsonDocument = "{\"Width\": 1280, \"Height\": 720, \"Body\": {";
+    int Count = 0;
+    AddJsonControls(JsonDocument, 3, Count);
+    JsonDocument += "}}";
+    JsonBinary = OctaneGUI::Json::Parse(JsonDocument.c_str()).ToBinary();
+}
+
+static void JsonParse(OctaneGUI::Application&, int)
+{
+    OctaneGUI::Json::Parse(JsonDocument.c_str());
+}
+
+static void JsonParseBinary(OctaneGUI::Application&, int)
+{
+    bool IsError = false;
+    OctaneGUI::Json::FromBinary(JsonBinary.data(), JsonBinary.size(), IsError);
+}
+
+static void JsonLoad(OctaneGUI::Application& Application, int)
+{
+    Application.GetMainWindow()->Clear();
+    Application.GetMainWindow()->Load(OctaneGUI::Json::Parse(JsonDocument.c_str()));
+}
+
+static void JsonLoadBinary(OctaneGUI::Application& Application, int)
+{
+    Application.GetMainWindow()->Clear();
+    bool IsError = false;
+    Application.GetMainWindow()->Load(OctaneGUI::Json::FromBinary(JsonBinary.data(), JsonBinary.size(), IsError));
+}
+
+BENCHMARK(Json, JsonScene,
+    WORKLOAD(Parse, JsonParse)
+    WORKLOAD(ParseBinary, JsonParseBinary)
+    WORKLOAD(Load, JsonLoad)
+    WORKLOAD(LoadBinary, JsonLoadBinary)
+)
+
+// Rasterized font atlases and icons measured without the on-disk cache, with a cache
+// that is cleared every frame and with a warm cache.
+static std::vector<OctaneGUI::Icons::Definition> AssetIcons {};
+
+static void AssetsScene(OctaneGUI::Application& Application)
+{
+    AssetIcons.clear();
+    const OctaneGUI::Json Root = OctaneGUI::Json::Parse(Application.FS().LoadContents("Resources/Icons.json").c_str());
+    const OctaneGUI::Json& Types = Root["Types"];
+    for (unsigned int I = 0; I < Types.Count(); I++)
+    {
+        AssetIcons.push_back({ Types[I]["Type"].String(), Types[I]["FileName"].String() });
+    }
+
+    const std::string Directory = (std::filesystem::temp_directory_path() / "OctaneGUI.Benchmarks").string();
+    OctaneGUI::AssetCache::SetDirectory(Directory.c_str());
+    OctaneGUI::AssetCache::Clear();
+}
+
+static void LoadAssets()
+{
+    OctaneGUI::Font::Create("Resources/Roboto-Regular.ttf", 36.0f);
+    OctaneGUI::Icons().Initialize(AssetIcons, { 48.0f, 48.0f });
+}
+
+static void AssetsUncached(OctaneGUI::Application&, int)
+{
+    const std::string Directory = OctaneGUI::AssetCache::Directory();
+    OctaneGUI::AssetCache::SetDirectory(nullptr);
+    LoadAssets();
+    OctaneGUI::AssetCache::SetDirectory(Directory.c_str());
+}
+
+static void AssetsCold(OctaneGUI::Application&, int)
+{
+    OctaneGUI::AssetCache::Clear();
+    LoadAssets();
+}
+
+static void AssetsWarm(OctaneGUI::Application&, int)
+{
+    LoadAssets();
+}
+
+BENCHMARK(Assets, AssetsScene,
+    WORKLOAD(Uncached, AssetsUncached)
+    WORKLOAD(Cold, AssetsCold)
+    WORKLOAD(Warm, AssetsWarm)
+)
+
+BENCHMARK(ListBox, ListBoxScene,
+    WORKLOAD(Scroll, Workloads::Scroll)
+    WORKLOAD(Resize, Workloads::Resize)
+    WORKLOAD(HoverSweep, Workloads::HoverSweep)
+)
+
+BENCHMARK(Tree, TreeScene,
+    WORKLOAD(Scroll, Workloads::Scroll)
+    WORKLOAD(Resize, Workloads::Resize)
+    WORKLOAD(HoverSweep, Workloads::HoverSweep)
+)
+
+BENCHMARK(Table, TableScene,
+    WORKLOAD(Scroll, Workloads::Scroll)
+    WORKLOAD(Resize, Workloads::Resize)
+    WORKLOAD(HoverSweep, Workloads::HoverSweep)
+)
+
+BENCHMARK(LogView, LogViewScene,
+    WORKLOAD(Scroll, Workloads::Scroll)
+    WORKLOAD(Ingest, LogViewIngest)
+)
+
+BENCHMARK(Plot1M, Plot1MScene,
+    WORKLOAD(Zoom, Workloads::Scroll)
+    WORKLOAD(Resize, Workloads::Resize)
+    WORKLOAD(Stream, PlotStream)
+)
+
+BENCHMARK(Plot10M, Plot10MScene,
+    WORKLOAD(Zoom, Workloads::Scroll)
+    WORKLOAD(Resize, Workloads::Resize)
+    WORKLOAD(Stream, PlotStream)
+)
+
+BENCHMARK(TableData, TableDataScene,
+    WORKLOAD(Scroll, Workloads::Scroll)
+    WORKLOAD(Resize, Workloads::Resize)
+    WORKLOAD(HoverSweep, Workloads::HoverSweep)
+)
+
+BENCHMARK(TextEditor, TextEditorScene,
+    WORKLOAD(Scroll, Workloads::Scroll)
+    WORKLOAD(Resize, Workloads::Resize)
+    WORKLOAD(Type, Workloads::Type)
+    WORKLOAD(HoverSweep, Workloads::HoverSweep)
+)
+
+BENCHMARK(BoxContainers, BoxContainersScene,
+    WORKLOAD(Resize, Workloads::Resize)
+    WORKLOAD(HoverSweep, Workloads::HoverSweep)
+)
+
+BENCHMARK(Shapes, ShapesScene,
+    WORKLOAD(Resize, Workloads::Resize)
+    WORKLOAD(HoverSweep, Workloads::HoverSweep)
+)
+
+BENCHMARK(ImageGrid, ImageGridScene,
+    WORKLOAD(Resize, Workloads::Resize)
+)
+
+}
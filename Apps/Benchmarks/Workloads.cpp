@@ -0,0 +1,82 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Workloads.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+#include <algorithm>
+#include <string>
+
+namespace Benchmarks
+{
+namespace Workloads
+{
+
+void Scroll(OctaneGUI::Application& Application, int Frame)
+{
+    std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const float Direction = (Frame / 30) % 2 == 0 ? -1.0f : 1.0f;
+    Window->OnMouseMove(Window->GetSize() * 0.5f);
+    Window->OnMouseWheel({ 0.0f, Direction });
+}
+
+void Resize(OctaneGUI::Application& Application, int Frame)
+{
+    std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    Window->SetSize(Frame % 2 == 0 ? OctaneGUI::Vector2 { 960.0f, 540.0f } : OctaneGUI::Vector2 { 1280.0f, 720.0f });
+}
+
+void Type(OctaneGUI::Application& Application, int Frame)
+{
+    const char32_t* Text = U"The quick brown fox jumps over the lazy dog. ";
+    const size_t Length = std::char_traits<char32_t>::length(Text);
+
+    std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    if (Frame > 0 && Frame % 40 == 0)
+    {
+        Window->OnKeyPressed(OctaneGUI::Keyboard::Key::Enter);
+        Window->OnKeyReleased(OctaneGUI::Keyboard::Key::Enter);
+    }
+    else
+    {
+        Window->OnText((uint32_t)Text[Frame % Length]);
+    }
+}
+
+void HoverSweep(OctaneGUI::Application& Application, int Frame)
+{
+    const float Step = 32.0f;
+
+    std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const OctaneGUI::Vector2 Size = Window->GetSize();
+    const int Columns = std::max(1, (int)(Size.X / Step));
+    const int Rows = std::max(1, (int)(Size.Y / Step));
+    const int Cell = Frame % (Columns * Rows);
+    Window->OnMouseMove({ (Cell % Columns) * Step + Step * 0.5f, (Cell / Columns) * Step + Step * 0.5f });
+}
+
+}
+}
@@ -0,0 +1,55 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+namespace OctaneGUI
+{
+
+class Application;
+
+}
+
+namespace Benchmarks
+{
+namespace Workloads
+{
+
+/// @brief Moves the mouse to the center of the window and scrolls the wheel,
+/// changing direction every 30 frames.
+void Scroll(OctaneGUI::Application& Application, int Frame);
+
+/// @brief Alternates the main window between two sizes every frame.
+void Resize(OctaneGUI::Application& Application, int Frame);
+
+/// @brief Sends text events to the focused control with a new line every 40 characters.
+void Type(OctaneGUI::Application& Application, int Frame);
+
+/// @brief Moves the mouse across a grid of points covering the whole window.
+void HoverSweep(OctaneGUI::Application& Application, int Frame);
+
+}
+}
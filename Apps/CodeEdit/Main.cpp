@@ -6,12 +6,24 @@ int main(int argc, char** argv)
     OctaneGUI::Application Application;
     Frontend::Initialize(Application);
 
-    const std::string Contents = Application.FS().LoadContents("CodeEdit.json");
+    // Prefer the compiled layout produced by LayoutCompiler and fall back to the JSON description.
+    bool IsError = true;
+    OctaneGUI::Json Root;
+    const OctaneGUI::MappedFile Layout { "CodeEdit.layout" };
+    if (Layout.IsOpen())
+    {
+        Root = OctaneGUI::Json::FromBinary(Layout.Data(), Layout.Size(), IsError);
+    }
+
+    if (IsError)
+    {
+        Root = OctaneGUI::Json::Parse(Application.FS().LoadContents("CodeEdit.json").c_str());
+    }
 
     std::unordered_map<std::string, OctaneGUI::ControlList> WindowControls;
     Application
         .SetCommandLine(argc, argv)
-        .Initialize(Contents.c_str(), WindowControls);
+        .Initialize(Root, WindowControls);
 
     const OctaneGUI::ControlList& ControlList = WindowControls["Main"];
     std::shared_ptr<OctaneGUI::TextEditor> Editor = ControlList.To<OctaneGUI::TextEditor>("Editor");
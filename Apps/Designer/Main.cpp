@@ -23,6 +23,9 @@ int main(int argc, char** argv)
     std::shared_ptr<OctaneGUI::Container> Editor { nullptr };
     std::shared_ptr<OctaneGUI::Splitter> Splitter { nullptr };
     std::u32string OpenFileName {};
+    uint32_t OpenFileWatch { 0 };
+    OctaneGUI::Json PreviewWindowContents {};
+    OctaneGUI::Json PreviewPaneContents {};
 
     std::shared_ptr<OctaneGUI::Window> MainWindow = Application.GetWindow("Main");
     std::shared_ptr<OctaneGUI::Timer> CompileTimer = MainWindow->CreateTimer(500, false, [&]() -> void
@@ -45,32 +48,45 @@ int main(int argc, char** argv)
                 StatusBar->ClearProperty(OctaneGUI::ThemeProperties::Panel);
                 StatusText->SetText(U"OK!");
 
-                PreviewWindow->Clear();
-                PreviewPane->Clear();
+                const OctaneGUI::Json& Main = Root["Windows"]["Main"];
 
-                if (!Root.Contains("Windows"))
+                if (!Main.IsObject())
                 {
+                    PreviewWindow->Clear();
+                    PreviewPane->Clear();
+                    PreviewWindowContents = OctaneGUI::Json();
+                    PreviewPaneContents = OctaneGUI::Json();
                     return;
                 }
 
-                const OctaneGUI::Json& Windows = Root["Windows"];
-                
-                if (!Windows.Contains("Main"))
+                // Only reload the controls that changed since the last compile. A full reload
+                // is done if the previous contents can't be patched.
+                if (PreviewWindow->IsVisible())
                 {
-                    return;
-                }
+                    PreviewWindow->SetTitle(OctaneGUI::String::ToUTF32(Main["Title"].String()).c_str());
 
-                const OctaneGUI::Json& Main = Windows["Main"];
+                    if (!PreviewWindow->GetRootContainer()->Patch(PreviewWindowContents, Main))
+                    {
+                        PreviewWindow->Clear();
+                        PreviewWindow->LoadContents(Main);
+                    }
 
-                if (PreviewWindow->IsVisible())
+                    PreviewWindowContents = Main;
+                }
+                else
                 {
-                    PreviewWindow->SetTitle(OctaneGUI::String::ToUTF32(Main["Title"].String()).c_str());
-                    PreviewWindow->LoadContents(Main);
+                    PreviewWindowContents = OctaneGUI::Json();
                 }
 
                 if (PreviewPane)
                 {
-                    PreviewPane->OnLoad(Main);
+                    if (!PreviewPane->Patch(PreviewPaneContents, Main))
+                    {
+                        PreviewPane->Clear();
+                        PreviewPane->OnLoad(Main);
+                    }
+
+                    PreviewPaneContents = Main;
                 }
             }
         });
@@ -145,6 +161,22 @@ int main(int argc, char** argv)
                 {
                     Application.FS().WriteContents(FileName, Document->GetText());
                 }
+
+                // Reload the document when the file is changed by another program.
+                Application.FS().Unwatch(OpenFileWatch);
+                OpenFileWatch = Application.FS().Watch(OpenFileName, false, [&](const std::vector<OctaneGUI::FileSystem::FileChange>& Changes) -> void
+                    {
+                        if (Changes.back().Change == OctaneGUI::FileSystem::FileChange::Type::Removed)
+                        {
+                            return;
+                        }
+
+                        const std::string Contents = Application.FS().LoadContents(OctaneGUI::String::ToMultiByte(OpenFileName).c_str());
+                        if (OctaneGUI::String::ToUTF32(Contents) != Document->GetText())
+                        {
+                            Document->SetText(Contents.c_str());
+                        }
+                    });
             }
         });
     
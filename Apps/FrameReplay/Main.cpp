@@ -0,0 +1,212 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "SoftwareRenderer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Renders frames saved with Application::StartCapture with the software renderer and
+// reports their draw stats and timings as JSON.
+//
+// Usage: FrameReplay [--Iterations <count>] [--Output <path>] [Verbose] <capture or directory>...
+
+static std::vector<std::string> Collect(const std::vector<std::string>& Paths)
+{
+    std::vector<std::string> Result;
+    for (const std::string& Path : Paths)
+    {
+        std::error_code Error;
+        if (!std::filesystem::is_directory(Path, Error))
+        {
+            Result.push_back(Path);
+            continue;
+        }
+
+        std::vector<std::string> Captures;
+        for (const std::filesystem::directory_entry& Item : std::filesystem::directory_iterator(Path, Error))
+        {
+            if (Item.path().extension() == OctaneGUI::FrameCapture::Extension)
+            {
+                Captures.push_back(Item.path().string());
+            }
+        }
+
+        std::sort(Captures.begin(), Captures.end());
+        Result.insert(Result.end(), Captures.begin(), Captures.end());
+    }
+
+    return Result;
+}
+
+static OctaneGUI::Json Replay(const OctaneGUI::FrameCapture::Frame& Capture, int Iterations)
+{
+    FrameReplay::SoftwareRenderer Renderer((uint32_t)std::max(Capture.Size.X, 0.0f), (uint32_t)std::max(Capture.Size.Y, 0.0f));
+
+    OctaneGUI::Clock Clock;
+    for (const OctaneGUI::FrameCapture::TextureData& Texture : Capture.Textures)
+    {
+        Renderer.LoadTexture(Texture);
+    }
+    const float Upload = Clock.Measure() * 1000.0f;
+
+    int Missing = 0;
+    std::vector<uint32_t> Referenced;
+    for (const OctaneGUI::DrawCommand& Command : Capture.Buffer.Commands())
+    {
+        if (Command.TextureID() != 0 && std::find(Referenced.begin(), Referenced.end(), Command.TextureID()) == Referenced.end())
+        {
+            Referenced.push_back(Command.TextureID());
+            Missing += Renderer.HasTexture(Command.TextureID()) ? 0 : 1;
+        }
+    }
+
+    std::vector<float> Samples;
+    FrameReplay::SoftwareRenderer::Stats Stats {};
+    for (int I = 0; I < Iterations; I++)
+    {
+        Clock.Reset();
+        Stats = Renderer.Paint(Capture.Buffer);
+        Samples.push_back(Clock.Measure() * 1000.0f);
+    }
+    std::sort(Samples.begin(), Samples.end());
+
+    float Total = 0.0f;
+    for (float Sample : Samples)
+    {
+        Total += Sample;
+    }
+
+    OctaneGUI::Json Result(OctaneGUI::Json::Type::Object);
+    Result["Window"] = Capture.WindowID;
+    Result["Frame"] = (float)Capture.Number;
+    Result["Width"] = Capture.Size.X;
+    Result["Height"] = Capture.Size.Y;
+    Result["Compact"] = Capture.Buffer.IsCompact();
+    Result["Commands"] = (float)Stats.Commands;
+    Result["Vertices"] = (float)Capture.Buffer.GetVertexCount();
+    Result["Indices"] = (float)Capture.Buffer.GetIndexCount();
+    Result["Triangles"] = (float)Stats.Triangles;
+    Result["Bytes"] = (float)Capture.Buffer.GetByteSize();
+    Result["Textures"] = (float)Referenced.size();
+    Result["MissingTextures"] = (float)Missing;
+    Result["Pixels"] = (float)Stats.Pixels;
+    Result["Upload"] = Upload;
+
+    OctaneGUI::Json Time(OctaneGUI::Json::Type::Object);
+    Time["Min"] = Samples.front();
+    Time["Mean"] = Total / (float)Samples.size();
+    Time["P50"] = Samples[Samples.size() / 2];
+    Time["Max"] = Samples.back();
+    Result["Paint"] = std::move(Time);
+
+    return Result;
+}
+
+int main(int argc, char** argv)
+{
+    bool Verbose = false;
+    int Iterations = 20;
+    std::string Output;
+    std::vector<std::string> Paths;
+    for (int I = 1; I < argc; I++)
+    {
+        const std::string Arg { argv[I] };
+        if (Arg == "Verbose")
+        {
+            Verbose = true;
+        }
+        else if (Arg == "--Iterations" && I + 1 < argc)
+        {
+            Iterations = std::max(1, std::atoi(argv[++I]));
+        }
+        else if (Arg == "--Output" && I + 1 < argc)
+        {
+            Output = argv[++I];
+        }
+        else
+        {
+            Paths.push_back(Arg);
+        }
+    }
+
+    const std::vector<std::string> Captures = Collect(Paths);
+    if (Captures.empty())
+    {
+        printf("Usage: FrameReplay [--Iterations <count>] [--Output <path>] [Verbose] <capture or directory>...\n");
+        return -1;
+    }
+
+    OctaneGUI::Json Results(OctaneGUI::Json::Type::Object);
+    Results["Iterations"] = (float)Iterations;
+    Results["Captures"] = OctaneGUI::Json(OctaneGUI::Json::Type::Object);
+
+    int Failed = 0;
+    for (const std::string& Path : Captures)
+    {
+        if (Verbose)
+        {
+            printf("Replaying '%s'\n", Path.c_str());
+        }
+
+        OctaneGUI::FrameCapture::Frame Capture;
+        if (!OctaneGUI::FrameCapture::Load(Path.c_str(), Capture))
+        {
+            printf("Failed to load capture '%s'.\n", Path.c_str());
+            Failed++;
+            continue;
+        }
+
+        Results["Captures"][Path] = Replay(Capture, Iterations);
+    }
+
+    if (Output.empty())
+    {
+        printf("%s\n", Results.ToStringPretty().c_str());
+    }
+    else
+    {
+        std::ofstream Stream(Output, std::ios_base::out | std::ios_base::trunc);
+        Stream << Results.ToStringPretty();
+
+        if (Stream.good())
+        {
+            printf("Wrote replay results to '%s'.\n", Output.c_str());
+        }
+        else
+        {
+            printf("Failed to write replay results to '%s'.\n", Output.c_str());
+        }
+    }
+
+    return Failed == 0 ? 0 : -1;
+}
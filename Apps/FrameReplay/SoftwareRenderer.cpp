@@ -0,0 +1,202 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "SoftwareRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace FrameReplay
+{
+
+static OctaneGUI::Vector2 TexCoords(const OctaneGUI::Vertex& Item)
+{
+    return Item.TexCoords;
+}
+
+static OctaneGUI::Vector2 TexCoords(const OctaneGUI::CompactVertex& Item)
+{
+    return Item.TexCoords();
+}
+
+static float Edge(const OctaneGUI::Vector2& A, const OctaneGUI::Vector2& B, float X, float Y)
+{
+    return (B.X - A.X) * (Y - A.Y) - (B.Y - A.Y) * (X - A.X);
+}
+
+static uint8_t Blend(float Source, float Alpha, uint8_t Dest)
+{
+    return (uint8_t)std::lround(std::clamp(Source * Alpha + (float)Dest * (1.0f - Alpha), 0.0f, 255.0f));
+}
+
+SoftwareRenderer::SoftwareRenderer(uint32_t Width, uint32_t Height)
+    : m_Width(Width)
+    , m_Height(Height)
+{
+    m_Pixels.resize((size_t)Width * Height * 4);
+}
+
+void SoftwareRenderer::LoadTexture(const OctaneGUI::FrameCapture::TextureData& Texture)
+{
+    m_Textures[Texture.ID] = { Texture.Width, Texture.Height, Texture.Pixels };
+}
+
+bool SoftwareRenderer::HasTexture(uint32_t ID) const
+{
+    return m_Textures.find(ID) != m_Textures.end();
+}
+
+SoftwareRenderer::Stats SoftwareRenderer::Paint(const OctaneGUI::VertexBuffer& Buffer)
+{
+    // Cleared to opaque black, same as the frontends.
+    for (size_t I = 0; I < m_Pixels.size(); I += 4)
+    {
+        m_Pixels[I + 0] = 0;
+        m_Pixels[I + 1] = 0;
+        m_Pixels[I + 2] = 0;
+        m_Pixels[I + 3] = 255;
+    }
+
+    Stats Result {};
+    if (Buffer.IsCompact())
+    {
+        Draw(Buffer, Buffer.GetCompactVertices(), Buffer.GetCompactIndices(), Result);
+    }
+    else
+    {
+        Draw(Buffer, Buffer.GetVertices(), Buffer.GetIndices(), Result);
+    }
+
+    return Result;
+}
+
+const std::vector<uint8_t>& SoftwareRenderer::Pixels() const
+{
+    return m_Pixels;
+}
+
+template <typename V, typename I>
+void SoftwareRenderer::Draw(const OctaneGUI::VertexBuffer& Buffer, const std::vector<V>& Vertices, const std::vector<I>& Indices, Stats& Result)
+{
+    const OctaneGUI::Rect Target { 0.0f, 0.0f, (float)m_Width, (float)m_Height };
+    for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
+    {
+        Result.Commands++;
+
+        const OctaneGUI::Rect Clip = Command.Clip().IsZero() ? Target : Command.Clip();
+        const auto It = m_Textures.find(Command.TextureID());
+        const Image* Texture = It != m_Textures.end() ? &It->second : nullptr;
+
+        // FrameCapture::Load rejects captures with commands or indices out of range.
+        for (uint32_t Index = 0; Index + 2 < Command.IndexCount(); Index += 3)
+        {
+            Point Points[3];
+            for (uint32_t Corner = 0; Corner < 3; Corner++)
+            {
+                const V& Item = Vertices[Command.VertexOffset() + Indices[Command.IndexOffset() + Index + Corner]];
+                Points[Corner] = { Item.Position, TexCoords(Item), Item.Col };
+            }
+
+            Result.Triangles++;
+            Result.Pixels += Triangle(Points[0], Points[1], Points[2], Clip, Texture);
+        }
+    }
+}
+
+uint64_t SoftwareRenderer::Triangle(const Point& A, const Point& B, const Point& C, const OctaneGUI::Rect& Clip, const Image* Texture)
+{
+    const float Area = Edge(A.Position, B.Position, C.Position.X, C.Position.Y);
+    if (Area == 0.0f)
+    {
+        return 0;
+    }
+
+    const float MinX = std::max({ std::min({ A.Position.X, B.Position.X, C.Position.X }), Clip.Min.X, 0.0f });
+    const float MinY = std::max({ std::min({ A.Position.Y, B.Position.Y, C.Position.Y }), Clip.Min.Y, 0.0f });
+    const float MaxX = std::min({ std::max({ A.Position.X, B.Position.X, C.Position.X }), Clip.Max.X, (float)m_Width });
+    const float MaxY = std::min({ std::max({ A.Position.Y, B.Position.Y, C.Position.Y }), Clip.Max.Y, (float)m_Height });
+    if (MinX >= MaxX || MinY >= MaxY)
+    {
+        return 0;
+    }
+
+    uint64_t Result = 0;
+    const float InvArea = 1.0f / Area;
+    for (int Y = (int)std::floor(MinY); Y < (int)std::ceil(MaxY); Y++)
+    {
+        const float CenterY = (float)Y + 0.5f;
+        if (CenterY < MinY || CenterY > MaxY)
+        {
+            continue;
+        }
+
+        for (int X = (int)std::floor(MinX); X < (int)std::ceil(MaxX); X++)
+        {
+            const float CenterX = (float)X + 0.5f;
+            if (CenterX < MinX || CenterX > MaxX)
+            {
+                continue;
+            }
+
+            // Barycentric weights. Their signs match the area's sign for points inside the triangle.
+            const float WA = Edge(B.Position, C.Position, CenterX, CenterY) * InvArea;
+            const float WB = Edge(C.Position, A.Position, CenterX, CenterY) * InvArea;
+            const float WC = Edge(A.Position, B.Position, CenterX, CenterY) * InvArea;
+            if (WA < 0.0f || WB < 0.0f || WC < 0.0f)
+            {
+                continue;
+            }
+
+            float R = WA * A.Col.R + WB * B.Col.R + WC * C.Col.R;
+            float G = WA * A.Col.G + WB * B.Col.G + WC * C.Col.G;
+            float Bl = WA * A.Col.B + WB * B.Col.B + WC * C.Col.B;
+            float Alpha = (WA * A.Col.A + WB * B.Col.A + WC * C.Col.A) / 255.0f;
+
+            if (Texture != nullptr && Texture->Width > 0 && Texture->Height > 0)
+            {
+                const float U = WA * A.TexCoords.X + WB * B.TexCoords.X + WC * C.TexCoords.X;
+                const float V = WA * A.TexCoords.Y + WB * B.TexCoords.Y + WC * C.TexCoords.Y;
+                const uint32_t TX = std::min<uint32_t>((uint32_t)std::max(U * (float)Texture->Width, 0.0f), Texture->Width - 1);
+                const uint32_t TY = std::min<uint32_t>((uint32_t)std::max(V * (float)Texture->Height, 0.0f), Texture->Height - 1);
+                const uint8_t* Texel = &Texture->Pixels[((size_t)TY * Texture->Width + TX) * 4];
+                R *= Texel[0] / 255.0f;
+                G *= Texel[1] / 255.0f;
+                Bl *= Texel[2] / 255.0f;
+                Alpha *= Texel[3] / 255.0f;
+            }
+
+            uint8_t* Dest = &m_Pixels[((size_t)Y * m_Width + X) * 4];
+            Dest[0] = Blend(R, Alpha, Dest[0]);
+            Dest[1] = Blend(G, Alpha, Dest[1]);
+            Dest[2] = Blend(Bl, Alpha, Dest[2]);
+            Result++;
+        }
+    }
+
+    return Result;
+}
+
+}
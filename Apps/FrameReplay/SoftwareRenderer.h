@@ -0,0 +1,88 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "OctaneGUI/OctaneGUI.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace FrameReplay
+{
+
+/// @brief Rasterizes vertex buffers into an RGBA image on the CPU.
+///
+/// Follows the same rules as the frontend renderers: commands are clipped to their clip
+/// rectangle, or to the whole target if it is empty, a texture ID of 0 draws with a white
+/// texture and colors are blended with the source alpha. Textures are sampled with the
+/// nearest texel.
+class SoftwareRenderer
+{
+public:
+    struct Stats
+    {
+        uint32_t Commands { 0 };
+        uint32_t Triangles { 0 };
+        uint64_t Pixels { 0 };
+    };
+
+    SoftwareRenderer(uint32_t Width, uint32_t Height);
+
+    void LoadTexture(const OctaneGUI::FrameCapture::TextureData& Texture);
+    bool HasTexture(uint32_t ID) const;
+
+    Stats Paint(const OctaneGUI::VertexBuffer& Buffer);
+
+    const std::vector<uint8_t>& Pixels() const;
+
+private:
+    struct Image
+    {
+        uint32_t Width { 0 };
+        uint32_t Height { 0 };
+        std::vector<uint8_t> Pixels {};
+    };
+
+    struct Point
+    {
+        OctaneGUI::Vector2 Position {};
+        OctaneGUI::Vector2 TexCoords {};
+        OctaneGUI::Color Col {};
+    };
+
+    template <typename V, typename I>
+    void Draw(const OctaneGUI::VertexBuffer& Buffer, const std::vector<V>& Vertices, const std::vector<I>& Indices, Stats& Result);
+    uint64_t Triangle(const Point& A, const Point& B, const Point& C, const OctaneGUI::Rect& Clip, const Image* Texture);
+
+    uint32_t m_Width { 0 };
+    uint32_t m_Height { 0 };
+    std::vector<uint8_t> m_Pixels {};
+    std::unordered_map<uint32_t, Image> m_Textures {};
+};
+
+}
@@ -0,0 +1,75 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Compiles a JSON application or window description into the binary layout format
+// loaded by OctaneGUI::Json::FromBinary.
+//
+// Usage: LayoutCompiler <Input.json> <Output.layout>
+
+#include "OctaneGUI/Json.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        printf("Usage: LayoutCompiler <Input.json> <Output.layout>\n");
+        return -1;
+    }
+
+    std::ifstream Input(argv[1]);
+    if (!Input.is_open())
+    {
+        printf("Failed to open '%s'.\n", argv[1]);
+        return -1;
+    }
+
+    std::stringstream Stream;
+    Stream << Input.rdbuf();
+    const std::string Contents = Stream.str();
+
+    bool IsError = false;
+    const OctaneGUI::Json Root = OctaneGUI::Json::Parse(Contents.c_str(), IsError);
+    if (IsError)
+    {
+        printf("Failed to parse '%s': %s\n", argv[1], Root["Error"].String());
+        return -1;
+    }
+
+    const std::string Binary = Root.ToBinary();
+    std::ofstream Output(argv[2], std::ios::binary | std::ios::trunc);
+    if (!Output.is_open() || !Output.write(Binary.data(), Binary.size()))
+    {
+        printf("Failed to write '%s'.\n", argv[2]);
+        return -1;
+    }
+
+    printf("Compiled '%s' (%zu bytes) to '%s' (%zu bytes).\n", argv[1], Contents.size(), argv[2], Binary.size());
+    return 0;
+}
@@ -26,11 +26,14 @@ SOFTWARE.
 
 #include "Frontend.h"
 #include "OctaneGUI/OctaneGUI.h"
+#include "OctaneGUI/Profiler.h"
 
 #include <filesystem>
 #include <fstream>
 #include <string>
 
+PROFILER_TRACK_ALLOCATIONS()
+
 std::unordered_map<std::string, std::string> Themes;
 
 std::string GetContents(const char* Filename)
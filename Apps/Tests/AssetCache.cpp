@@ -0,0 +1,186 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "OctaneGUI/Texture.h"
+#include "TestSuite.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace Tests
+{
+
+static std::filesystem::path CacheDirectory()
+{
+    const std::filesystem::path Result = std::filesystem::temp_directory_path() / "OctaneGUI.Tests" / "AssetCache";
+    std::filesystem::remove_all(Result);
+    OctaneGUI::AssetCache::SetDirectory(Result.string().c_str());
+    return Result;
+}
+
+static void ResetCache(const std::filesystem::path& Directory)
+{
+    OctaneGUI::AssetCache::SetDirectory(nullptr);
+    std::filesystem::remove_all(Directory);
+}
+
+static size_t EntryCount(const std::filesystem::path& Directory)
+{
+    size_t Result = 0;
+    for (const std::filesystem::directory_entry& Item : std::filesystem::directory_iterator(Directory))
+    {
+        if (Item.is_regular_file())
+        {
+            Result++;
+        }
+    }
+    return Result;
+}
+
+static bool FontsEqual(const OctaneGUI::Font& A, const OctaneGUI::Font& B)
+{
+    const std::u32string_view Text { U"The quick brown fox jumps over the lazy dog. éÿ" };
+    return A.GetTexture()->GetSize() == B.GetTexture()->GetSize()
+        && A.Ascent() == B.Ascent()
+        && A.Descent() == B.Descent()
+        && A.SpaceSize() == B.SpaceSize()
+        && A.Measure(Text) == B.Measure(Text);
+}
+
+TEST_SUITE(AssetCache,
+
+TEST_CASE(Disabled,
+{
+    OctaneGUI::AssetCache::SetDirectory(nullptr);
+
+    OctaneGUI::AssetCache::Entry Item;
+    Item.Width = 1;
+    Item.Height = 1;
+    Item.Pixels = std::vector<uint8_t>({ 1, 2, 3, 4 });
+    return !OctaneGUI::AssetCache::Enabled() && !OctaneGUI::AssetCache::Store({ "Disabled" }, Item);
+})
+
+TEST_CASE(StoreLoad,
+{
+    const std::filesystem::path Directory = CacheDirectory();
+
+    OctaneGUI::AssetCache::Entry Item;
+    Item.Width = 2;
+    Item.Height = 1;
+    Item.Metadata = std::vector<uint8_t>({ 9, 8, 7 });
+    Item.Pixels = std::vector<uint8_t>({ 1, 2, 3, 4, 5, 6, 7, 8 });
+
+    OctaneGUI::AssetCache::Key Key { "StoreLoad" };
+    Key.Add(2.0f);
+    VERIFYF(OctaneGUI::AssetCache::Store(Key, Item), "Failed to store entry.");
+
+    OctaneGUI::AssetCache::Entry Loaded;
+    const bool Result = OctaneGUI::AssetCache::Load(Key, Loaded);
+    ResetCache(Directory);
+
+    VERIFYF(Result, "Failed to load stored entry.");
+    return Loaded.Width == Item.Width
+        && Loaded.Height == Item.Height
+        && Loaded.Metadata == Item.Metadata
+        && Loaded.Pixels == Item.Pixels;
+})
+
+TEST_CASE(KeyInvalidation,
+{
+    const std::filesystem::path Directory = CacheDirectory();
+    std::filesystem::create_directories(Directory);
+    const std::filesystem::path Source = Directory / "Source.svg";
+    {
+        std::ofstream Stream { Source };
+        Stream << "<svg></svg>";
+    }
+
+    OctaneGUI::AssetCache::Key Original { "Icon" };
+    Original.AddFile(Source.string().c_str());
+
+    OctaneGUI::AssetCache::Key Scaled { "Icon" };
+    Scaled.AddFile(Source.string().c_str());
+    Scaled.Add(2.0f);
+
+    {
+        std::ofstream Stream(Source, std::ios::trunc);
+        Stream << "<svg ></svg>";
+    }
+
+    OctaneGUI::AssetCache::Key Modified { "Icon" };
+    Modified.AddFile(Source.string().c_str());
+
+    OctaneGUI::AssetCache::Key Same { "Icon" };
+    Same.AddFile(Source.string().c_str());
+
+    ResetCache(Directory);
+
+    return Original.Value() != Scaled.Value()
+        && Original.Value() != Modified.Value()
+        && Modified.Value() == Same.Value();
+})
+
+TEST_CASE(FontWarm,
+{
+    const std::filesystem::path Directory = CacheDirectory();
+
+    std::shared_ptr<OctaneGUI::Font> Cold = OctaneGUI::Font::Create("Resources/Roboto-Regular.ttf", 21.0f);
+    VERIFYF(Cold != nullptr, "Failed to load cold font.");
+    VERIFYF(EntryCount(Directory) == 1, "Expected a single cache entry.");
+
+    std::shared_ptr<OctaneGUI::Font> Warm = OctaneGUI::Font::Create("Resources/Roboto-Regular.ttf", 21.0f);
+    const size_t Entries = EntryCount(Directory);
+    ResetCache(Directory);
+
+    VERIFYF(Warm != nullptr, "Failed to load warm font.");
+    VERIFYF(Entries == 1, "Warm load should not add entries but found %zu.", Entries);
+    return FontsEqual(*Cold, *Warm);
+})
+
+TEST_CASE(CorruptEntry,
+{
+    const std::filesystem::path Directory = CacheDirectory();
+
+    std::shared_ptr<OctaneGUI::Font> Cold = OctaneGUI::Font::Create("Resources/Roboto-Regular.ttf", 22.0f);
+    VERIFYF(Cold != nullptr, "Failed to load cold font.");
+
+    for (const std::filesystem::directory_entry& Item : std::filesystem::directory_iterator(Directory))
+    {
+        std::ofstream Stream(Item.path(), std::ios::trunc | std::ios::binary);
+        Stream << "OGAC";
+    }
+
+    std::shared_ptr<OctaneGUI::Font> Rebuilt = OctaneGUI::Font::Create("Resources/Roboto-Regular.ttf", 22.0f);
+    ResetCache(Directory);
+
+    VERIFYF(Rebuilt != nullptr, "Failed to load font with a corrupt cache entry.");
+    return FontsEqual(*Cold, *Rebuilt);
+})
+
+)
+
+}
@@ -0,0 +1,202 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "OctaneGUI/Icons.h"
+#include "OctaneGUI/Texture.h"
+#include "TestSuite.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace Tests
+{
+
+static std::shared_ptr<OctaneGUI::Image> LoadImage(OctaneGUI::Application& Application, const char* Path)
+{
+    const std::string Json = std::string(R"({"Width": 1280, "Height": 720, "Body": {"Controls": [{"Type": "Image", "ID": "Image", "Texture": ")") + Path + "\"}]}}";
+    OctaneGUI::ControlList List;
+    Application.GetMainWindow()->Clear();
+    Application.GetMainWindow()->Load(Json.c_str(), List);
+    return List.To<OctaneGUI::Image>("Image");
+}
+
+static std::vector<OctaneGUI::Icons::Definition> IconDefinitions()
+{
+    return {
+        { "ArrowLeft", "Resources/ArrowLeft.svg" },
+        { "Check", "Resources/Check.svg" }
+    };
+}
+
+TEST_SUITE(AssetLoader,
+
+TEST_CASE(Completions,
+{
+    OctaneGUI::ThreadPool Pool;
+    Pool.SetThreads(2);
+    OctaneGUI::AssetLoader Loader { Pool };
+
+    std::atomic<int> Worked { 0 };
+    std::vector<std::thread::id> Completed;
+    for (int I = 0; I < 8; I++)
+    {
+        Loader.Run([&]() -> void
+            {
+                Worked++;
+            },
+            [&]() -> void
+            {
+                Completed.push_back(std::this_thread::get_id());
+            });
+    }
+
+    VERIFYF(Completed.empty(), "Completions should only be invoked when processed.");
+    Loader.Wait();
+
+    VERIFYF(Worked == 8, "Expected 8 jobs to run but %d ran.", Worked.load());
+    VERIFYF(Completed.size() == 8, "Expected 8 completions but received %zu.", Completed.size());
+    for (const std::thread::id& ID : Completed)
+    {
+        VERIFYF(ID == std::this_thread::get_id(), "Completion was invoked on a worker thread.");
+    }
+
+    return Loader.Pending() == 0;
+})
+
+TEST_CASE(NoThreads,
+{
+    OctaneGUI::ThreadPool Pool;
+    Pool.SetThreads(0);
+    OctaneGUI::AssetLoader Loader { Pool };
+
+    // A pool without threads for batches still runs the work on a worker.
+    const std::thread::id Caller = std::this_thread::get_id();
+    std::thread::id Worker = Caller;
+    std::thread::id Completed = {};
+    Loader.Run([&]() -> void
+        {
+            Worker = std::this_thread::get_id();
+        },
+        [&]() -> void
+        {
+            Completed = std::this_thread::get_id();
+        });
+
+    Loader.Wait();
+    VERIFYF(Worker != Caller, "Work should run on a worker thread.");
+    return Completed == Caller && Loader.Pending() == 0;
+})
+
+TEST_CASE(Cancel,
+{
+    OctaneGUI::ThreadPool Pool;
+    Pool.SetThreads(1);
+
+    std::atomic<bool> Started { false };
+    std::atomic<bool> Release { false };
+    std::atomic<int> Worked { 0 };
+    std::thread Releaser;
+    {
+        OctaneGUI::AssetLoader Loader { Pool };
+        Loader.Run([&]() -> void
+            {
+                Started = true;
+                while (!Release)
+                {
+                    std::this_thread::yield();
+                }
+                Worked++;
+            },
+            nullptr);
+        Loader.Run([&]() -> void
+            {
+                Worked++;
+            },
+            nullptr);
+
+        while (!Started)
+        {
+            std::this_thread::yield();
+        }
+
+        // The loader waits for the running job while the queued one is skipped.
+        Releaser = std::thread([&Release]() -> void
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                Release = true;
+            });
+    }
+    Releaser.join();
+
+    VERIFYF(Worked == 1, "Expected only the running job to finish but %d did.", Worked.load());
+    return true;
+})
+
+TEST_CASE(ImagePlaceholder,
+{
+    const std::shared_ptr<OctaneGUI::Image> Image = LoadImage(Application, "Resources/info.png");
+    VERIFYF(Image->GetSize().IsZero(), "Image should not have a size while loading.");
+    VERIFY(Application.GetTextureCache().IsLoading("Resources/info.png"));
+
+    Application.GetAssetLoader().Wait();
+
+    const std::shared_ptr<OctaneGUI::Texture> Texture = Application.GetTextureCache().Cache().at("Resources/info.png");
+    VERIFYF(Texture->IsValid(), "Texture was not uploaded.");
+    VERIFYF(Image->GetSize() == Texture->GetSize(), "Image was not resized to the loaded texture.");
+
+    // Loading an already loaded texture is immediate.
+    const std::shared_ptr<OctaneGUI::Image> Again = LoadImage(Application, "Resources/info.png");
+    return Again->GetSize() == Texture->GetSize() && Application.GetAssetLoader().Pending() == 0;
+})
+
+TEST_CASE(ImageMissing,
+{
+    const std::shared_ptr<OctaneGUI::Image> Image = LoadImage(Application, "Resources/Missing.png");
+    Application.GetAssetLoader().Wait();
+
+    return Image->GetSize().IsZero()
+        && !Application.GetTextureCache().IsLoading("Resources/Missing.png")
+        && Application.GetTextureCache().Cache().count("Resources/Missing.png") == 0;
+})
+
+TEST_CASE(Icons,
+{
+    OctaneGUI::Icons Icons;
+    Icons.Initialize(IconDefinitions(), OctaneGUI::Vector2(16.0f, 16.0f), Application.GetAssetLoader());
+
+    const std::shared_ptr<OctaneGUI::Texture> Texture = Icons.GetTexture();
+    VERIFYF(!Texture->IsValid(), "Icons should still be rasterizing.");
+    VERIFYF(Texture->GetSize() == OctaneGUI::Vector2(16.0f, 16.0f * (float)OctaneGUI::Icons::Type::Max), "Placeholder does not have the final size.");
+
+    Application.GetAssetLoader().Wait();
+    return Texture->IsValid() && Icons.GetTexture() == Texture;
+})
+
+)
+
+}
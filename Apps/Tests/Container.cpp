@@ -29,6 +29,7 @@ SOFTWARE.
 #include "Utility.h"
 
 #include <cmath>
+#include <sstream>
 
 namespace Tests
 {
@@ -38,6 +39,39 @@ static void Load(OctaneGUI::Application& Application, const char* JsonControls,
     Utility::Load(Application, JsonControls, List);
 }
 
+static std::string Subtrees()
+{
+    std::stringstream Stream;
+    for (int Column = 0; Column < 3; Column++)
+    {
+        Stream << (Column > 0 ? "," : "") << R"({"Type": "Text", "Text": "Header"}, {"Type": "VerticalContainer", "ID": "Column)" << Column << R"(", "Controls": [)";
+        for (int Row = 0; Row < 12; Row++)
+        {
+            Stream << (Row > 0 ? "," : "") << R"({"Type": "HorizontalContainer", "Controls": [{"Type": "Text", "Text": "Row"}, {"Type": "TextButton", "Text": {"Text": "Button"}}]})";
+        }
+        Stream << "]}";
+    }
+    return Stream.str();
+}
+
+static bool PaintSubtrees(OctaneGUI::Application& Application, bool Compact)
+{
+    OctaneGUI::ThreadPool Pool;
+    Pool.SetThreads(2);
+
+    const std::shared_ptr<OctaneGUI::Container> Root = Application.GetMainWindow()->GetRootContainer();
+    OctaneGUI::Paint Serial(Application.GetTheme());
+    Serial.SetCompact(Compact);
+    Root->OnPaint(Serial);
+
+    OctaneGUI::Paint Parallel(Application.GetTheme());
+    Parallel.SetCompact(Compact);
+    Parallel.SetThreadPool(&Pool, 16);
+    Root->OnPaint(Parallel);
+
+    return Serial.GetBuffer().GetVertexCount() > 0 && Utility::SameBuffers(Serial.GetBuffer(), Parallel.GetBuffer());
+}
+
 TEST_SUITE(Container,
 
 TEST_CASE(ExpandWidth,
@@ -374,6 +408,124 @@ TEST_CASE(ThemePropertyUpdate,
     return Text->FontSize() == 6.0f && Text->FontSize() != Text->GetTheme()->GetFont()->Size();
 })
 
+TEST_CASE(PatchUnchanged,
+{
+    const OctaneGUI::Json Previous = OctaneGUI::Json::Parse(R"({"Controls": [
+        {"ID": "Text", "Type": "Text", "Text": "Hello"},
+        {"Type": "TextButton", "Text": {"Text": "Button"}}]})");
+    const std::shared_ptr<OctaneGUI::Container> Body = Application.GetMainWindow()->GetContainer();
+    Body->OnLoad(Previous);
+
+    const std::vector<std::shared_ptr<OctaneGUI::Control>> Controls = Body->Controls();
+    VERIFY(Body->Patch(Previous, Previous));
+    return Body->Controls() == Controls;
+})
+
+TEST_CASE(PatchChangedControl,
+{
+    const OctaneGUI::Json Previous = OctaneGUI::Json::Parse(R"({"Controls": [
+        {"ID": "Text", "Type": "Text", "Text": "Hello"},
+        {"ID": "Button", "Type": "TextButton", "Text": {"Text": "Button"}}]})");
+    const OctaneGUI::Json Next = OctaneGUI::Json::Parse(R"({"Controls": [
+        {"ID": "Text", "Type": "Text", "Text": "World"},
+        {"ID": "Button", "Type": "TextButton", "Text": {"Text": "Button"}}]})");
+    const std::shared_ptr<OctaneGUI::Container> Body = Application.GetMainWindow()->GetContainer();
+    Body->OnLoad(Previous);
+
+    const std::vector<std::shared_ptr<OctaneGUI::Control>> Controls = Body->Controls();
+    VERIFY(Body->Patch(Previous, Next));
+    VERIFY(Body->NumControls() == 2);
+    VERIFYF(Body->Get(0) != Controls[0], "Changed control was not recreated.");
+    VERIFYF(Body->Get(1) == Controls[1], "Unchanged control was recreated.");
+    return std::u32string(std::static_pointer_cast<OctaneGUI::Text>(Body->Get(0))->GetText()) == U"World";
+})
+
+TEST_CASE(PatchInsertRemoveMove,
+{
+    const OctaneGUI::Json Previous = OctaneGUI::Json::Parse(R"({"Controls": [
+        {"ID": "One", "Type": "Text", "Text": "One"},
+        {"ID": "Two", "Type": "Text", "Text": "Two"},
+        {"ID": "Three", "Type": "Text", "Text": "Three"}]})");
+    const OctaneGUI::Json Next = OctaneGUI::Json::Parse(R"({"Controls": [
+        {"ID": "Three", "Type": "Text", "Text": "Three"},
+        {"ID": "Four", "Type": "Text", "Text": "Four"},
+        {"ID": "One", "Type": "Text", "Text": "One"}]})");
+    const std::shared_ptr<OctaneGUI::Container> Body = Application.GetMainWindow()->GetContainer();
+    Body->OnLoad(Previous);
+
+    const std::vector<std::shared_ptr<OctaneGUI::Control>> Controls = Body->Controls();
+    VERIFY(Body->Patch(Previous, Next));
+    VERIFY(Body->NumControls() == 3);
+    VERIFYF(Body->Get(0) == Controls[2] && Body->Get(2) == Controls[0], "Controls were not moved.");
+    VERIFYF(std::string(Body->Get(1)->GetID()) == "Four", "Control was not inserted.");
+    return !Body->HasControl(Controls[1]);
+})
+
+TEST_CASE(PatchNested,
+{
+    const OctaneGUI::Json Previous = OctaneGUI::Json::Parse(R"({"Controls": [
+        {"ID": "Box", "Type": "VerticalContainer", "Controls": [
+            {"ID": "One", "Type": "Text", "Text": "One"},
+            {"ID": "Two", "Type": "Text", "Text": "Two"}]}]})");
+    const OctaneGUI::Json Next = OctaneGUI::Json::Parse(R"({"Controls": [
+        {"ID": "Box", "Type": "VerticalContainer", "Controls": [
+            {"ID": "One", "Type": "Text", "Text": "One"},
+            {"ID": "Two", "Type": "Text", "Text": "Changed"}]}]})");
+    const std::shared_ptr<OctaneGUI::Container> Body = Application.GetMainWindow()->GetContainer();
+    Body->OnLoad(Previous);
+
+    const std::shared_ptr<OctaneGUI::Container> Box = std::static_pointer_cast<OctaneGUI::Container>(Body->Get(0));
+    const std::shared_ptr<OctaneGUI::Control> One = Box->Get(0);
+    const std::shared_ptr<OctaneGUI::Control> Two = Box->Get(1);
+    VERIFY(Body->Patch(Previous, Next));
+    VERIFYF(Body->Get(0) == Box && Box->Get(0) == One, "Unchanged controls were recreated.");
+    return Box->NumControls() == 2 && Box->Get(1) != Two;
+})
+
+TEST_CASE(PatchContainerProperties,
+{
+    const OctaneGUI::Json Previous = OctaneGUI::Json::Parse(R"({"Controls": [{"Type": "Text", "Text": "One"}]})");
+    const OctaneGUI::Json Next = OctaneGUI::Json::Parse(R"({"Clip": true, "Controls": [{"Type": "Text", "Text": "One"}]})");
+    const std::shared_ptr<OctaneGUI::Container> Body = Application.GetMainWindow()->GetContainer();
+    Body->OnLoad(Previous);
+    return !Body->Patch(Previous, Next);
+})
+
+TEST_CASE(PatchGroupBox,
+{
+    // The described controls happen to match the GroupBox's own label and margins. The
+    // GroupBox must be recreated instead of patching its internal controls.
+    const OctaneGUI::Json Previous = OctaneGUI::Json::Parse(R"({"Controls": [{"Type": "GroupBox", "Text": "Group", "Controls": [
+        {"Type": "Text", "Text": "One"}, {"Type": "MarginContainer"}]}]})");
+    const OctaneGUI::Json Next = OctaneGUI::Json::Parse(R"({"Controls": [{"Type": "GroupBox", "Text": "Group", "Controls": [
+        {"Type": "Text", "Text": "Two"}, {"Type": "MarginContainer"}]}]})");
+    const std::shared_ptr<OctaneGUI::Container> Body = Application.GetMainWindow()->GetContainer();
+    Body->OnLoad(Previous);
+
+    const std::shared_ptr<OctaneGUI::Control> Group = Body->Get(0);
+    VERIFY(Body->Patch(Previous, Next));
+    VERIFYF(Body->Get(0) != Group, "GroupBox was patched instead of recreated.");
+    return std::u32string(std::static_pointer_cast<OctaneGUI::GroupBox>(Body->Get(0))->GetText()) == U"Group";
+})
+
+TEST_CASE(CountControls,
+{
+    OctaneGUI::ControlList List;
+    Load(Application, Subtrees().c_str(), List);
+    const std::shared_ptr<OctaneGUI::Container> Column = List.To<OctaneGUI::Container>("Column0");
+    VERIFYF(Column->CountControls() == 36, "Expected 36 controls but counted %zu.", Column->CountControls());
+    return Column->CountControls(10) == 10;
+})
+
+TEST_CASE(PaintSubtrees,
+{
+    OctaneGUI::ControlList List;
+    Load(Application, Subtrees().c_str(), List);
+    VERIFYF(PaintSubtrees(Application, false), "Subtrees painted in parallel differ from painting serially.");
+    VERIFYF(PaintSubtrees(Application, true), "Compact subtrees painted in parallel differ from painting serially.");
+    return true;
+})
+
 )
 
 }
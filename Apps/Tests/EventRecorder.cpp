@@ -0,0 +1,130 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <cstdio>
+#include <fstream>
+
+namespace Tests
+{
+
+static const char* RecordingPath = "EventRecorder_Test.bin";
+
+// Records a key press and mouse move in frame 1 and a mouse press for another window in frame 3.
+static bool WriteRecording()
+{
+    OctaneGUI::EventRecorder Recorder;
+    if (!Recorder.Open(RecordingPath))
+    {
+        return false;
+    }
+
+    Recorder.BeginFrame();
+    Recorder.Record("Main", OctaneGUI::Event(OctaneGUI::Event::Type::KeyPressed, OctaneGUI::Event::Key(OctaneGUI::Keyboard::Key::Escape)));
+    Recorder.Record("Main", OctaneGUI::Event(OctaneGUI::Event::MouseMove(12.5f, -4.0f)));
+    Recorder.BeginFrame();
+    Recorder.BeginFrame();
+    Recorder.Record("Other", OctaneGUI::Event(OctaneGUI::Event::Type::MousePressed, OctaneGUI::Event::MouseButton(OctaneGUI::Mouse::Button::Right, 3.0f, 4.0f, OctaneGUI::Mouse::Count::Double)));
+    Recorder.Close();
+
+    return Recorder.Count() == 3;
+}
+
+TEST_SUITE(EventRecorder,
+
+TEST_CASE(RoundTrip,
+{
+    VERIFY(WriteRecording());
+
+    OctaneGUI::EventPlayer Player;
+    const bool Loaded = Player.Load(RecordingPath);
+    std::remove(RecordingPath);
+    VERIFY(Loaded);
+    VERIFY(Player.Pending() == 3);
+
+    Player.SetSpeed(OctaneGUI::EventPlayer::Speed::Max).BeginFrame();
+
+    const OctaneGUI::Event Key = Player.Next("Main");
+    VERIFY(Key.GetType() == OctaneGUI::Event::Type::KeyPressed);
+    VERIFY(Key.GetData().m_Key.m_Code == OctaneGUI::Keyboard::Key::Escape);
+
+    const OctaneGUI::Event Move = Player.Next("Main");
+    VERIFY(Move.GetType() == OctaneGUI::Event::Type::MouseMoved);
+    VERIFY(Move.GetData().m_MouseMove.m_Position == OctaneGUI::Vector2(12.5f, -4.0f));
+
+    Player.BeginFrame();
+    const OctaneGUI::Event Press = Player.Next("Other");
+    VERIFY(Press.GetType() == OctaneGUI::Event::Type::MousePressed);
+    VERIFY(Press.GetData().m_MouseButton.m_Button == OctaneGUI::Mouse::Button::Right);
+    VERIFY(Press.GetData().m_MouseButton.m_Position == OctaneGUI::Vector2(3.0f, 4.0f));
+    VERIFY(Press.GetData().m_MouseButton.m_Count == OctaneGUI::Mouse::Count::Double);
+
+    return Player.IsFinished();
+})
+
+TEST_CASE(Frames,
+{
+    VERIFY(WriteRecording());
+
+    OctaneGUI::EventPlayer Player;
+    const bool Loaded = Player.Load(RecordingPath);
+    std::remove(RecordingPath);
+    VERIFY(Loaded);
+
+    // Events for a later frame are held back until that frame begins.
+    VERIFY(!Player.HasNext("Main"));
+    Player.SetSpeed(OctaneGUI::EventPlayer::Speed::Max).BeginFrame();
+    VERIFY(Player.HasNext("Main"));
+    VERIFY(!Player.HasNext("Other"));
+    Player.Next("Main");
+    Player.Next("Main");
+    VERIFY(!Player.HasNext("Main"));
+    VERIFY(Player.Next("Main").GetType() == OctaneGUI::Event::Type::None);
+
+    Player.BeginFrame();
+    return Player.HasNext("Other") && !Player.IsFinished();
+})
+
+TEST_CASE(InvalidFile,
+{
+    OctaneGUI::EventPlayer Player;
+    VERIFY(!Player.Load("EventRecorder_Missing.bin"));
+
+    {
+        std::ofstream Stream(RecordingPath, std::ios_base::out | std::ios_base::binary);
+        Stream << "Not a recording";
+    }
+
+    const bool Loaded = Player.Load(RecordingPath);
+    std::remove(RecordingPath);
+    return !Loaded && Player.IsFinished();
+})
+
+)
+
+}
@@ -0,0 +1,171 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace Tests
+{
+
+static std::filesystem::path WatchDirectory(const char* Name)
+{
+    const std::filesystem::path Result = std::filesystem::temp_directory_path() / "OctaneGUI.Tests" / Name;
+    std::filesystem::remove_all(Result);
+    std::filesystem::create_directories(Result);
+    return Result;
+}
+
+static void WriteFile(const std::filesystem::path& Location, const char* Contents)
+{
+    std::ofstream Stream { Location, std::ios::trunc };
+    Stream << Contents;
+}
+
+// Updates the application until the expected number of changes is received, then
+// for a few more frames to catch any unexpected changes.
+static void WaitForChanges(OctaneGUI::Application& Application, const std::vector<OctaneGUI::FileSystem::FileChange>& Changes, size_t Expected)
+{
+    OctaneGUI::Clock Clock;
+    while (Changes.size() < Expected && Clock.MeasureMS() < 5000)
+    {
+        Application.Update();
+    }
+
+    Clock.Reset();
+    while (Clock.MeasureMS() < 100)
+    {
+        Application.Update();
+    }
+}
+
+static bool HasChange(const std::vector<OctaneGUI::FileSystem::FileChange>& Changes, OctaneGUI::FileSystem::FileChange::Type Type, const std::filesystem::path& Location)
+{
+    for (const OctaneGUI::FileSystem::FileChange& Change : Changes)
+    {
+        if (Change.Change == Type && std::filesystem::path(Change.Location) == Location)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool WatchDirectoryChanges(OctaneGUI::Application& Application, bool Polling)
+{
+    typedef OctaneGUI::FileSystem::FileChange::Type Type;
+
+    const std::filesystem::path Directory = WatchDirectory(Polling ? "Polling" : "Notify");
+    WriteFile(Directory / "Modified.txt", "One");
+    WriteFile(Directory / "Removed.txt", "One");
+    std::filesystem::create_directories(Directory / "Sub");
+
+    OctaneGUI::FileSystem& FS = Application.FS();
+    FS.SetWatchPolling(Polling)
+        .SetWatchDebounce(20)
+        .SetWatchPollInterval(10);
+
+    std::vector<OctaneGUI::FileSystem::FileChange> Changes;
+    const uint32_t ID = FS.Watch(Directory.u32string(), true, [&](const std::vector<OctaneGUI::FileSystem::FileChange>& Items) -> void
+        {
+            Changes.insert(Changes.end(), Items.begin(), Items.end());
+        });
+
+    // Give the watcher thread time to add the directories or take its first snapshot.
+    WaitForChanges(Application, Changes, 0);
+
+    WriteFile(Directory / "Modified.txt", "Two, which is longer");
+    WriteFile(Directory / "Added.txt", "One");
+    WriteFile(Directory / "Sub" / "Nested.txt", "One");
+    std::filesystem::remove(Directory / "Removed.txt");
+    WaitForChanges(Application, Changes, 4);
+
+    FS.Unwatch(ID);
+    FS.SetWatchPolling(false);
+    std::filesystem::remove_all(Directory);
+
+    return HasChange(Changes, Type::Modified, Directory / "Modified.txt")
+        && HasChange(Changes, Type::Added, Directory / "Added.txt")
+        && HasChange(Changes, Type::Added, Directory / "Sub" / "Nested.txt")
+        && HasChange(Changes, Type::Removed, Directory / "Removed.txt")
+        && Changes.size() == 4;
+}
+
+TEST_SUITE(FileSystem,
+
+TEST_CASE(WatchNotify,
+{
+    return WatchDirectoryChanges(Application, false);
+})
+
+TEST_CASE(WatchPolling,
+{
+    return WatchDirectoryChanges(Application, true);
+})
+
+TEST_CASE(WatchFile,
+{
+    const std::filesystem::path Directory = WatchDirectory("File");
+    WriteFile(Directory / "Watched.txt", "One");
+
+    std::vector<OctaneGUI::FileSystem::FileChange> Changes;
+    OctaneGUI::FileSystem& FS = Application.FS();
+    FS.SetWatchDebounce(50);
+    const uint32_t ID = FS.Watch((Directory / "Watched.txt").u32string(), false, [&](const std::vector<OctaneGUI::FileSystem::FileChange>& Items) -> void
+        {
+            Changes.insert(Changes.end(), Items.begin(), Items.end());
+        });
+    VERIFYF(ID != 0, "Failed to watch file.");
+
+    // Give the watcher thread time to start watching.
+    WaitForChanges(Application, Changes, 0);
+
+    // Repeated writes are coalesced into a single change and other files are ignored.
+    for (int I = 0; I < 5; I++)
+    {
+        WriteFile(Directory / "Watched.txt", "Two");
+        WriteFile(Directory / "Other.txt", "Two");
+    }
+    WaitForChanges(Application, Changes, 1);
+
+    FS.Unwatch(ID);
+    std::filesystem::remove_all(Directory);
+
+    VERIFYF(Changes.size() == 1, "Expected 1 change but received %zu.", Changes.size());
+    return Changes[0].Change == OctaneGUI::FileSystem::FileChange::Type::Modified;
+})
+
+TEST_CASE(WatchInvalid,
+{
+    return Application.FS().Watch(U"Invalid/Path/To/Nothing", false, nullptr) == 0;
+})
+
+)
+
+}
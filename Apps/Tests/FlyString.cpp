@@ -27,9 +27,27 @@ SOFTWARE.
 #include "OctaneGUI/OctaneGUI.h"
 #include "TestSuite.h"
 
+#include <string>
+
 namespace Tests
 {
 
+static std::vector<const char*> Intern(OctaneGUI::ThreadPool& Pool)
+{
+    std::vector<const char*> Result(64, nullptr);
+    std::vector<OctaneGUI::OnEmptySignature> Tasks;
+    for (size_t I = 0; I < Result.size(); I++)
+    {
+        Tasks.push_back([&Result, I]() -> void
+            {
+                const std::string Value = "Threaded " + std::to_string(I % 8);
+                Result[I] = OctaneGUI::FlyString(Value.c_str()).Data();
+            });
+    }
+    Pool.Run(Tasks);
+    return Result;
+}
+
 TEST_SUITE(FlyString,
 
 TEST_CASE(SingleEntry,
@@ -48,6 +66,20 @@ TEST_CASE(SameLiteral,
     return Value1.Data() == Value2.Data();
 })
 
+TEST_CASE(Threads,
+{
+    OctaneGUI::ThreadPool Pool;
+    Pool.SetThreads(3);
+
+    const std::vector<const char*> Values = Intern(Pool);
+    for (size_t I = 0; I < Values.size(); I++)
+    {
+        VERIFYF(Values[I] == Values[I % 8], "String %zu was interned more than once.", I);
+    }
+
+    return OctaneGUI::FlyString("Threaded 0").Data() == Values[0];
+})
+
 )
 
 }
@@ -0,0 +1,174 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "OctaneGUI/Texture.h"
+#include "TestSuite.h"
+#include "Utility.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Tests
+{
+
+static const char* CapturePath = "FrameCapture_Test.ogfc";
+
+static std::vector<uint8_t> ImagePixels()
+{
+    return { 255, 0, 0, 255, 0, 255, 0, 255, 0, 0, 255, 255, 255, 255, 255, 255 };
+}
+
+static bool Save(const OctaneGUI::VertexBuffer& Buffer)
+{
+    return OctaneGUI::FrameCapture::Save(CapturePath, "Main", 0, { 100.0f, 100.0f }, { 1.0f, 1.0f }, Buffer);
+}
+
+static bool RoundTrip(OctaneGUI::Application& Application, bool Compact)
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.SetCompact(Compact);
+    Brush.PushClip(OctaneGUI::Rect(0.0f, 0.0f, 80.0f, 200.0f));
+    Brush.Rectangle(OctaneGUI::Rect(0.0f, 0.0f, 100.0f, 20.0f), OctaneGUI::Color::White);
+    Brush.Circle(OctaneGUI::Vector2(50.0f, 50.0f), 10.0f, OctaneGUI::Color::Black);
+    Brush.Text(Application.GetTheme()->GetFont(), OctaneGUI::Vector2(5.0f, 80.0f), U"Captured", OctaneGUI::Color::White);
+
+    if (!OctaneGUI::FrameCapture::Save(CapturePath, "Main", 7, { 1280.0f, 720.0f }, { 2.0f, 2.0f }, Brush.GetBuffer()))
+    {
+        return false;
+    }
+
+    OctaneGUI::FrameCapture::Frame Loaded;
+    const bool Result = OctaneGUI::FrameCapture::Load(CapturePath, Loaded);
+    std::remove(CapturePath);
+
+    return Result
+        && Loaded.WindowID == "Main"
+        && Loaded.Number == 7
+        && Loaded.Size == OctaneGUI::Vector2(1280.0f, 720.0f)
+        && Loaded.RenderScale == OctaneGUI::Vector2(2.0f, 2.0f)
+        && Loaded.Buffer.IsCompact() == Compact
+        && Utility::SameBuffers(Brush.GetBuffer(), Loaded.Buffer);
+}
+
+// Saves a rectangle and overwrites the 32-bit value that is FromEnd bytes before the end of
+// the file. Without textures, the draw commands are at the end of the file and the indices
+// are right before them.
+static bool LoadCorrupted(OctaneGUI::Application& Application, size_t FromEnd, uint32_t Value)
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.Rectangle(OctaneGUI::Rect(0.0f, 0.0f, 100.0f, 20.0f), OctaneGUI::Color::White);
+    if (!Save(Brush.GetBuffer()))
+    {
+        return false;
+    }
+
+    std::vector<char> Contents;
+    {
+        std::ifstream Stream { CapturePath, std::ios_base::binary };
+        Contents.assign(std::istreambuf_iterator<char>(Stream), std::istreambuf_iterator<char>());
+    }
+    std::memcpy(Contents.data() + Contents.size() - FromEnd, &Value, sizeof(Value));
+    {
+        std::ofstream Stream { CapturePath, std::ios_base::binary | std::ios_base::trunc };
+        Stream.write(Contents.data(), Contents.size());
+    }
+
+    OctaneGUI::FrameCapture::Frame Loaded;
+    const bool Result = OctaneGUI::FrameCapture::Load(CapturePath, Loaded);
+    std::remove(CapturePath);
+    return Result;
+}
+
+// Layout of a saved draw command.
+static constexpr size_t CommandSize = sizeof(uint32_t) * 4 + sizeof(float) * 4;
+
+TEST_SUITE(FrameCapture,
+
+TEST_CASE(RoundTrip,
+{
+    return RoundTrip(Application, false);
+})
+
+TEST_CASE(RoundTripCompact,
+{
+    return RoundTrip(Application, true);
+})
+
+TEST_CASE(Textures,
+{
+    OctaneGUI::FrameCapture::SetTrackTextures(true);
+    const std::vector<uint8_t> Pixels = ImagePixels();
+    const std::shared_ptr<OctaneGUI::Texture> Image = OctaneGUI::Texture::Load(Pixels, 2, 2);
+    VERIFY(Image != nullptr);
+
+    // The font's texture was uploaded before tracking started, so only the image is saved.
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.Image(OctaneGUI::Rect(0.0f, 0.0f, 16.0f, 16.0f), OctaneGUI::Rect(0.0f, 0.0f, 1.0f, 1.0f), Image, OctaneGUI::Color::White);
+    Brush.Text(Application.GetTheme()->GetFont(), OctaneGUI::Vector2(5.0f, 20.0f), U"Text", OctaneGUI::Color::White);
+    const bool Saved = Save(Brush.GetBuffer());
+    OctaneGUI::FrameCapture::SetTrackTextures(false);
+    VERIFY(Saved);
+
+    OctaneGUI::FrameCapture::Frame Loaded;
+    const bool Result = OctaneGUI::FrameCapture::Load(CapturePath, Loaded);
+    std::remove(CapturePath);
+    VERIFY(Result);
+    VERIFY(Loaded.Textures.size() == 1);
+
+    const OctaneGUI::FrameCapture::TextureData& Item = Loaded.Textures[0];
+    return Item.ID == Image->GetID() && Item.Width == 2 && Item.Height == 2 && Item.Pixels == Pixels;
+})
+
+TEST_CASE(InvalidFile,
+{
+    OctaneGUI::FrameCapture::Frame Loaded;
+    return !OctaneGUI::FrameCapture::Load("FrameCapture_Missing.ogfc", Loaded);
+})
+
+TEST_CASE(OutOfRange,
+{
+    // A different clip rectangle can still be replayed, unlike offsets, counts and indices.
+    VERIFYF(LoadCorrupted(Application, sizeof(float), 0), "Capture with a changed clip should still load.");
+    VERIFYF(!LoadCorrupted(Application, CommandSize, 1000000), "Vertex offset past the vertices was accepted.");
+    VERIFYF(!LoadCorrupted(Application, CommandSize - sizeof(uint32_t), 1000000), "Index offset past the indices was accepted.");
+    VERIFYF(!LoadCorrupted(Application, CommandSize - sizeof(uint32_t) * 2, 1000000), "Index count past the indices was accepted.");
+    VERIFYF(!LoadCorrupted(Application, CommandSize + sizeof(uint32_t), 1000000), "Index past the vertices was accepted.");
+    return true;
+})
+
+TEST_CASE(StartAfterUpload,
+{
+    // The test application has already uploaded its font textures.
+    VERIFY(OctaneGUI::FrameCapture::HasUntrackedTextures());
+    return !Application.StartCapture("FrameCapture_Test") && !Application.IsCapturing();
+})
+
+)
+
+}
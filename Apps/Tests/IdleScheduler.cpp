@@ -0,0 +1,141 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <string>
+#include <thread>
+
+namespace Tests
+{
+
+// A task that records its name for each step and finishes after the given number of steps.
+static OctaneGUI::IdleScheduler::OnStepSignature Steps(std::string& Log, char Name, int Count)
+{
+    std::shared_ptr<int> Remaining = std::make_shared<int>(Count);
+    return [&Log, Name, Remaining]() -> bool
+    {
+        Log.push_back(Name);
+        return --(*Remaining) <= 0;
+    };
+}
+
+TEST_SUITE(IdleScheduler,
+
+TEST_CASE(Steps,
+{
+    OctaneGUI::IdleScheduler Scheduler;
+    std::string Log;
+    const OctaneGUI::IdleScheduler::TaskID ID = Scheduler.Add(Steps(Log, 'A', 5));
+
+    VERIFY(Scheduler.IsPending(ID));
+    VERIFY(Scheduler.Run(std::chrono::seconds(5)) == 5);
+    return Log == "AAAAA" && !Scheduler.IsPending(ID) && Scheduler.Pending() == 0;
+})
+
+TEST_CASE(Priority,
+{
+    OctaneGUI::IdleScheduler Scheduler;
+    std::string Log;
+    Scheduler.Add(Steps(Log, 'L', 2), OctaneGUI::IdleScheduler::Priority::Low);
+    Scheduler.Add(Steps(Log, 'N', 2));
+    Scheduler.Add(Steps(Log, 'M', 2));
+    Scheduler.Add(Steps(Log, 'H', 1), OctaneGUI::IdleScheduler::Priority::High);
+
+    // Tasks with the same priority take turns.
+    Scheduler.Run(std::chrono::seconds(5));
+    return Log == "HNMNMLL";
+})
+
+TEST_CASE(Budget,
+{
+    OctaneGUI::IdleScheduler Scheduler;
+    int Count = 0;
+    Scheduler.Add([&Count]() -> bool
+        {
+            Count++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            return Count == 3;
+        });
+
+    VERIFY(Scheduler.Run(std::chrono::milliseconds(1)) == 1);
+    VERIFY(Scheduler.Run(std::chrono::milliseconds(1)) == 1);
+    VERIFY(Scheduler.Run(std::chrono::milliseconds(1)) == 1);
+    return Count == 3 && Scheduler.Pending() == 0;
+})
+
+TEST_CASE(Cancel,
+{
+    OctaneGUI::IdleScheduler Scheduler;
+    std::string Log;
+    const OctaneGUI::IdleScheduler::TaskID A = Scheduler.Add(Steps(Log, 'A', 3));
+    OctaneGUI::IdleScheduler::TaskID B = OctaneGUI::IdleScheduler::InvalidID;
+    B = Scheduler.Add([&Scheduler, &Log, &B]() -> bool
+        {
+            Log.push_back('B');
+            Scheduler.Cancel(B);
+            return false;
+        });
+
+    VERIFY(Scheduler.Cancel(A));
+    VERIFY(!Scheduler.Cancel(A));
+    Scheduler.Run(std::chrono::seconds(5));
+    return Log == "B" && Scheduler.Pending() == 0;
+})
+
+TEST_CASE(Application,
+{
+    const std::chrono::microseconds Budget = Application.IdleBudget();
+    Application.SetIdleBudget(std::chrono::microseconds(0));
+
+    std::string Log;
+    const OctaneGUI::IdleScheduler::TaskID ID = Application.AddIdleTask(Steps(Log, 'A', 3));
+    Application.Update();
+    VERIFYF(Log == "A", "Expected a single step per frame but got '%s'.", Log.c_str());
+    Application.Update();
+    Application.Update();
+
+    Application.SetIdleBudget(Budget);
+    return Log == "AAA" && !Application.GetIdleScheduler().IsPending(ID);
+})
+
+TEST_CASE(WindowClosed,
+{
+    Application.NewWindow("Idle", R"({"Width": 200, "Height": 200})");
+    Application.DisplayWindow("Idle");
+
+    std::string Log;
+    const OctaneGUI::IdleScheduler::TaskID ID = Application.GetWindow("Idle")->AddIdleTask(Steps(Log, 'A', 100));
+    Application.CloseWindow("Idle");
+    Application.Update();
+
+    return Log.empty() && !Application.GetIdleScheduler().IsPending(ID);
+})
+
+)
+
+}
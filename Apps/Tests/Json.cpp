@@ -30,6 +30,21 @@ SOFTWARE.
 namespace Tests
 {
 
+// A binary stream of arrays that each hold the next array.
+static std::string NestedBinary(size_t Depth)
+{
+    const char Header[] { 'O', 'G', 'J', 'B', 2, 0, 0, 0, 0, 0, 0, 0 };
+    const char Array[] { (char)OctaneGUI::Json::Type::Array, 1, 0, 0, 0 };
+
+    std::string Result(Header, sizeof(Header));
+    for (size_t I = 0; I < Depth; I++)
+    {
+        Result.append(Array, sizeof(Array));
+    }
+    Result.push_back((char)OctaneGUI::Json::Type::Null);
+    return Result;
+}
+
 TEST_SUITE(Json,
 
 TEST_CASE(IsNull,
@@ -279,6 +294,17 @@ TEST_CASE(InvalidNumber,
     return IsError;
 })
 
+TEST_CASE(MaxDepth,
+{
+    bool IsError = false;
+    OctaneGUI::Json Root = OctaneGUI::Json::Parse((std::string(256, '[') + std::string(256, ']')).c_str(), IsError);
+    VERIFYF(!IsError, "Failed to parse nested arrays: %s", Root["Error"].String());
+
+    // A stream this deep would overflow the stack if it were parsed recursively.
+    Root = OctaneGUI::Json::Parse(std::string(100000, '[').c_str(), IsError);
+    return IsError && std::string(Root["Error"].String()).find("nesting depth") != std::string::npos;
+})
+
 TEST_CASE(InvalidMultiline,
 {
     bool IsError = false;
@@ -299,6 +325,155 @@ TEST_CASE(ValidEmptyString,
     return !IsError;
 })
 
+TEST_CASE(EscapedQuote,
+{
+    OctaneGUI::Json Root = OctaneGUI::Json::Parse(R"({"Text": "Say \"Hello\""})");
+    return std::string(Root["Text"].String()) == "Say \"Hello\"";
+})
+
+TEST_CASE(UnicodeEscape,
+{
+    bool IsError = false;
+    OctaneGUI::Json Root = OctaneGUI::Json::Parse(R"(["\u0041", "\u00e9", "\u4E2D", "\ud83d\ude00", "\ud83d"])", IsError);
+    VERIFY(!IsError && Root.Count() == 5);
+    VERIFYF(std::string(Root[0u].String()) == "A", "Invalid ASCII escape: %s", Root[0u].String());
+    VERIFYF(std::string(Root[1u].String()) == "\xC3\xA9", "Invalid 2-byte escape: %s", Root[1u].String());
+    VERIFYF(std::string(Root[2u].String()) == "\xE4\xB8\xAD", "Invalid 3-byte escape: %s", Root[2u].String());
+    VERIFYF(std::string(Root[3u].String()) == "\xF0\x9F\x98\x80", "Invalid surrogate pair: %s", Root[3u].String());
+    return std::string(Root[4u].String()) == "\xEF\xBF\xBD";
+})
+
+TEST_CASE(InvalidUnicodeEscape,
+{
+    bool IsError = false;
+    OctaneGUI::Json Root = OctaneGUI::Json::Parse(R"({"Text": "\u00G1"})", IsError);
+    return IsError;
+})
+
+TEST_CASE(DuplicateKey,
+{
+    OctaneGUI::Json Root = OctaneGUI::Json::Parse(R"({"Key": 1, "Other": 2, "Key": 3})");
+    return Root.Count() == 2 && Root["Key"].Number() == 3.0f;
+})
+
+TEST_CASE(InsertionOrder,
+{
+    OctaneGUI::Json Root = OctaneGUI::Json::Parse(R"({"Zebra": 1, "Apple": 2, "Mango": 3})");
+    std::string Keys;
+    Root.ForEach([&](const std::string& Key, const OctaneGUI::Json&) -> void
+        {
+            Keys += Key;
+        });
+    return Keys == "ZebraAppleMango";
+})
+
+TEST_CASE(LargeObject,
+{
+    OctaneGUI::Json Root { OctaneGUI::Json::Type::Object };
+    for (int I = 0; I < 1000; I++)
+    {
+        Root[std::to_string(I)] = (float)I;
+    }
+
+    VERIFY(Root.Count() == 1000);
+    for (int I = 0; I < 1000; I++)
+    {
+        VERIFYF(Root[std::to_string(I)].Number() == (float)I, "Failed to find key %d.", I);
+    }
+
+    VERIFY(Root.Erase("500") && !Root.Contains("500") && Root.Contains("501"));
+    return Root.Count() == 999 && !Root.Contains("1000");
+})
+
+TEST_CASE(RoundTrip,
+{
+    OctaneGUI::Json Root { OctaneGUI::Json::Type::Object };
+    Root["Path"] = "C:\\Users\\\"Name\"";
+    Root["Lines"] = "One\nTwo\tThree";
+
+    bool IsError = false;
+    OctaneGUI::Json Parsed = OctaneGUI::Json::Parse(Root.ToString().c_str(), IsError);
+    return !IsError && Parsed == Root;
+})
+
+TEST_CASE(BinaryRoundTrip,
+{
+    const OctaneGUI::Json Root = OctaneGUI::Json::Parse(R"({
+        "Name": "Window", "Width": 1280.5, "Visible": true, "Tooltip": null,
+        "Controls": [{"Type": "Text", "Text": "Hello\n\u00e9"}, {"Type": "Text", "Text": "World"}],
+        "Empty": {}, "List": []})");
+
+    const std::string Binary = Root.ToBinary();
+    VERIFY(OctaneGUI::Json::IsBinary(Binary.data(), Binary.size()));
+
+    bool IsError = false;
+    const OctaneGUI::Json Loaded = OctaneGUI::Json::FromBinary(Binary.data(), Binary.size(), IsError);
+    VERIFYF(!IsError, "Failed to load binary stream: %s", Loaded["Error"].String());
+    return Loaded == Root && Loaded["Controls"][1]["Text"].String() == std::string("World");
+})
+
+TEST_CASE(BinarySharedStrings,
+{
+    OctaneGUI::Json Root { OctaneGUI::Json::Type::Array };
+    for (int I = 0; I < 100; I++)
+    {
+        OctaneGUI::Json Item { OctaneGUI::Json::Type::Object };
+        Item["Type"] = "VerticalContainer";
+        Root.Push(std::move(Item));
+    }
+
+    // Each repeated key and value should only be stored once.
+    const std::string Binary = Root.ToBinary();
+    return Binary.size() < 100 * 14 + 64;
+})
+
+TEST_CASE(DoublePrecision,
+{
+    // 2^40 + 1 can not be represented by a float.
+    const double Large = 1099511627777.0;
+    OctaneGUI::Json Root { OctaneGUI::Json::Type::Object };
+    Root["Large"] = Large;
+    VERIFY(Root["Large"].Double() == Large);
+
+    const OctaneGUI::Json Parsed = OctaneGUI::Json::Parse(Root.ToString().c_str());
+    VERIFYF(Parsed["Large"].Double() == Large, "Parsed value %f does not match.", Parsed["Large"].Double());
+
+    const std::string Binary = Root.ToBinary();
+    bool IsError = false;
+    const OctaneGUI::Json Loaded = OctaneGUI::Json::FromBinary(Binary.data(), Binary.size(), IsError);
+    return !IsError && Loaded["Large"].Double() == Large;
+})
+
+TEST_CASE(BinaryMaxDepth,
+{
+    bool IsError = false;
+    std::string Binary = NestedBinary(256);
+    OctaneGUI::Json Loaded = OctaneGUI::Json::FromBinary(Binary.data(), Binary.size(), IsError);
+    VERIFYF(!IsError, "Failed to load nested arrays: %s", Loaded["Error"].String());
+
+    Binary = NestedBinary(100000);
+    Loaded = OctaneGUI::Json::FromBinary(Binary.data(), Binary.size(), IsError);
+    return IsError && std::string(Loaded["Error"].String()).find("nesting depth") != std::string::npos;
+})
+
+TEST_CASE(BinaryInvalid,
+{
+    const std::string Binary = OctaneGUI::Json::Parse(R"({"Controls": [{"Type": "Text"}]})").ToBinary();
+
+    bool IsError = false;
+    OctaneGUI::Json Loaded = OctaneGUI::Json::FromBinary(Binary.data(), Binary.size() - 1, IsError);
+    VERIFYF(IsError, "Truncated stream was loaded.");
+
+    const std::string Text = "{\"Controls\": []}";
+    Loaded = OctaneGUI::Json::FromBinary(Text.data(), Text.size(), IsError);
+    VERIFYF(IsError, "Text stream was loaded as binary.");
+
+    std::string Corrupt = Binary;
+    Corrupt[Corrupt.size() - 5] = 0x7F;
+    Loaded = OctaneGUI::Json::FromBinary(Corrupt.data(), Corrupt.size(), IsError);
+    return IsError && !Loaded["Error"].IsNull();
+})
+
 )
 
 }
@@ -0,0 +1,208 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+#include "Utility.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Tests
+{
+
+static std::shared_ptr<OctaneGUI::LogView> Load(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "LogView", "ID": "Log", "Expand": "Both"})", List);
+    return List.To<OctaneGUI::LogView>("Log");
+}
+
+static std::string Lines(size_t Start, size_t Count)
+{
+    std::string Result;
+    for (size_t I = Start; I < Start + Count; I++)
+    {
+        Result += "Line " + std::to_string(I) + "\n";
+    }
+    return Result;
+}
+
+static void AppendFromThreads(const std::shared_ptr<OctaneGUI::LogView>& Log, size_t Count)
+{
+    std::vector<std::thread> Threads;
+    for (size_t Thread = 0; Thread < Count; Thread++)
+    {
+        Threads.emplace_back([Log, Thread]() -> void
+            {
+                for (size_t Batch = 0; Batch < 100; Batch++)
+                {
+                    Log->AppendAsync(Lines(Thread * 100000 + Batch * 100, 100));
+                }
+            });
+    }
+
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+}
+
+static bool InThreadOrder(const OctaneGUI::LogView& Log, size_t Count)
+{
+    std::vector<size_t> Next(Count, 0);
+    for (size_t I = 0; I < Log.Count(); I++)
+    {
+        const size_t Value = std::stoul(std::string(Log.Line(I).substr(5)));
+        const size_t Thread = Value / 100000;
+        if (Thread >= Count || Value % 100000 != Next[Thread])
+        {
+            return false;
+        }
+        Next[Thread]++;
+    }
+    return true;
+}
+
+TEST_SUITE(LogBuffer,
+
+TEST_CASE(Split,
+{
+    OctaneGUI::LogBuffer Buffer;
+    VERIFY(Buffer.Append("One\r\nTwo\n\nThree") == 4);
+    VERIFY(Buffer.Append("Four\n") == 1);
+    VERIFY(Buffer.Append("") == 0);
+    return Buffer.Count() == 5
+        && Buffer.Line(0) == "One"
+        && Buffer.Line(1) == "Two"
+        && Buffer.Line(2).empty()
+        && Buffer.Line(3) == "Three"
+        && Buffer.Line(4) == "Four"
+        && Buffer.Line(5).empty();
+})
+
+TEST_CASE(Capacity,
+{
+    OctaneGUI::LogBuffer Buffer;
+    Buffer.SetCapacity(1000);
+    for (size_t I = 0; I < 100; I++)
+    {
+        Buffer.Append(Lines(I * 1000, 1000));
+    }
+
+    VERIFY(Buffer.Count() == 1000);
+    VERIFY(Buffer.Dropped() == 99000);
+    VERIFY(Buffer.Line(0) == "Line 99000");
+    VERIFY(Buffer.Line(999) == "Line 99999");
+
+    // Chunks that no longer hold lines are recycled, so memory follows the cap.
+    VERIFYF(Buffer.Bytes() <= 3 * OctaneGUI::LogBuffer::ChunkSize, "Buffer holds %zu bytes.", Buffer.Bytes());
+
+    Buffer.Clear();
+    return Buffer.Count() == 0 && Buffer.Dropped() == 0 && Buffer.LongestLength() == 0;
+})
+
+TEST_CASE(LongLine,
+{
+    OctaneGUI::LogBuffer Buffer;
+    const std::string Long(OctaneGUI::LogBuffer::ChunkSize * 2, 'x');
+    Buffer.AppendLine("Before");
+    Buffer.AppendLine(Long);
+    Buffer.AppendLine("After");
+    return Buffer.Line(0) == "Before" && Buffer.Line(1) == Long && Buffer.Line(2) == "After" && Buffer.LongestLength() == Long.size();
+})
+
+)
+
+TEST_SUITE(LogView,
+
+TEST_CASE(StickyBottom,
+{
+    const std::shared_ptr<OctaneGUI::LogView> Log = Load(Application);
+    Log->Append(Lines(0, 1000));
+    VERIFY(Log->Count() == 1000);
+    VERIFY(Log->IsAtBottom());
+    VERIFY(Log->FirstVisibleLine() + Log->NumVisibleLines() == 1000);
+    VERIFY(Log->FirstVisibleLine() > 0);
+
+    Log->Append(Lines(1000, 1000));
+    VERIFY(Log->IsAtBottom());
+    VERIFY(Log->FirstVisibleLine() + Log->NumVisibleLines() == 2000);
+
+    // Once scrolled away from the bottom, appending leaves the view where it is.
+    Log->Scrollable()->SetOffset({ 0.0f, 0.0f });
+    Log->Append(Lines(2000, 10));
+    return !Log->IsAtBottom() && Log->FirstVisibleLine() == 0;
+})
+
+TEST_CASE(DroppedLinesKeepView,
+{
+    const std::shared_ptr<OctaneGUI::LogView> Log = Load(Application);
+    Log->SetCapacity(500);
+    Log->Append(Lines(0, 500));
+    Log->Scrollable()->SetOffset({ 0.0f, Log->LineHeight() * 200.0f });
+    VERIFY(Log->Line(Log->FirstVisibleLine()) == "Line 200");
+
+    Log->Append(Lines(500, 50));
+    VERIFY(Log->Count() == 500);
+    return Log->Line(Log->FirstVisibleLine()) == "Line 200";
+})
+
+TEST_CASE(AppendAsync,
+{
+    const std::shared_ptr<OctaneGUI::LogView> Log = Load(Application);
+    Log->SetCapacity(0);
+
+    AppendFromThreads(Log, 4);
+
+    // The first batch posted a flush to the UI thread.
+    Application.Update();
+    VERIFYF(Log->Count() == 40000, "Appended %zu lines.", Log->Count());
+
+    // Each thread's lines arrive in the order they were appended.
+    VERIFY(InThreadOrder(*Log, 4));
+
+    return true;
+})
+
+TEST_CASE(PaintsVisibleLines,
+{
+    const std::shared_ptr<OctaneGUI::LogView> Log = Load(Application);
+    Log->Append(Lines(0, 1000));
+    const uint32_t Few = Utility::PaintedVertices(Application);
+
+    Log->Append(Lines(1000, 49000));
+    const uint32_t Many = Utility::PaintedVertices(Application);
+
+    // Both fill the view, so the amount of geometry stays about the same.
+    VERIFYF(Many < Few + Few / 4, "Painted %u vertices for 1000 lines and %u for 50000 lines.", Few, Many);
+    return true;
+})
+
+)
+
+}
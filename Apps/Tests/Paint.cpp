@@ -0,0 +1,226 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <cmath>
+
+namespace Tests
+{
+
+static const float Pi = 3.14159265358979323846f;
+
+// Sums the area of every triangle in the buffer.
+static float Area(const OctaneGUI::VertexBuffer& Buffer)
+{
+    float Result = 0.0f;
+    for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
+    {
+        for (uint32_t I = 0; I + 2 < Command.IndexCount(); I += 3)
+        {
+            const OctaneGUI::Vector2 A = Buffer.GetVertices()[Command.VertexOffset() + Buffer.GetIndices()[Command.IndexOffset() + I]].Position;
+            const OctaneGUI::Vector2 B = Buffer.GetVertices()[Command.VertexOffset() + Buffer.GetIndices()[Command.IndexOffset() + I + 1]].Position;
+            const OctaneGUI::Vector2 C = Buffer.GetVertices()[Command.VertexOffset() + Buffer.GetIndices()[Command.IndexOffset() + I + 2]].Position;
+            Result += std::abs((B.X - A.X) * (C.Y - A.Y) - (C.X - A.X) * (B.Y - A.Y)) * 0.5f;
+        }
+    }
+
+    return Result;
+}
+
+// Verifies that every vertex other than the first, which is the center, is on the circle.
+static bool OnCircle(const OctaneGUI::VertexBuffer& Buffer, const OctaneGUI::Vector2& Center, float Radius)
+{
+    for (size_t I = 1; I < Buffer.GetVertices().size(); I++)
+    {
+        const float Distance = (Buffer.GetVertices()[I].Position - Center).Length();
+        if (std::abs(Distance - Radius) > 1.0f)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Points along a horizontal line, one unit apart.
+static std::vector<OctaneGUI::Vector2> HorizontalPoints(size_t Count)
+{
+    std::vector<OctaneGUI::Vector2> Result;
+    for (size_t I = 0; I < Count; I++)
+    {
+        Result.push_back({ (float)I, 10.0f });
+    }
+    return Result;
+}
+
+TEST_SUITE(Paint,
+
+TEST_CASE(CircleSteps,
+{
+    int Previous = 0;
+    for (float Radius = 0.0f; Radius < 1000.0f; Radius += 3.0f)
+    {
+        const int Steps = OctaneGUI::Paint::CircleSteps(Radius);
+        VERIFYF(Steps >= Previous && Steps % 8 == 0 && Steps >= 8 && Steps <= 256, "Invalid step count %d for radius %f.", Steps, Radius);
+        Previous = Steps;
+    }
+
+    return OctaneGUI::Paint::CircleSteps(4.0f) < OctaneGUI::Paint::CircleSteps(100.0f);
+})
+
+TEST_CASE(Circle,
+{
+    const OctaneGUI::Vector2 Center(100.0f, 100.0f);
+    const float Radius = 50.0f;
+
+    OctaneGUI::Paint Brush;
+    Brush.Circle(Center, Radius, OctaneGUI::Color::White);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    const uint32_t Steps = (uint32_t)OctaneGUI::Paint::CircleSteps(Radius);
+    VERIFY(Buffer.GetVertexCount() == Steps + 2 && Buffer.GetIndexCount() == Steps * 3);
+    VERIFY(OnCircle(Buffer, Center, Radius));
+
+    const float Expected = Pi * Radius * Radius;
+    const float Actual = Area(Buffer);
+    VERIFYF(std::abs(Actual - Expected) < Expected * 0.01f, "Circle area is %f, expected %f.", Actual, Expected);
+    return true;
+})
+
+TEST_CASE(Arc,
+{
+    // 10 to 100 degrees does not line up with a unit circle table.
+    const OctaneGUI::Vector2 Center(100.0f, 100.0f);
+    const float Radius = 80.0f;
+
+    OctaneGUI::Paint Brush;
+    Brush.Arc(Center, Radius, 10.0f, 100.0f, OctaneGUI::Color::White, 16);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.GetVertexCount() == 18 && OnCircle(Buffer, Center, Radius));
+
+    const OctaneGUI::Vector2 First = Buffer.GetVertices()[1].Position;
+    const OctaneGUI::Vector2 Last = Buffer.GetVertices()[17].Position;
+    const float Rad = Pi / 180.0f;
+    VERIFY(std::abs(First.X - (Center.X + std::round(std::cos(10.0f * Rad) * Radius))) <= 1.0f);
+    VERIFY(std::abs(First.Y - (Center.Y + std::round(std::sin(10.0f * Rad) * Radius))) <= 1.0f);
+    VERIFY(std::abs(Last.X - (Center.X + std::round(std::cos(100.0f * Rad) * Radius))) <= 1.0f);
+    VERIFY(std::abs(Last.Y - (Center.Y + std::round(std::sin(100.0f * Rad) * Radius))) <= 1.0f);
+    return true;
+})
+
+TEST_CASE(RectangleRounded,
+{
+    const float Radius = 10.0f;
+    const OctaneGUI::Rect Bounds(0.0f, 0.0f, 200.0f, 100.0f);
+
+    OctaneGUI::Paint Brush;
+    Brush.RectangleRounded(Bounds, OctaneGUI::Color::White, OctaneGUI::Rect(Radius, Radius, Radius, Radius));
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.Commands().size() == 1 && Buffer.Commands()[0].IndexCount() == Buffer.GetIndexCount());
+    for (const OctaneGUI::Vertex& Item : Buffer.GetVertices())
+    {
+        VERIFY(Bounds.Contains(Item.Position));
+    }
+
+    // The corners cut (4 - Pi) * R^2 out of the rectangle.
+    const float Expected = Bounds.Width() * Bounds.Height() - (4.0f - Pi) * Radius * Radius;
+    const float Actual = Area(Buffer);
+    VERIFYF(std::abs(Actual - Expected) < 20.0f, "Rounded rectangle area is %f, expected %f.", Actual, Expected);
+
+    OctaneGUI::Paint Square;
+    Square.RectangleRounded(Bounds, OctaneGUI::Color::White, OctaneGUI::Rect());
+    return Square.GetBuffer().GetVertexCount() == 20 && std::abs(Area(Square.GetBuffer()) - Bounds.Width() * Bounds.Height()) < 1e-3f;
+})
+
+TEST_CASE(Outline,
+{
+    OctaneGUI::Paint Brush;
+    Brush.CircleOutline(OctaneGUI::Vector2(50.0f, 50.0f), 20.0f, OctaneGUI::Color::White);
+
+    // One quad per segment in a single command.
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    const uint32_t Steps = (uint32_t)OctaneGUI::Paint::CircleSteps(20.0f);
+    return Buffer.Commands().size() == 1 && Buffer.GetVertexCount() == Steps * 4 && Buffer.GetIndexCount() == Steps * 6;
+})
+
+TEST_CASE(Polyline,
+{
+    // Points share their vertices with both segments they join.
+    OctaneGUI::Paint Brush;
+    Brush.Polyline(HorizontalPoints(11), OctaneGUI::Color::White, 2.0f);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.Commands().size() == 1 && Buffer.GetVertexCount() == 22 && Buffer.GetIndexCount() == 60);
+
+    const float Actual = Area(Buffer);
+    VERIFYF(std::abs(Actual - 20.0f) < 1e-3f, "Polyline area is %f, expected 20.", Actual);
+    return true;
+})
+
+TEST_CASE(PolylineCompact,
+{
+    // Long lines are split into commands that each fit in 16-bit indices.
+    const size_t Count = 100000;
+    OctaneGUI::Paint Brush;
+    Brush.SetCompact(true);
+    Brush.Polyline(HorizontalPoints(Count), OctaneGUI::Color::White, 2.0f);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    const std::vector<OctaneGUI::DrawCommand>& Commands = Buffer.Commands();
+    VERIFY(Commands.size() > 1);
+    VERIFY(Buffer.GetIndexCount() == (Count - 1) * 6);
+    for (size_t I = 0; I < Commands.size(); I++)
+    {
+        const uint32_t End = I + 1 < Commands.size() ? Commands[I + 1].VertexOffset() : Buffer.GetVertexCount();
+        VERIFY(End - Commands[I].VertexOffset() <= OctaneGUI::VertexBuffer::CompactMaxVertices);
+    }
+    return true;
+})
+
+TEST_CASE(Strip,
+{
+    std::vector<OctaneGUI::Vector2> Upper = HorizontalPoints(101);
+    std::vector<OctaneGUI::Vector2> Lower = HorizontalPoints(101);
+    for (OctaneGUI::Vector2& Point : Lower)
+    {
+        Point.Y += 10.0f;
+    }
+
+    OctaneGUI::Paint Brush;
+    Brush.Strip(Upper, Lower, OctaneGUI::Color::White);
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.GetVertexCount() == 202 && Buffer.GetIndexCount() == 600);
+    return std::abs(Area(Buffer) - 1000.0f) < 1e-2f;
+})
+
+)
+
+}
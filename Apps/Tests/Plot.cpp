@@ -0,0 +1,242 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+#include "Utility.h"
+
+#include <cmath>
+#include <vector>
+
+namespace Tests
+{
+
+// Deterministic noisy samples with occasional spikes.
+static float Sample(size_t Index)
+{
+    const uint32_t Hash = (uint32_t)Index * 2654435761u;
+    const float Noise = (float)(Hash >> 8) / (float)(1u << 24);
+    return std::sin((float)Index * 0.001f) * 100.0f + Noise * 10.0f + (Hash % 997 == 0 ? 500.0f : 0.0f);
+}
+
+static OctaneGUI::PlotData CreateData(size_t Count, size_t Batch)
+{
+    OctaneGUI::PlotData Data;
+    Data.AddSeries();
+
+    for (size_t Start = 0; Start < Count; Start += Batch)
+    {
+        std::vector<double> X;
+        std::vector<std::vector<float>> Values(1);
+        for (size_t I = Start; I < std::min(Count, Start + Batch); I++)
+        {
+            X.push_back((double)I);
+            Values[0].push_back(Sample(I));
+        }
+        Data.Append(X, Values);
+    }
+
+    return Data;
+}
+
+static bool MatchesScan(const OctaneGUI::PlotData& Data, size_t Begin, size_t End)
+{
+    float Min = HUGE_VALF;
+    float Max = -HUGE_VALF;
+    for (size_t I = Begin; I < End; I++)
+    {
+        Min = std::min(Min, Data.Value(0, I));
+        Max = std::max(Max, Data.Value(0, I));
+    }
+
+    const OctaneGUI::PlotData::Range Range = Data.MinMax(0, Begin, End);
+    return Range.Min == Min && Range.Max == Max;
+}
+
+static std::shared_ptr<OctaneGUI::Plot> Load(OctaneGUI::Application& Application)
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "Plot", "ID": "Plot", "Expand": "Both", "Series": [{}, {"Color": [255, 0, 0, 255]}]})", List);
+    return List.To<OctaneGUI::Plot>("Plot");
+}
+
+static void AppendSamples(OctaneGUI::Plot& Plot, size_t Start, size_t Count)
+{
+    std::vector<double> X;
+    std::vector<std::vector<float>> Values(Plot.Data().SeriesCount());
+    for (size_t I = Start; I < Start + Count; I++)
+    {
+        X.push_back((double)I);
+        for (std::vector<float>& Column : Values)
+        {
+            Column.push_back(Sample(I));
+        }
+    }
+    Plot.Append(X, Values);
+}
+
+static uint32_t PaintedVertices(const OctaneGUI::Plot& Plot)
+{
+    OctaneGUI::Paint Brush(Plot.GetTheme());
+    Plot.OnPaint(Brush);
+    return Brush.GetBuffer().GetVertexCount();
+}
+
+TEST_SUITE(PlotData,
+
+TEST_CASE(MinMax,
+{
+    const OctaneGUI::PlotData Data = CreateData(100000, 4096);
+    VERIFY(Data.Count() == 100000 && Data.Levels() > 3);
+
+    for (size_t I = 0; I < 200; I++)
+    {
+        const size_t Begin = ((size_t)I * 7919) % Data.Count();
+        const size_t End = std::min(Data.Count(), Begin + 1 + ((size_t)I * 104729) % 60000);
+        VERIFYF(MatchesScan(Data, Begin, End), "Range of [%zu, %zu) does not match.", Begin, End);
+    }
+
+    const OctaneGUI::PlotData::Range Empty = Data.MinMax(0, 10, 10);
+    return Empty.Min > Empty.Max;
+})
+
+TEST_CASE(Streaming,
+{
+    // Appending one sample at a time builds the same pyramid as appending in batches.
+    const OctaneGUI::PlotData Batched = CreateData(20000, 20000);
+    const OctaneGUI::PlotData Single = CreateData(20000, 1);
+    VERIFY(Batched.Levels() == Single.Levels());
+
+    for (size_t Begin = 0; Begin < 20000; Begin += 1237)
+    {
+        const OctaneGUI::PlotData::Range A = Batched.MinMax(0, Begin, 20000);
+        const OctaneGUI::PlotData::Range B = Single.MinMax(0, Begin, 20000);
+        VERIFY(A.Min == B.Min && A.Max == B.Max);
+    }
+
+    return MatchesScan(Single, 0, 20000);
+})
+
+TEST_CASE(Decimate,
+{
+    const OctaneGUI::PlotData Data = CreateData(100000, 100000);
+
+    std::vector<OctaneGUI::PlotData::Bucket> Buckets;
+    Data.Decimate(0, 1000.0, 91000.0, 900, Buckets);
+    VERIFY(Buckets.size() == 900);
+
+    size_t Total = 0;
+    for (size_t Column = 0; Column < Buckets.size(); Column++)
+    {
+        const OctaneGUI::PlotData::Bucket& Item = Buckets[Column];
+        const size_t Begin = 1000 + Column * 100;
+        VERIFY(Item.Count == 100);
+        VERIFY(Item.First == Data.Value(0, Begin) && Item.Last == Data.Value(0, Begin + 99));
+        VERIFY(MatchesScan(Data, Begin, Begin + 100));
+        VERIFY(Item.Min == Data.MinMax(0, Begin, Begin + 100).Min);
+        Total += Item.Count;
+    }
+
+    return Total == 90000;
+})
+
+TEST_CASE(Series,
+{
+    // New series are padded and X values never decrease.
+    OctaneGUI::PlotData Data;
+    Data.AddSeries();
+    Data.Append(1.0, { 5.0f });
+    Data.Append(0.5, { 6.0f });
+    Data.AddSeries();
+    Data.Append(2.0, { 7.0f });
+    VERIFY(Data.SeriesCount() == 2 && Data.Count() == 3);
+    VERIFY(Data.X(1) == 1.0 && Data.LowerBound(1.5) == 2);
+    return Data.Value(1, 0) == 0.0f && Data.Value(1, 2) == 0.0f && Data.Value(0, 2) == 7.0f;
+})
+
+)
+
+TEST_SUITE(Plot,
+
+TEST_CASE(Load,
+{
+    const std::shared_ptr<OctaneGUI::Plot> Plot = Load(Application);
+    VERIFY(Plot->Data().SeriesCount() == 2);
+    return Plot->SeriesColor(1) == OctaneGUI::Color(255, 0, 0, 255) && Plot->IsSeriesVisible(0);
+})
+
+TEST_CASE(Decimated,
+{
+    // The geometry depends on the width of the plot rather than the number of samples.
+    const std::shared_ptr<OctaneGUI::Plot> Plot = Load(Application);
+    AppendSamples(*Plot, 0, 100000);
+    const uint32_t Few = PaintedVertices(*Plot);
+
+    AppendSamples(*Plot, 100000, 900000);
+    const uint32_t Many = PaintedVertices(*Plot);
+
+    const uint32_t Limit = 2 * (2 * ((uint32_t)Plot->GetSize().X + 1)) + 4;
+    VERIFYF(Few <= Limit && Many <= Limit, "Painted %u and %u vertices, expected at most %u.", Few, Many, Limit);
+    return Many > Limit / 2;
+})
+
+TEST_CASE(Sparse,
+{
+    // A line through every sample when there are fewer samples than pixels.
+    const std::shared_ptr<OctaneGUI::Plot> Plot = Load(Application);
+    Plot->SetSeriesVisible(1, false);
+    AppendSamples(*Plot, 0, 100);
+    return PaintedVertices(*Plot) == 4 + 100 * 2;
+})
+
+TEST_CASE(Follow,
+{
+    const std::shared_ptr<OctaneGUI::Plot> Plot = Load(Application);
+    AppendSamples(*Plot, 0, 100);
+    Plot->SetView(0.0, 100.0).SetFollow(true);
+    AppendSamples(*Plot, 100, 400);
+    VERIFY(std::abs(Plot->ViewMax() - 499.0) < 1e-6 && std::abs(Plot->ViewMin() - 399.0) < 1e-6);
+
+    Plot->FitView();
+    return Plot->ViewMin() == 0.0 && Plot->ViewMax() > 499.0 && Plot->ViewMax() < 499.001;
+})
+
+TEST_CASE(Zoom,
+{
+    const std::shared_ptr<OctaneGUI::Plot> Plot = Load(Application);
+    AppendSamples(*Plot, 0, 1000);
+    Plot->SetView(0.0, 1000.0);
+
+    // Zooms around the mouse, which has not moved from the left edge.
+    Plot->OnMouseWheel({ 0.0f, 1.0f });
+    VERIFY(Plot->ViewMin() == 0.0 && std::abs(Plot->ViewMax() - 800.0) < 1e-6);
+    Plot->OnMouseWheel({ 0.0f, -1.0f });
+    return std::abs(Plot->ViewMax() - 1000.0) < 1e-6;
+})
+
+)
+
+}
@@ -0,0 +1,157 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#if TOOLS
+
+#include "OctaneGUI/Tools/Profiler.h"
+
+#include <thread>
+
+namespace Tests
+{
+
+// Runs a frame that adds Value to the vertex counter from the frame thread and to the
+// indices counter from a worker thread.
+static void RunFrame(uint64_t Value)
+{
+    OctaneGUI::Tools::Profiler::Frame Frame_(true);
+    OctaneGUI::Tools::Profiler::Get().AddCounter(OctaneGUI::Tools::Profiler::Counter::Vertices, Value);
+    std::thread Worker([Value]() -> void
+        {
+            OctaneGUI::Tools::Profiler::Get().AddCounter(OctaneGUI::Tools::Profiler::Counter::Indices, Value * 2);
+        });
+    Worker.join();
+}
+
+static bool ContinuousFrames()
+{
+    OctaneGUI::Tools::Profiler& Instance = OctaneGUI::Tools::Profiler::Get();
+    Instance.EnableContinuous(3, 0, 2);
+    for (uint64_t I = 0; I < 5; I++)
+    {
+        RunFrame(I);
+    }
+    Instance.Disable();
+
+    // Only the most recent frames are kept, ordered from oldest to newest.
+    const std::vector<OctaneGUI::Tools::Profiler::Frame>& Frames = Instance.Frames();
+    VERIFYF(Frames.size() == 3, "Expected 3 frames, got %zu.", Frames.size());
+    for (size_t I = 0; I < Frames.size(); I++)
+    {
+        VERIFYF(Frames[I].CounterValue(OctaneGUI::Tools::Profiler::Counter::Vertices) == I + 2, "Frame %zu is out of order.", I);
+    }
+
+    // Every frame is slow with a threshold of 0ms, but only the latest ones are kept.
+    const std::vector<OctaneGUI::Tools::Profiler::Frame>& SlowFrames = Instance.SlowFrames();
+    VERIFYF(SlowFrames.size() == 2, "Expected 2 slow frames, got %zu.", SlowFrames.size());
+    return SlowFrames[0].CounterValue(OctaneGUI::Tools::Profiler::Counter::Vertices) == 3
+        && SlowFrames[1].CounterValue(OctaneGUI::Tools::Profiler::Counter::Vertices) == 4;
+}
+
+TEST_SUITE(Profiler,
+
+TEST_CASE(Counters,
+{
+    OctaneGUI::Tools::Profiler& Instance = OctaneGUI::Tools::Profiler::Get();
+    Instance.Enable();
+    RunFrame(3);
+    RunFrame(5);
+    Instance.Disable();
+
+    const std::vector<OctaneGUI::Tools::Profiler::Frame>& Frames = Instance.Frames();
+    VERIFY(Frames.size() == 2);
+    VERIFY(Frames[0].CounterValue(OctaneGUI::Tools::Profiler::Counter::Vertices) == 3);
+    VERIFY(Frames[0].CounterValue(OctaneGUI::Tools::Profiler::Counter::Indices) == 6);
+    return Frames[1].CounterValue(OctaneGUI::Tools::Profiler::Counter::Vertices) == 5
+        && Frames[1].CounterValue(OctaneGUI::Tools::Profiler::Counter::Indices) == 10;
+})
+
+TEST_CASE(BetweenFrames,
+{
+    OctaneGUI::Tools::Profiler& Instance = OctaneGUI::Tools::Profiler::Get();
+    Instance.Enable();
+    RunFrame(1);
+    std::thread Worker([]() -> void
+        {
+            OctaneGUI::Tools::Profiler::Get().AddCounter(OctaneGUI::Tools::Profiler::Counter::Indices, 7);
+        });
+    Worker.join();
+    RunFrame(1);
+    Instance.Disable();
+
+    // The count added by the worker after the first frame ended is carried into the second.
+    const std::vector<OctaneGUI::Tools::Profiler::Frame>& Frames = Instance.Frames();
+    VERIFY(Frames.size() == 2);
+    VERIFY(Frames[0].CounterValue(OctaneGUI::Tools::Profiler::Counter::Indices) == 2);
+    return Frames[1].CounterValue(OctaneGUI::Tools::Profiler::Counter::Indices) == 9;
+})
+
+TEST_CASE(Export,
+{
+    // Large enough to lose precision if the counter were exported as a float.
+    const uint64_t Large = (1ull << 40) + 1;
+
+    OctaneGUI::Tools::Profiler& Instance = OctaneGUI::Tools::Profiler::Get();
+    Instance.Enable();
+    {
+        OctaneGUI::Tools::Profiler::Frame Frame_(true);
+        Instance.AddCounter(OctaneGUI::Tools::Profiler::Counter::Vertices, Large);
+        for (int I = 0; I < 3; I++)
+        {
+            OctaneGUI::Tools::Profiler::Sample Sample("Layout", false);
+        }
+    }
+    Instance.Disable();
+
+    const OctaneGUI::Json Result = Instance.Export();
+    VERIFY(Result["Frames"].Count() == 1);
+    VERIFY(Result["SlowFrames"].IsNull());
+
+    const OctaneGUI::Json& Frame_ = Result["Frames"][0u];
+    VERIFY(Frame_["Name"].String() == std::string("Frame"));
+    VERIFY(Frame_["Counters"]["Vertices"].Double() == (double)Large);
+
+    // Samples with the same name are coalesced into a single event.
+    const OctaneGUI::Json& Events = Frame_["Events"];
+    VERIFY(Events.Count() == 1);
+    return Events[0u]["Name"].String() == std::string("Layout")
+        && Events[0u]["ExclusiveCount"].Double() == 3.0;
+})
+
+TEST_CASE(Continuous,
+{
+    const bool Result = ContinuousFrames();
+    return Result && !OctaneGUI::Tools::Profiler::Get().Export()["SlowFrames"].IsNull();
+})
+
+)
+
+}
+
+#endif
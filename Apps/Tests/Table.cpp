@@ -41,6 +41,24 @@ void LoadTable(OctaneGUI::Application& Application, const char* JSON, OctaneGUI:
     Utility::Load(Application, Stream.c_str(), List);
 }
 
+static std::shared_ptr<OctaneGUI::TableData> CreateData(size_t Rows)
+{
+    std::shared_ptr<OctaneGUI::TableData> Result = std::make_shared<OctaneGUI::TableData>();
+    Result->AddColumn("Name", OctaneGUI::TableData::Type::Text);
+    Result->AddColumn("Count", OctaneGUI::TableData::Type::Integer);
+    Result->AddColumn("Value", OctaneGUI::TableData::Type::Number);
+    Result->Resize(Rows);
+
+    for (size_t Row = 0; Row < Rows; Row++)
+    {
+        Result->SetText(Row, 0, "Row " + std::to_string(Row));
+        Result->SetInteger(Row, 1, (int64_t)Row * 3);
+        Result->SetNumber(Row, 2, (double)Row * 0.5);
+    }
+
+    return Result;
+}
+
 TEST_SUITE(Table,
 
 TEST_CASE(Headers,
@@ -204,6 +222,113 @@ TEST_CASE(CellInput,
     return Clicked;
 })
 
+TEST_CASE(Data,
+{
+    std::shared_ptr<OctaneGUI::TableData> Data = CreateData(10);
+    Data->SetPrecision(2, 1);
+    VERIFY(Data->Format(3, 0) == "Row 3" && Data->Format(3, 1) == "9" && Data->Format(3, 2) == "1.5");
+
+    Data->SetText(5, 0, "The longest row");
+    VERIFY(Data->LongestRow(0) == 5);
+
+    // Shortening or removing the longest row finds the next longest.
+    Data->SetText(7, 0, "A longer row");
+    Data->SetText(5, 0, "Short");
+    VERIFY(Data->LongestRow(0) == 7);
+    Data->Resize(7);
+    VERIFY(Data->LongestRow(0) == 0);
+    Data->Resize(10);
+
+    Data->AddRow();
+    VERIFY(Data->Rows() == 11 && Data->Text(10, 0).empty() && Data->Integer(10, 1) == 0);
+
+    Data->Clear();
+    return Data->Rows() == 0 && Data->Columns() == 3;
+})
+
+TEST_CASE(DataRows,
+{
+    OctaneGUI::ControlList List;
+    LoadTable(Application, R"("Header": [{"Label": "Name"}])", List);
+
+    const std::shared_ptr<OctaneGUI::Table> Table = List.To<OctaneGUI::Table>("Table");
+    std::shared_ptr<OctaneGUI::TableData> Data = CreateData(1000);
+    Table->SetData(Data);
+    VERIFY(Table->Columns() == 3 && Table->Rows() == 1000);
+    const uint32_t Few = Utility::PaintedVertices(Application);
+
+    // Only the rows in view are painted.
+    Data->Resize(100000);
+    Table->DataChanged();
+    VERIFY(Table->Rows() == 100000);
+    const uint32_t Many = Utility::PaintedVertices(Application);
+    VERIFYF(Few == Many, "Painted %u vertices for 1000 rows and %u for 100000 rows.", Few, Many);
+
+    size_t First = 0;
+    size_t Last = 0;
+    Table->VisibleRows(First, Last);
+    VERIFYF(First == 0 && Last > 0 && Last < 1000, "Rows %zu to %zu are in view.", First, Last);
+
+    Table->SetData(nullptr);
+    Table->VisibleRows(First, Last);
+    return Table->Rows() == 0 && First == Last;
+})
+
+TEST_CASE(DataSelect,
+{
+    OctaneGUI::ControlList List;
+    LoadTable(Application, R"("RowSelectable": true)", List);
+
+    const std::shared_ptr<OctaneGUI::Table> Table = List.To<OctaneGUI::Table>("Table");
+    Table->SetData(CreateData(100000));
+    Application.Update();
+
+    size_t Result = 0;
+    Table->SetOnSelected([&](OctaneGUI::Table&, size_t Selected) -> void
+        {
+            Result = Selected;
+        });
+
+    // Take into account height of header + Row 1 + Row 2.
+    const float Height = Table->RowHeight();
+    Utility::MouseMove(Application, { 2.0f, Height * 3.5f });
+    Utility::MousePress(Application, { 2.0f, Height * 3.5f });
+    Application.Update();
+    VERIFYF(Result == 2, "Selected row %zu instead of 2.", Result);
+
+    // Rows further down after the data shrinks.
+    Table->Data()->Resize(100);
+    Table->DataChanged();
+    Application.Update();
+    Utility::MouseMove(Application, { 2.0f, Height * 10.5f });
+    Utility::MousePress(Application, { 2.0f, Height * 10.5f });
+    Application.Update();
+    return Result == 9;
+})
+
+TEST_CASE(DataFitColumn,
+{
+    OctaneGUI::ControlList List;
+    LoadTable(Application, R"("Header": [{"Label": "A"}])", List);
+
+    const std::shared_ptr<OctaneGUI::Table> Table = List.To<OctaneGUI::Table>("Table");
+    std::shared_ptr<OctaneGUI::TableData> Data = CreateData(100000);
+    Data->SetText(54321, 0, "The row with the most characters in this column");
+    Table->SetData(Data);
+    Table->FitColumn(0);
+    Application.Update();
+
+    // The longest row is measured even though it is not one of the sampled rows.
+    const std::shared_ptr<OctaneGUI::Font> Font = Application.GetTheme()->GetFont();
+    const float Expected = Font->Measure(U"The row with the most characters in this column").X;
+    VERIFYF(Table->ColumnSize(0) >= Expected, "Column width %.2f is less than %.2f.", Table->ColumnSize(0), Expected);
+
+    Table->SetColumnSize(0, 10.0f);
+    Table->FitColumn(1);
+    Application.Update();
+    return Table->ColumnSize(0) == 10.0f && Table->ColumnSize(1) >= Font->Measure(U"299997").X;
+})
+
 )
 
 }
@@ -0,0 +1,233 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <atomic>
+#include <thread>
+
+namespace Tests
+{
+
+static bool UpdateUntil(OctaneGUI::Application& Application, const bool& Done)
+{
+    OctaneGUI::Clock Clock;
+    while (!Done && Clock.MeasureMS() < 5000)
+    {
+        Application.Update();
+    }
+    return Done;
+}
+
+TEST_SUITE(Task,
+
+TEST_CASE(Run,
+{
+    bool Done = false;
+    int Value = 0;
+    std::thread::id Thread;
+    OctaneGUI::Tasks::Run(Application, []() -> int
+        {
+            return 42;
+        })
+        .Then([&](int Result) -> void
+            {
+                Value = Result;
+                Thread = std::this_thread::get_id();
+                Done = true;
+            });
+
+    VERIFYF(UpdateUntil(Application, Done), "Task did not complete.");
+    VERIFYF(Thread == std::this_thread::get_id(), "Continuation was not invoked on the UI thread.");
+    return Value == 42;
+})
+
+TEST_CASE(Chain,
+{
+    bool Done = false;
+    std::string Value;
+    OctaneGUI::Tasks::Run(Application, []() -> int
+        {
+            return 2;
+        })
+        .Then([&](int Result) -> OctaneGUI::Task<int>
+            {
+                return OctaneGUI::Tasks::Run(Application, [Result]() -> int
+                    {
+                        return Result * 21;
+                    });
+            })
+        .Then([](int Result) -> std::string
+            {
+                return std::to_string(Result);
+            })
+        .Then([&](std::string Result) -> void
+            {
+                Value = Result;
+                Done = true;
+            });
+
+    VERIFYF(UpdateUntil(Application, Done), "Chained task did not complete.");
+    return Value == "42";
+})
+
+TEST_CASE(ResolvedBeforeThen,
+{
+    OctaneGUI::Task<int> Task { Application };
+    std::thread Worker([Task]() -> void
+        {
+            Task.Resolve(7);
+        });
+    Worker.join();
+
+    bool Done = false;
+    int Value = 0;
+    Task.Then([&](int Result) -> void
+        {
+            Value = Result;
+            Done = true;
+        });
+
+    VERIFYF(!Done, "Continuation should wait for Update.");
+    return UpdateUntil(Application, Done) && Value == 7;
+})
+
+TEST_CASE(Cancel,
+{
+    OctaneGUI::Task<int> Task { Application };
+    bool Invoked = false;
+    Task.Then([&](int) -> void
+        {
+            Invoked = true;
+        });
+
+    Task.Cancel();
+    Task.Resolve(1);
+    Application.Update();
+    return !Invoked && Task.IsCancelled() && !Task.IsResolved();
+})
+
+TEST_CASE(Delay,
+{
+    bool Done = false;
+    OctaneGUI::Tasks::Delay(*Application.GetMainWindow(), 10).Then([&]() -> void
+        {
+            Done = true;
+        });
+
+    VERIFYF(!Done, "Delay should not resolve immediately.");
+    return UpdateUntil(Application, Done);
+})
+
+TEST_CASE(DelayWindowDestroyed,
+{
+    std::shared_ptr<int> Sentinel = std::make_shared<int>(0);
+    const std::weak_ptr<int> Weak = Sentinel;
+    {
+        const std::shared_ptr<OctaneGUI::Window> Temporary = std::make_shared<OctaneGUI::Window>(&Application);
+        Temporary->CreateContainer();
+        OctaneGUI::Tasks::Delay(*Temporary, 60000).Then([Sentinel]() -> void
+            {
+            });
+        Sentinel.reset();
+        VERIFYF(!Weak.expired(), "Pending delay should keep its continuation.");
+    }
+
+    return Weak.expired();
+})
+
+TEST_CASE(Void,
+{
+    bool Done = false;
+    std::atomic<bool> Worked { false };
+    OctaneGUI::Tasks::Run(Application, [&Worked]() -> void
+        {
+            Worked = true;
+        })
+        .Then([&]() -> void
+            {
+                Done = true;
+            });
+
+    VERIFYF(UpdateUntil(Application, Done), "Task did not complete.");
+    return Worked.load();
+})
+
+TEST_CASE(VoidChain,
+{
+    bool Done = false;
+    std::atomic<int> Value { 0 };
+    OctaneGUI::Tasks::Run(Application, []() -> int
+        {
+            return 42;
+        })
+        .Then([&](int Result) -> OctaneGUI::Task<void>
+            {
+                return OctaneGUI::Tasks::Run(Application, [&Value, Result]() -> void
+                    {
+                        Value = Result;
+                    });
+            })
+        .Then([&]() -> void
+            {
+                Done = true;
+            });
+
+    VERIFYF(UpdateUntil(Application, Done), "Chained task did not complete.");
+    return Value == 42;
+})
+
+TEST_CASE(WaitForNotificationCancel,
+{
+    OctaneGUI::LanguageServer& LS = Application.LS();
+    const size_t Listeners = LS.Listeners();
+
+    OctaneGUI::Task<OctaneGUI::LanguageServer::Notification> Task = OctaneGUI::Tasks::WaitForNotification(Application, OctaneGUI::LanguageServer::Notification::Type::DocumentSymbols);
+    VERIFYF(LS.Listeners() == Listeners + 1, "Waiting should add a listener.");
+
+    Task.Cancel();
+    Application.Update();
+    return LS.Listeners() == Listeners;
+})
+
+TEST_CASE(LoadContents,
+{
+    bool Done = false;
+    std::string Contents;
+    OctaneGUI::Tasks::LoadContents(Application, U"Resources/Check.svg").Then([&](std::string Result) -> void
+        {
+            Contents = Result;
+            Done = true;
+        });
+
+    VERIFYF(UpdateUntil(Application, Done), "File was not loaded.");
+    return Contents.find("<svg") != std::string::npos;
+})
+
+)
+
+}
@@ -0,0 +1,210 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "OctaneGUI/Texture.h"
+#include "OctaneGUI/TextureAtlas.h"
+#include "TestSuite.h"
+
+#include <memory>
+
+namespace Tests
+{
+
+static std::vector<uint8_t> Pixels(uint32_t Width, uint32_t Height)
+{
+    return std::vector<uint8_t>((size_t)Width * Height * 4, 255);
+}
+
+static bool Overlaps(const OctaneGUI::Rect& A, const OctaneGUI::Rect& B)
+{
+    return A.Min.X < B.Max.X && B.Min.X < A.Max.X && A.Min.Y < B.Max.Y && B.Min.Y < A.Max.Y;
+}
+
+// Packs a mix of sizes and verifies that every region is inside the page and that no
+// two regions overlap.
+static bool PackMany(OctaneGUI::TextureAtlas& Atlas, std::vector<std::shared_ptr<OctaneGUI::Texture>>& Textures)
+{
+    const OctaneGUI::Rect Full { 0.0f, 0.0f, 1.0f, 1.0f };
+    std::vector<OctaneGUI::Rect> Regions;
+    for (uint32_t I = 0; I < 200; I++)
+    {
+        const uint32_t Width = 4 + (I * 7) % 29;
+        const uint32_t Height = 4 + (I * 13) % 23;
+
+        std::shared_ptr<OctaneGUI::Texture> Item = std::make_shared<OctaneGUI::Texture>();
+        if (!Atlas.Add(*Item, Pixels(Width, Height), Width, Height))
+        {
+            return false;
+        }
+
+        if (Item->GetSize() != OctaneGUI::Vector2((float)Width, (float)Height))
+        {
+            return false;
+        }
+
+        const OctaneGUI::Rect Region = Item->MapTexCoords(Full);
+        if (Region.Min.X < 0.0f || Region.Min.Y < 0.0f || Region.Max.X > 1.0f || Region.Max.Y > 1.0f)
+        {
+            return false;
+        }
+
+        for (size_t J = 0; J < Regions.size(); J++)
+        {
+            if (Textures[J]->Atlas() == Item->Atlas() && Overlaps(Regions[J], Region))
+            {
+                return false;
+            }
+        }
+
+        Regions.push_back(Region);
+        Textures.push_back(Item);
+    }
+
+    return true;
+}
+
+TEST_SUITE(TextureAtlas,
+
+TEST_CASE(Pack,
+{
+    OctaneGUI::TextureAtlas Atlas;
+    Atlas.SetPageSize(256);
+
+    std::vector<std::shared_ptr<OctaneGUI::Texture>> Textures;
+    VERIFYF(PackMany(Atlas, Textures), "Packed regions are invalid.");
+    VERIFYF(Atlas.Pages() > 1, "Expected the images to spill onto a second page.");
+    VERIFYF(!Textures[0]->IsValid(), "Pages should not be valid before being flushed.");
+
+    Atlas.Flush();
+    for (const std::shared_ptr<OctaneGUI::Texture>& Item : Textures)
+    {
+        VERIFY(Item->IsValid());
+        VERIFY(Item->GetID() == Item->Atlas()->GetID());
+    }
+
+    return true;
+})
+
+TEST_CASE(TooLarge,
+{
+    OctaneGUI::TextureAtlas Atlas;
+    Atlas.SetPageSize(64);
+
+    OctaneGUI::Texture Item;
+    return !Atlas.Add(Item, Pixels(64, 8), 64, 8) && Atlas.Pages() == 0;
+})
+
+TEST_CASE(Remove,
+{
+    OctaneGUI::TextureAtlas Atlas;
+    Atlas.SetPageSize(64);
+
+    OctaneGUI::Texture First;
+    OctaneGUI::Texture Second;
+    OctaneGUI::Texture Standalone;
+    VERIFY(Atlas.Add(First, Pixels(8, 8), 8, 8) && Atlas.Add(Second, Pixels(8, 8), 8, 8));
+    VERIFY(Atlas.Pages() == 1 && Atlas.Bytes() == 64 * 64 * 4);
+    VERIFY(!Atlas.Remove(Standalone));
+
+    // The page is only released with the last image packed into it.
+    VERIFY(Atlas.Remove(First) && Atlas.Pages() == 1);
+    VERIFY(Atlas.Remove(Second) && Atlas.Pages() == 0 && Atlas.Bytes() == 0);
+
+    // Textures that are still around keep their page.
+    return Second.Atlas() != nullptr && Second.Atlas()->IsValid();
+})
+
+TEST_CASE(MapTexCoords,
+{
+    OctaneGUI::TextureAtlas Atlas;
+    Atlas.SetPageSize(100);
+
+    OctaneGUI::Texture Item;
+    VERIFY(Atlas.Add(Item, Pixels(10, 20), 10, 20));
+
+    // The first image is placed in the corner after its border.
+    const OctaneGUI::Rect Mapped = Item.MapTexCoords(OctaneGUI::Rect(0.0f, 0.5f, 1.0f, 1.0f));
+    const OctaneGUI::Rect Expected(0.01f, 0.11f, 0.11f, 0.21f);
+    VERIFYF(std::abs(Mapped.Min.X - Expected.Min.X) < 1e-5f && std::abs(Mapped.Min.Y - Expected.Min.Y) < 1e-5f
+            && std::abs(Mapped.Max.X - Expected.Max.X) < 1e-5f && std::abs(Mapped.Max.Y - Expected.Max.Y) < 1e-5f,
+        "Mapped coordinates are (%f, %f, %f, %f).", Mapped.Min.X, Mapped.Min.Y, Mapped.Max.X, Mapped.Max.Y);
+
+    OctaneGUI::Texture Standalone;
+    return Standalone.MapTexCoords(Mapped) == Mapped;
+})
+
+TEST_CASE(CacheSharesPage,
+{
+    OctaneGUI::TextureCache Cache;
+    const std::shared_ptr<OctaneGUI::Texture> Small = Cache.Load("Resources/thumbs_up.png");
+    const std::shared_ptr<OctaneGUI::Texture> Icon = Cache.Load("Resources/Check.svg");
+    const std::shared_ptr<OctaneGUI::Texture> Large = Cache.Load("Resources/info.png");
+
+    VERIFY(Small && Icon && Large);
+    VERIFY(Small->IsValid() && Icon->IsValid() && Large->IsValid());
+    VERIFYF(Small->Atlas() && Small->Atlas() == Icon->Atlas(), "Small images should share a page.");
+    VERIFYF(Small->GetID() == Icon->GetID(), "Small images should share a texture ID.");
+    VERIFYF(!Large->Atlas() && Large->GetID() != Small->GetID(), "Large images should have their own texture.");
+
+    OctaneGUI::TextureCache Unpacked;
+    Unpacked.SetAtlasMaxSize(0);
+    return !Unpacked.Load("Resources/thumbs_up.png")->Atlas();
+})
+
+TEST_CASE(Batching,
+{
+    OctaneGUI::TextureAtlas Atlas;
+    const std::shared_ptr<OctaneGUI::Texture> First = std::make_shared<OctaneGUI::Texture>();
+    const std::shared_ptr<OctaneGUI::Texture> Second = std::make_shared<OctaneGUI::Texture>();
+    Atlas.Add(*First, Pixels(8, 8), 8, 8);
+    Atlas.Add(*Second, Pixels(8, 8), 8, 8);
+    Atlas.Flush();
+
+    const OctaneGUI::Rect UVs(0.0f, 0.0f, 1.0f, 1.0f);
+
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    for (int I = 0; I < 10; I++)
+    {
+        Brush.Image(OctaneGUI::Rect(0.0f, 0.0f, 8.0f, 8.0f), UVs, I % 2 == 0 ? First : Second, OctaneGUI::Color::White);
+    }
+
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFYF(Buffer.Commands().size() == 1, "Expected 1 command but found %zu.", Buffer.Commands().size());
+    VERIFY(Buffer.Commands()[0].IndexCount() == 60);
+
+    // Indices of merged draws must refer to their own vertices.
+    const std::vector<uint32_t>& Indices = Buffer.GetIndices();
+    VERIFY(Indices[6] == 4 && Indices[59] == 39);
+
+    Brush.Rectangle(OctaneGUI::Rect(0.0f, 0.0f, 8.0f, 8.0f), OctaneGUI::Color::White);
+    Brush.Image(OctaneGUI::Rect(0.0f, 0.0f, 8.0f, 8.0f), UVs, First, OctaneGUI::Color::White);
+    return Buffer.Commands().size() == 3 && Buffer.GetIndices()[66] == 0;
+})
+
+)
+
+}
@@ -0,0 +1,186 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "OctaneGUI/Texture.h"
+#include "TestSuite.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace Tests
+{
+
+static std::vector<uint32_t> Unloaded;
+
+// Records the IDs released while it is alive in place of a renderer.
+struct UnloadRecorder
+{
+public:
+    UnloadRecorder(OctaneGUI::Application& Application)
+        : m_Application(Application)
+    {
+        Unloaded.clear();
+        m_Application.SetOnUnloadTexture([](uint32_t ID) -> void
+            {
+                Unloaded.push_back(ID);
+            });
+    }
+
+    ~UnloadRecorder()
+    {
+        m_Application.SetOnUnloadTexture(nullptr);
+    }
+
+private:
+    OctaneGUI::Application& m_Application;
+};
+
+static bool WasUnloaded(uint32_t ID)
+{
+    return std::find(Unloaded.begin(), Unloaded.end(), ID) != Unloaded.end();
+}
+
+TEST_SUITE(TextureCache,
+
+TEST_CASE(ReleaseLastReference,
+{
+    UnloadRecorder Recorder(Application);
+
+    std::shared_ptr<OctaneGUI::Texture> Item = OctaneGUI::Texture::Load(std::vector<uint8_t>(64, 255), 4, 4);
+    VERIFY(Item && Item->Bytes() == 64);
+
+    const uint32_t ID = Item->GetID();
+    std::shared_ptr<OctaneGUI::Texture> Other = Item;
+    Item = nullptr;
+    VERIFYF(Unloaded.empty(), "Texture was released while still referenced.");
+
+    Other = nullptr;
+    return Unloaded.size() == 1 && WasUnloaded(ID);
+})
+
+TEST_CASE(AtlasReupload,
+{
+    UnloadRecorder Recorder(Application);
+
+    std::shared_ptr<OctaneGUI::TextureCache> Cache = std::make_shared<OctaneGUI::TextureCache>();
+    std::shared_ptr<OctaneGUI::Texture> First = Cache->Load("Resources/thumbs_up.png");
+    VERIFY(First && First->Atlas());
+
+    const uint32_t PageID = First->GetID();
+    VERIFY(Cache->Load("Resources/Check.svg") != nullptr);
+    VERIFYF(WasUnloaded(PageID) && First->GetID() != PageID, "Re-uploading a page should release its previous ID.");
+
+    // The page lives until both the cache and every texture packed into it are gone.
+    const uint32_t CurrentID = First->GetID();
+    Cache = nullptr;
+    VERIFY(!WasUnloaded(CurrentID));
+    First = nullptr;
+    return WasUnloaded(CurrentID);
+})
+
+TEST_CASE(Budget,
+{
+    UnloadRecorder Recorder(Application);
+
+    OctaneGUI::TextureCache Cache;
+    Cache.SetAtlasMaxSize(0);
+
+    std::shared_ptr<OctaneGUI::Texture> Info = Cache.Load("Resources/info.png");
+    std::shared_ptr<OctaneGUI::Texture> Thumbs = Cache.Load("Resources/thumbs_up.png");
+    std::shared_ptr<OctaneGUI::Texture> Check = Cache.Load("Resources/Check.svg");
+    VERIFY(Info != nullptr && Thumbs != nullptr && Check != nullptr);
+
+    const size_t Total = Info->Bytes() + Thumbs->Bytes() + Check->Bytes();
+    VERIFY(Cache.GetStats().Bytes == Total && Cache.GetStats().Misses == 3);
+
+    // Textures in use are kept even when over budget.
+    Cache.SetBudget(1);
+    Cache.Trim();
+    VERIFY(Cache.GetStats().Evictions == 0 && Cache.Cache().size() == 3);
+
+    // Touch the first texture so that the second is the least recently used.
+    VERIFY(Cache.Load("Resources/info.png") == Info && Cache.GetStats().Hits == 1);
+
+    const uint32_t ThumbsID = Thumbs->GetID();
+    const uint32_t CheckID = Check->GetID();
+    Info = nullptr;
+    Thumbs = nullptr;
+    Check = nullptr;
+    VERIFYF(Unloaded.empty(), "The cache should keep unused textures alive.");
+
+    Cache.SetBudget(Total - 1);
+    Cache.Trim();
+    VERIFYF(Unloaded.size() == 1 && WasUnloaded(ThumbsID), "Expected only the least recently used texture to be released.");
+    VERIFY(Cache.GetStats().Evictions == 1 && Cache.GetStats().Bytes < Total);
+
+    Cache.SetBudget(1);
+    Cache.Flush();
+    const OctaneGUI::TextureCache::Stats Stats = Cache.GetStats();
+    return WasUnloaded(CheckID) && Stats.Bytes == 0 && Stats.Textures == 0 && Stats.Evictions == 3;
+})
+
+TEST_CASE(AtlasBudget,
+{
+    UnloadRecorder Recorder(Application);
+
+    OctaneGUI::TextureCache Cache;
+    std::shared_ptr<OctaneGUI::Texture> Small = Cache.Load("Resources/thumbs_up.png");
+    std::shared_ptr<OctaneGUI::Texture> Icon = Cache.Load("Resources/Check.svg");
+    VERIFY(Small && Small->Atlas() && Small->Atlas() == Icon->Atlas());
+    VERIFY(Cache.GetStats().Bytes == 0 && Cache.GetStats().AtlasBytes > 0);
+
+    // The page counts against the budget but is kept while its textures are in use.
+    Cache.SetBudget(1);
+    Cache.Trim();
+    VERIFY(Cache.GetStats().Evictions == 0 && Cache.Atlas().Pages() == 1);
+
+    // Packing the second image re-uploaded the page, which released its first ID.
+    Unloaded.clear();
+    const uint32_t PageID = Small->GetID();
+    Small = nullptr;
+    Icon = nullptr;
+    VERIFYF(Unloaded.empty(), "The cache should keep unused textures alive.");
+
+    Cache.Trim();
+    const OctaneGUI::TextureCache::Stats Stats = Cache.GetStats();
+    VERIFYF(Stats.Evictions == 2 && Stats.Textures == 0, "Expected both packed textures to be evicted.");
+    return Stats.AtlasBytes == 0 && Cache.Atlas().Pages() == 0 && WasUnloaded(PageID);
+})
+
+TEST_CASE(Unlimited,
+{
+    OctaneGUI::TextureCache Cache;
+    Cache.SetAtlasMaxSize(0);
+    Cache.SetBudget(0);
+    Cache.Load("Resources/info.png");
+    Cache.Flush();
+    return Cache.Cache().size() == 1 && Cache.GetStats().Evictions == 0;
+})
+
+)
+
+}
@@ -0,0 +1,230 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+namespace Tests
+{
+
+static std::vector<OctaneGUI::OnEmptySignature> Counters(std::vector<int>& Counts)
+{
+    std::vector<OctaneGUI::OnEmptySignature> Result;
+    for (size_t I = 0; I < Counts.size(); I++)
+    {
+        Result.push_back([&Counts, I]() -> void
+            {
+                Counts[I]++;
+            });
+    }
+    return Result;
+}
+
+static bool RanOnce(const std::vector<int>& Counts)
+{
+    for (int Count : Counts)
+    {
+        if (Count != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_SUITE(ThreadPool,
+
+TEST_CASE(RunsAll,
+{
+    OctaneGUI::ThreadPool Pool;
+    Pool.SetThreads(3);
+
+    std::vector<int> Counts(100, 0);
+    Pool.Run(Counters(Counts));
+    VERIFYF(RanOnce(Counts), "Every task should run exactly once.");
+
+    // The pool is reused for following batches.
+    std::vector<int> Again(10, 0);
+    Pool.Run(Counters(Again));
+    return RanOnce(Again);
+})
+
+TEST_CASE(NoThreads,
+{
+    OctaneGUI::ThreadPool Pool;
+    Pool.SetThreads(0);
+
+    std::vector<std::thread::id> IDs;
+    std::vector<OctaneGUI::OnEmptySignature> Tasks;
+    for (int I = 0; I < 4; I++)
+    {
+        Tasks.push_back([&IDs]() -> void
+            {
+                IDs.push_back(std::this_thread::get_id());
+            });
+    }
+    Pool.Run(Tasks);
+
+    VERIFYF(IDs.size() == 4, "Expected 4 tasks to run but %zu ran.", IDs.size());
+    for (const std::thread::id& ID : IDs)
+    {
+        VERIFYF(ID == std::this_thread::get_id(), "Task did not run on the calling thread.");
+    }
+
+    return true;
+})
+
+TEST_CASE(Nested,
+{
+    OctaneGUI::ThreadPool Pool;
+    Pool.SetThreads(2);
+
+    std::atomic<int> Count { 0 };
+    std::vector<OctaneGUI::OnEmptySignature> Inner;
+    for (int I = 0; I < 4; I++)
+    {
+        Inner.push_back([&Count]() -> void
+            {
+                Count++;
+            });
+    }
+
+    std::vector<OctaneGUI::OnEmptySignature> Outer;
+    for (int I = 0; I < 4; I++)
+    {
+        Outer.push_back([&Pool, &Inner]() -> void
+            {
+                Pool.Run(Inner);
+            });
+    }
+    Pool.Run(Outer);
+
+    return Count == 16;
+})
+
+TEST_CASE(Submit,
+{
+    OctaneGUI::ThreadPool Pool;
+    Pool.SetThreads(2);
+
+    std::atomic<int> Count { 0 };
+    std::atomic<bool> Worker { false };
+    const std::thread::id Caller = std::this_thread::get_id();
+    for (int I = 0; I < 8; I++)
+    {
+        Pool.Submit([&]() -> void
+            {
+                Count++;
+                Worker = Worker || std::this_thread::get_id() != Caller;
+            });
+    }
+
+    // Queued jobs are finished before the workers are stopped.
+    Pool.SetThreads(0);
+    VERIFYF(Count == 8, "Expected 8 jobs to run but %d ran.", Count.load());
+    VERIFYF(Worker, "Jobs should run on the worker threads.");
+
+    // Without any threads for batches, jobs are still given a worker.
+    std::atomic<bool> Done { false };
+    Worker = false;
+    Pool.Submit([&]() -> void
+        {
+            Worker = std::this_thread::get_id() != Caller;
+            Done = true;
+        });
+    while (!Done)
+    {
+        std::this_thread::yield();
+    }
+    return Worker;
+})
+
+TEST_CASE(SubmitWhileStopping,
+{
+    std::atomic<int> Count { 0 };
+    std::atomic<bool> Stopping { false };
+    std::function<void(int)> Chain;
+    {
+        OctaneGUI::ThreadPool Pool;
+        Pool.SetThreads(2);
+
+        // Each job submits the next one while the pool is being destroyed.
+        Chain = [&](int Remaining) -> void
+        {
+            Count++;
+            if (Remaining > 0)
+            {
+                Pool.Submit([&Chain, Remaining]() -> void
+                    {
+                        Chain(Remaining - 1);
+                    });
+            }
+        };
+
+        Pool.Submit([&]() -> void
+            {
+                while (!Stopping)
+                {
+                    std::this_thread::yield();
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                Chain(16);
+            });
+        Stopping = true;
+    }
+
+    return Count == 17;
+})
+
+TEST_CASE(SubmitWithBatch,
+{
+    OctaneGUI::ThreadPool Pool;
+    Pool.SetThreads(2);
+
+    std::atomic<bool> Release { false };
+    Pool.Submit([&Release]() -> void
+        {
+            while (!Release)
+            {
+                std::this_thread::yield();
+            }
+        });
+
+    // A batch still finishes while a worker is held by a job.
+    std::vector<int> Counts(32, 0);
+    Pool.Run(Counters(Counts));
+    Release = true;
+    return RanOnce(Counts);
+})
+
+)
+
+}
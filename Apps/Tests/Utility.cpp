@@ -27,6 +27,7 @@ SOFTWARE.
 #include "OctaneGUI/OctaneGUI.h"
 #include "TestSuite.h"
 
+#include <cstring>
 #include <sstream>
 
 namespace Tests
@@ -118,5 +119,43 @@ bool ContextMenu(OctaneGUI::Application& Application, const std::shared_ptr<Octa
     return Opened && Selected;
 }
 
+template <typename T>
+static bool SameValues(const std::vector<T>& A, const std::vector<T>& B)
+{
+    return A.size() == B.size() && std::memcmp(A.data(), B.data(), A.size() * sizeof(T)) == 0;
+}
+
+bool SameBuffers(const OctaneGUI::VertexBuffer& A, const OctaneGUI::VertexBuffer& B)
+{
+    if (A.Commands().size() != B.Commands().size())
+    {
+        return false;
+    }
+
+    for (size_t I = 0; I < A.Commands().size(); I++)
+    {
+        const OctaneGUI::DrawCommand& Left = A.Commands()[I];
+        const OctaneGUI::DrawCommand& Right = B.Commands()[I];
+        if (Left.VertexOffset() != Right.VertexOffset() || Left.IndexOffset() != Right.IndexOffset()
+            || Left.IndexCount() != Right.IndexCount() || Left.TextureID() != Right.TextureID() || !(Left.Clip() == Right.Clip()))
+        {
+            return false;
+        }
+    }
+
+    return SameValues(A.GetIndices(), B.GetIndices())
+        && SameValues(A.GetCompactIndices(), B.GetCompactIndices())
+        && SameValues(A.GetVertices(), B.GetVertices())
+        && SameValues(A.GetCompactVertices(), B.GetCompactVertices());
+}
+
+uint32_t PaintedVertices(OctaneGUI::Application& Application)
+{
+    Application.GetMainWindow()->Update();
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Application.GetMainWindow()->GetRootContainer()->OnPaint(Brush);
+    return Brush.GetBuffer().GetVertexCount();
+}
+
 }
 }
@@ -26,6 +26,7 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace OctaneGUI
@@ -33,6 +34,7 @@ namespace OctaneGUI
 class Application;
 class Control;
 class ControlList;
+class VertexBuffer;
 }
 
 namespace Tests
@@ -50,6 +52,8 @@ void MouseRelease(OctaneGUI::Application& Application, const OctaneGUI::Vector2&
 void MouseClick(OctaneGUI::Application& Application, const OctaneGUI::Vector2& Position, OctaneGUI::Mouse::Button Button = OctaneGUI::Mouse::Button::Left);
 void TextEvent(OctaneGUI::Application& Application, const std::u32string& Text);
 bool ContextMenu(OctaneGUI::Application& Application, const std::shared_ptr<OctaneGUI::Control>& Control);
+bool SameBuffers(const OctaneGUI::VertexBuffer& A, const OctaneGUI::VertexBuffer& B);
+uint32_t PaintedVertices(OctaneGUI::Application& Application);
 
 }
 }
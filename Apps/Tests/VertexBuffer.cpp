@@ -0,0 +1,241 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+#include "Utility.h"
+
+#include <cmath>
+
+namespace Tests
+{
+
+static void PaintFirst(OctaneGUI::Paint& Brush, const std::shared_ptr<OctaneGUI::Font>& Font)
+{
+    Brush.Rectangle(OctaneGUI::Rect(0.0f, 0.0f, 100.0f, 20.0f), OctaneGUI::Color::White);
+    Brush.RectangleRounded(OctaneGUI::Rect(10.0f, 10.0f, 90.0f, 40.0f), OctaneGUI::Color::Black, OctaneGUI::Rect(4.0f, 4.0f, 4.0f, 4.0f));
+    Brush.Text(Font, OctaneGUI::Vector2(5.0f, 50.0f), U"Compact vertices", OctaneGUI::Color::White);
+}
+
+static void PaintSecond(OctaneGUI::Paint& Brush, const std::shared_ptr<OctaneGUI::Font>& Font)
+{
+    Brush.Circle(OctaneGUI::Vector2(50.0f, 50.0f), 10.0f, OctaneGUI::Color::White);
+    Brush.Text(Font, OctaneGUI::Vector2(5.0f, 80.0f), U"Second line", OctaneGUI::Color::Black);
+}
+
+static void PaintScene(OctaneGUI::Paint& Brush, const std::shared_ptr<OctaneGUI::Font>& Font)
+{
+    PaintFirst(Brush, Font);
+    PaintSecond(Brush, Font);
+}
+
+// Paints the second half of the scene into a segment and appends it.
+static bool SegmentMatches(OctaneGUI::Application& Application, bool Compact)
+{
+    const std::shared_ptr<OctaneGUI::Font> Font = Application.GetTheme()->GetFont();
+    OctaneGUI::Paint Serial(Application.GetTheme());
+    Serial.SetCompact(Compact);
+    Serial.PushClip(OctaneGUI::Rect(0.0f, 0.0f, 80.0f, 200.0f));
+    PaintScene(Serial, Font);
+
+    OctaneGUI::Paint Stitched(Application.GetTheme());
+    Stitched.SetCompact(Compact);
+    Stitched.PushClip(OctaneGUI::Rect(0.0f, 0.0f, 80.0f, 200.0f));
+    PaintFirst(Stitched, Font);
+    const std::unique_ptr<OctaneGUI::Paint> Segment = Stitched.CreateSegment();
+    PaintSecond(*Segment, Font);
+    Stitched.AppendSegment(*Segment);
+
+    return Utility::SameBuffers(Serial.GetBuffer(), Stitched.GetBuffer());
+}
+
+// Compares the vertices drawn by both buffers in the order they are drawn.
+static bool Matches(const OctaneGUI::VertexBuffer& Regular, const OctaneGUI::VertexBuffer& Compact)
+{
+    std::vector<OctaneGUI::Vertex> Drawn;
+    for (const OctaneGUI::DrawCommand& Command : Regular.Commands())
+    {
+        for (uint32_t I = 0; I < Command.IndexCount(); I++)
+        {
+            Drawn.push_back(Regular.GetVertices()[Command.VertexOffset() + Regular.GetIndices()[Command.IndexOffset() + I]]);
+        }
+    }
+
+    size_t Index = 0;
+    for (const OctaneGUI::DrawCommand& Command : Compact.Commands())
+    {
+        for (uint32_t I = 0; I < Command.IndexCount(); I++, Index++)
+        {
+            const OctaneGUI::CompactVertex& Item = Compact.GetCompactVertices()[Command.VertexOffset() + Compact.GetCompactIndices()[Command.IndexOffset() + I]];
+            const OctaneGUI::Vector2 UV = Item.TexCoords();
+            if (Index >= Drawn.size() || Drawn[Index].Position != Item.Position || Drawn[Index].Col != Item.Col
+                || std::abs(Drawn[Index].TexCoords.X - UV.X) > 1e-4f || std::abs(Drawn[Index].TexCoords.Y - UV.Y) > 1e-4f)
+            {
+                return false;
+            }
+        }
+    }
+
+    return Index == Drawn.size();
+}
+
+// Verifies that every command only addresses vertices that exist.
+static bool InRange(const OctaneGUI::VertexBuffer& Buffer)
+{
+    for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
+    {
+        for (uint32_t I = 0; I < Command.IndexCount(); I++)
+        {
+            if (Command.VertexOffset() + Buffer.GetCompactIndices()[Command.IndexOffset() + I] >= Buffer.GetVertexCount())
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Adds a quad followed by a triangle whose last index addresses a vertex far past the
+// start of its command. The triangle is merged with the quad when it is pushed.
+static void AddFarTriangle(OctaneGUI::VertexBuffer& Buffer)
+{
+    Buffer.PushCommand(6, 0, OctaneGUI::Rect());
+    for (uint32_t I = 0; I < 4; I++)
+    {
+        Buffer.AddVertex(OctaneGUI::Vector2((float)I, 0.0f), OctaneGUI::Color::White);
+    }
+    for (uint32_t Index : { 0, 1, 2, 0, 2, 3 })
+    {
+        Buffer.AddIndex(Index);
+    }
+
+    Buffer.PushCommand(3, 0, OctaneGUI::Rect());
+    for (uint32_t I = 0; I < OctaneGUI::VertexBuffer::CompactMaxVertices; I++)
+    {
+        Buffer.AddVertex(OctaneGUI::Vector2((float)I, 1.0f), OctaneGUI::Color::White);
+    }
+    for (uint32_t Index : { 0u, 1u, OctaneGUI::VertexBuffer::CompactMaxVertices - 1 })
+    {
+        Buffer.AddIndex(Index);
+    }
+}
+
+TEST_SUITE(VertexBuffer,
+
+TEST_CASE(Compact,
+{
+    OctaneGUI::Paint Regular(Application.GetTheme());
+    PaintScene(Regular, Application.GetTheme()->GetFont());
+
+    OctaneGUI::Paint Compact(Application.GetTheme());
+    Compact.SetCompact(true);
+    PaintScene(Compact, Application.GetTheme()->GetFont());
+
+    const OctaneGUI::VertexBuffer& A = Regular.GetBuffer();
+    const OctaneGUI::VertexBuffer& B = Compact.GetBuffer();
+    VERIFY(!A.IsCompact() && B.IsCompact());
+    VERIFY(B.GetVertices().empty() && B.GetIndices().empty());
+    VERIFYF(Matches(A, B), "Compact buffer draws different vertices.");
+    VERIFYF(B.GetByteSize() * 4 < A.GetByteSize() * 3, "Compact buffer is %zu bytes, regular is %zu bytes.", B.GetByteSize(), A.GetByteSize());
+    return true;
+})
+
+TEST_CASE(LongText,
+{
+    const std::u32string Contents(20000, U'x');
+
+    OctaneGUI::Paint Regular(Application.GetTheme());
+    Regular.Text(Application.GetTheme()->GetFont(), OctaneGUI::Vector2(), Contents, OctaneGUI::Color::White);
+
+    OctaneGUI::Paint Compact(Application.GetTheme());
+    Compact.SetCompact(true);
+    Compact.Text(Application.GetTheme()->GetFont(), OctaneGUI::Vector2(), Contents, OctaneGUI::Color::White);
+
+    // The regular buffer merges the run into one command while the compact buffer must
+    // split it so that every index fits into 16 bits.
+    const OctaneGUI::VertexBuffer& B = Compact.GetBuffer();
+    VERIFY(Regular.GetBuffer().Commands().size() == 1);
+    VERIFYF(B.Commands().size() == 2, "Expected 2 commands but found %zu.", B.Commands().size());
+    return InRange(B) && Matches(Regular.GetBuffer(), B);
+})
+
+TEST_CASE(CompactMerge,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.SetCompact(true);
+    for (int I = 0; I < 20000; I++)
+    {
+        Brush.Rectangle(OctaneGUI::Rect(0.0f, 0.0f, 1.0f, 1.0f), OctaneGUI::Color::White);
+    }
+
+    // Merged rectangles stop once a command would address more than 65536 vertices.
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.Commands().size() == 2);
+    return InRange(Buffer) && Buffer.GetVertexCount() == 80000;
+})
+
+TEST_CASE(CompactSplit,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    Buffer.SetCompact(true);
+    AddFarTriangle(Buffer);
+
+    // The triangle no longer fits into the merged command, so it is moved into its own.
+    const std::vector<OctaneGUI::DrawCommand>& Commands = Buffer.Commands();
+    VERIFYF(Commands.size() == 2, "Expected 2 commands but found %zu.", Commands.size());
+    VERIFY(Commands[0].IndexCount() == 6 && Commands[1].IndexCount() == 3);
+    VERIFY(Commands[1].VertexOffset() == 4 && Commands[1].IndexOffset() == 6);
+
+    const OctaneGUI::CompactVertex& Last = Buffer.GetCompactVertices()[Commands[1].VertexOffset() + Buffer.GetCompactIndices()[8]];
+    return InRange(Buffer) && Last.Position == OctaneGUI::Vector2((float)(OctaneGUI::VertexBuffer::CompactMaxVertices - 1), 1.0f);
+})
+
+TEST_CASE(AppendSegment,
+{
+    VERIFYF(SegmentMatches(Application, false), "Appended segment differs from painting serially.");
+    VERIFYF(SegmentMatches(Application, true), "Appended compact segment differs from painting serially.");
+    return true;
+})
+
+TEST_CASE(AppendMerge,
+{
+    OctaneGUI::Paint Brush(Application.GetTheme());
+    Brush.Rectangle(OctaneGUI::Rect(0.0f, 0.0f, 10.0f, 10.0f), OctaneGUI::Color::White);
+
+    const std::unique_ptr<OctaneGUI::Paint> Segment = Brush.CreateSegment();
+    Segment->Rectangle(OctaneGUI::Rect(10.0f, 0.0f, 20.0f, 10.0f), OctaneGUI::Color::White);
+    Brush.AppendSegment(*Segment);
+
+    // The segment's rectangle continues the previous command with rebased indices.
+    const OctaneGUI::VertexBuffer& Buffer = Brush.GetBuffer();
+    VERIFY(Buffer.Commands().size() == 1);
+    return Buffer.GetIndices().size() == 12 && Buffer.GetIndices()[6] == 4;
+})
+
+)
+
+}
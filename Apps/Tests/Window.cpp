@@ -0,0 +1,259 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <map>
+#include <sstream>
+
+namespace Tests
+{
+
+typedef std::map<std::string, std::vector<OctaneGUI::Vertex>> WindowVertices;
+
+static WindowVertices PaintWindows(OctaneGUI::Application& Application, unsigned int Threads)
+{
+    WindowVertices Result;
+    Application.GetThreadPool().SetThreads(Threads);
+    Application.SetOnPaint([&Result](OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer) -> void
+        {
+            Result[Window->ID()] = Buffer.GetVertices();
+        });
+
+    for (const char* ID : { "Main", "Parallel1", "Parallel2" })
+    {
+        Application.GetWindow(ID)->Repaint();
+    }
+    Application.Update();
+
+    Application.SetOnPaint([](OctaneGUI::Window*, const OctaneGUI::VertexBuffer&) -> void {});
+    return Result;
+}
+
+static bool SameVertices(const std::vector<OctaneGUI::Vertex>& A, const std::vector<OctaneGUI::Vertex>& B)
+{
+    if (A.size() != B.size())
+    {
+        return false;
+    }
+
+    for (size_t I = 0; I < A.size(); I++)
+    {
+        if (!(A[I].Position == B[I].Position) || !(A[I].TexCoords == B[I].TexCoords) || !(A[I].Col == B[I].Col))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void WaitForLoad(OctaneGUI::Application& Application, const bool& Loaded)
+{
+    OctaneGUI::Clock Clock;
+    while (!Loaded && Clock.MeasureMS() < 5000)
+    {
+        Application.GetMainWindow()->Update();
+    }
+}
+
+TEST_SUITE(Window,
+
+TEST_CASE(LoadAsync,
+{
+    bool Loaded = false;
+    bool Success = false;
+    bool Found = false;
+    Application.GetMainWindow()->LoadAsync(R"({"Width": 1280, "Height": 720, "Body": {"Controls": [
+        {"ID": "Text", "Type": "Text", "Text": "Hello"},
+        {"ID": "Container", "Type": "VerticalContainer", "Controls": [{"ID": "Button", "Type": "TextButton"}]}]}})",
+        [&](OctaneGUI::Window&, OctaneGUI::ControlList& List, bool Result) -> void
+        {
+            Loaded = true;
+            Success = Result;
+            Found = List.Contains("Text") && List.Contains("Container") && List.Contains("Container.Button");
+        });
+
+    VERIFY(Application.GetMainWindow()->IsLoading());
+    WaitForLoad(Application, Loaded);
+    VERIFYF(Loaded && Success, "Window failed to load asynchronously.");
+    VERIFYF(Found, "Loaded controls were not found in the control list.");
+    return !Application.GetMainWindow()->IsLoading();
+})
+
+TEST_CASE(LoadAsyncBudget,
+{
+    std::stringstream Stream;
+    Stream << "{\"Body\": {\"Controls\": [";
+    for (int I = 0; I < 500; I++)
+    {
+        Stream << (I > 0 ? "," : "") << "{\"ID\": \"Text" << I << "\", \"Type\": \"Text\", \"Text\": \"Item\"}";
+    }
+    Stream << "]}}";
+
+    bool Loaded = false;
+    size_t Count = 0;
+    Application.GetMainWindow()->LoadAsync(Stream.str().c_str(),
+        [&](OctaneGUI::Window& Window, OctaneGUI::ControlList&, bool) -> void
+        {
+            Loaded = true;
+            Count = Window.GetContainer()->NumControls();
+        }, 1);
+
+    WaitForLoad(Application, Loaded);
+    VERIFYF(Loaded, "Window failed to load asynchronously.");
+    VERIFYF(Count == 500, "Expected 500 controls but found %zu.", Count);
+    return true;
+})
+
+TEST_CASE(LoadAsyncInvalid,
+{
+    bool Loaded = false;
+    bool Success = true;
+    Application.GetMainWindow()->LoadAsync(R"({"Body": {"Controls": [{"ID": "Text", "Text": "Missing type"}]}})",
+        [&](OctaneGUI::Window&, OctaneGUI::ControlList&, bool Result) -> void
+        {
+            Loaded = true;
+            Success = Result;
+        });
+
+    WaitForLoad(Application, Loaded);
+    VERIFYF(Loaded && !Success, "Invalid control description was not reported.");
+
+    Loaded = false;
+    Success = true;
+    Application.GetMainWindow()->LoadAsync(R"({"Body": {"Controls": [)",
+        [&](OctaneGUI::Window&, OctaneGUI::ControlList&, bool Result) -> void
+        {
+            Loaded = true;
+            Success = Result;
+        });
+
+    WaitForLoad(Application, Loaded);
+    VERIFYF(Loaded && !Success, "Malformed JSON was not reported.");
+    return Application.GetMainWindow()->GetContainer()->NumControls() == 0;
+})
+
+TEST_CASE(LoadAsyncCancel,
+{
+    bool Loaded = false;
+    Application.GetMainWindow()->LoadAsync(R"({"Body": {"Controls": [{"Type": "Text", "Text": "Hello"}]}})",
+        [&](OctaneGUI::Window&, OctaneGUI::ControlList&, bool) -> void
+        {
+            Loaded = true;
+        });
+
+    Application.GetMainWindow()->Clear();
+    Application.GetMainWindow()->Update();
+    return !Loaded && !Application.GetMainWindow()->IsLoading();
+})
+
+TEST_CASE(LoadAsyncReplace,
+{
+    std::stringstream Stream;
+    Stream << "{\"Body\": {\"Controls\": [";
+    for (int I = 0; I < 20000; I++)
+    {
+        Stream << (I > 0 ? "," : "") << "{\"Type\": \"Text\", \"Text\": \"Item\"}";
+    }
+    Stream << "]}}";
+
+    // The first load is abandoned while it is still parsing. Its result is discarded.
+    bool Cancelled = false;
+    Application.GetMainWindow()->LoadAsync(Stream.str().c_str(),
+        [&](OctaneGUI::Window&, OctaneGUI::ControlList&, bool) -> void
+        {
+            Cancelled = true;
+        });
+
+    bool Loaded = false;
+    Application.GetMainWindow()->LoadAsync(R"({"Body": {"Controls": [{"Type": "Text", "Text": "Hello"}]}})",
+        [&](OctaneGUI::Window&, OctaneGUI::ControlList&, bool) -> void
+        {
+            Loaded = true;
+        });
+
+    WaitForLoad(Application, Loaded);
+    VERIFYF(Loaded && !Cancelled, "The replaced load was not discarded.");
+    return Application.GetMainWindow()->GetContainer()->NumControls() == 1;
+})
+
+TEST_CASE(TimerStopInCallback,
+{
+    int Count = 0;
+    std::shared_ptr<OctaneGUI::Timer> Timer;
+    Timer = Application.GetMainWindow()->CreateTimer(0, true, [&]() -> void
+        {
+            Count++;
+            if (Count == 3)
+            {
+                Timer->Stop();
+            }
+        });
+    Timer->Start();
+
+    for (int I = 0; I < 10; I++)
+    {
+        Application.GetMainWindow()->Update();
+    }
+
+    return Count == 3;
+})
+
+TEST_CASE(ParallelPaint,
+{
+    const char* Json = R"({"Width": 640, "Height": 480, "Body": {"Controls": [
+        {"Type": "TextButton", "Text": {"Text": "Button"}},
+        {"Type": "CheckBox", "Text": {"Text": "Check"}},
+        {"Type": "Text", "Text": "Some text to tessellate"}]}})";
+    Application.GetMainWindow()->Clear();
+    Application.NewWindow("Parallel1", Json);
+    Application.NewWindow("Parallel2", Json);
+    Application.DisplayWindow("Parallel1");
+    Application.DisplayWindow("Parallel2");
+
+    const unsigned int Threads = Application.GetThreadPool().Threads();
+    const WindowVertices Serial = PaintWindows(Application, 0);
+    const WindowVertices Parallel = PaintWindows(Application, 2);
+    Application.GetThreadPool().SetThreads(Threads);
+    Application.CloseWindow("Parallel1");
+    Application.CloseWindow("Parallel2");
+
+    VERIFYF(Serial.size() == 3, "Expected 3 painted windows but %zu were painted.", Serial.size());
+    VERIFYF(Parallel.size() == Serial.size(), "Parallel painting submitted %zu windows.", Parallel.size());
+    for (const std::pair<const std::string, std::vector<OctaneGUI::Vertex>>& Item : Serial)
+    {
+        VERIFYF(!Item.second.empty(), "Window '%s' did not paint anything.", Item.first.c_str());
+        VERIFYF(Parallel.count(Item.first) == 1 && SameVertices(Item.second, Parallel.at(Item.first)), "Window '%s' painted differently in parallel.", Item.first.c_str());
+    }
+
+    return true;
+})
+
+)
+
+}
@@ -0,0 +1,160 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <thread>
+
+namespace Tests
+{
+
+static const int Producers = 4;
+static const int PostsPerProducer = 1000;
+
+// Each producer posts increasing values, which must be seen in the same order.
+static bool PostFromThreads(OctaneGUI::WorkQueue& Queue)
+{
+    std::vector<int> Last(Producers, -1);
+    bool InOrder = true;
+
+    std::vector<std::thread> Threads;
+    for (int Producer = 0; Producer < Producers; Producer++)
+    {
+        Threads.emplace_back([&Queue, &Last, &InOrder, Producer]() -> void
+            {
+                for (int I = 0; I < PostsPerProducer; I++)
+                {
+                    Queue.Push([&Last, &InOrder, Producer, I]() -> void
+                        {
+                            InOrder = InOrder && Last[Producer] == I - 1;
+                            Last[Producer] = I;
+                        });
+                }
+            });
+    }
+
+    size_t Processed = 0;
+    OctaneGUI::Clock Clock;
+    while (Processed < (size_t)(Producers * PostsPerProducer) && Clock.MeasureMS() < 5000)
+    {
+        Processed += Queue.Drain(std::chrono::microseconds(0));
+    }
+
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    return InOrder && Processed == (size_t)(Producers * PostsPerProducer);
+}
+
+TEST_SUITE(WorkQueue,
+
+TEST_CASE(Order,
+{
+    OctaneGUI::WorkQueue Queue;
+    std::vector<int> Values;
+    for (int I = 0; I < 5; I++)
+    {
+        Queue.Push([&Values, I]() -> void
+            {
+                Values.push_back(I);
+            });
+    }
+
+    VERIFY(Queue.Depth() == 5);
+    VERIFY(Queue.Drain(std::chrono::microseconds(0)) == 5);
+    VERIFY(Queue.Drain(std::chrono::microseconds(0)) == 0);
+    return Values == std::vector<int>({ 0, 1, 2, 3, 4 }) && Queue.Depth() == 0;
+})
+
+TEST_CASE(Producers,
+{
+    OctaneGUI::WorkQueue Queue;
+    VERIFYF(PostFromThreads(Queue), "Posts from multiple threads were lost or reordered.");
+
+    const OctaneGUI::WorkQueue::Stats Stats = Queue.GetStats();
+    return Stats.Pushed == Stats.Processed && Stats.Depth == 0 && Stats.MaxLatency >= Stats.AverageLatency;
+})
+
+TEST_CASE(Budget,
+{
+    OctaneGUI::WorkQueue Queue;
+    int Count = 0;
+    for (int I = 0; I < 3; I++)
+    {
+        Queue.Push([&Count]() -> void
+            {
+                Count++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            });
+    }
+
+    // Every callback exceeds the budget, so only one runs per drain.
+    VERIFY(Queue.Drain(std::chrono::microseconds(1000)) == 1);
+    VERIFY(Queue.Drain(std::chrono::microseconds(1000)) == 1);
+    VERIFY(Queue.Drain(std::chrono::microseconds(1000)) == 1);
+    return Count == 3 && Queue.GetStats().Deferred == 2;
+})
+
+TEST_CASE(Post,
+{
+    bool Posted = false;
+    std::thread Worker([&Application, &Posted]() -> void
+        {
+            Application.Post([&Posted]() -> void
+                {
+                    Posted = true;
+                });
+        });
+    Worker.join();
+
+    VERIFYF(!Posted, "Posted callback should wait for Update.");
+    Application.Update();
+    return Posted;
+})
+
+TEST_CASE(PostToWindow,
+{
+    OctaneGUI::Window* Found = nullptr;
+    bool Missing = false;
+    Application.PostToWindow("Main", [&Found](OctaneGUI::Window* Window) -> void
+        {
+            Found = Window;
+        });
+    Application.PostToWindow("Missing", [&Missing](OctaneGUI::Window*) -> void
+        {
+            Missing = true;
+        });
+
+    Application.Update();
+    return Found == Application.GetMainWindow().get() && !Missing;
+})
+
+)
+
+}
@@ -116,6 +116,11 @@ uint32_t OnLoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_
     return Rendering::LoadTexture(Data, Width, Height);
 }
 
+void OnUnloadTexture(uint32_t ID)
+{
+    Rendering::UnloadTexture(ID);
+}
+
 void OnExit()
 {
     Rendering::Exit();
@@ -166,11 +171,13 @@ void Initialize(OctaneGUI::Application& Application)
     Rendering::Initialize();
 
     Application
+        .SetCompactVertices(Rendering::SupportsCompactVertices())
         .SetOnWindowAction(OnWindowAction)
         .SetOnNewFrame(OnNewFrame)
         .SetOnEvent(OnEvent)
         .SetOnPaint(OnPaint)
         .SetOnLoadTexture(OnLoadTexture)
+        .SetOnUnloadTexture(OnUnloadTexture)
         .SetOnExit(OnExit)
         .SetOnSetClipboardContents(OnSetClipboardContents)
         .SetOnGetClipboardContents(OnGetClipboardContents)
@@ -447,6 +447,23 @@ uint32_t LoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t
 	return g_Textures.back().ID;
 }
 
+bool SupportsCompactVertices()
+{
+	return false;
+}
+
+void UnloadTexture(uint32_t ID)
+{
+	for (std::vector<TextureID>::iterator It = g_Textures.begin(); It != g_Textures.end(); ++It)
+	{
+		if (It->ID == ID)
+		{
+			g_Textures.erase(It);
+			break;
+		}
+	}
+}
+
 void Exit()
 {
 	g_Textures.clear();
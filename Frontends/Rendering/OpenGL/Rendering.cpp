@@ -43,6 +43,7 @@ SOFTWARE.
     #include "GL/glext.h"
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <unordered_map>
 #include <vector>
@@ -361,18 +362,34 @@ void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
     glEnableVertexAttribArray(g_AttribPosition);
     glEnableVertexAttribArray(g_AttribUV);
     glEnableVertexAttribArray(g_AttribColor);
-    glVertexAttribPointer(g_AttribPosition, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, Position));
-    glVertexAttribPointer(g_AttribUV, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, TexCoords));
-    glVertexAttribPointer(g_AttribColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, Col));
 
-    const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
-    const std::vector<uint32_t>& Indices = Buffer.GetIndices();
+    GLenum IndexType = GL_UNSIGNED_INT;
+    size_t IndexSize = sizeof(uint32_t);
+    if (Buffer.IsCompact())
+    {
+        glVertexAttribPointer(g_AttribPosition, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::CompactVertex), (GLvoid*)offsetof(OctaneGUI::CompactVertex, Position));
+        glVertexAttribPointer(g_AttribUV, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(OctaneGUI::CompactVertex), (GLvoid*)offsetof(OctaneGUI::CompactVertex, U));
+        glVertexAttribPointer(g_AttribColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(OctaneGUI::CompactVertex), (GLvoid*)offsetof(OctaneGUI::CompactVertex, Col));
 
-    const GLsizeiptr VertexBufferSize = (GLsizeiptr)(Vertices.size() * sizeof(OctaneGUI::Vertex));
-    const GLsizeiptr IndexBufferSize = (GLsizeiptr)(Indices.size() * sizeof(uint32_t));
+        const std::vector<OctaneGUI::CompactVertex>& Vertices = Buffer.GetCompactVertices();
+        const std::vector<uint16_t>& Indices = Buffer.GetCompactIndices();
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(Vertices.size() * sizeof(OctaneGUI::CompactVertex)), Vertices.data(), GL_STREAM_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(Indices.size() * sizeof(uint16_t)), Indices.data(), GL_STREAM_DRAW);
 
-    glBufferData(GL_ARRAY_BUFFER, VertexBufferSize, Vertices.data(), GL_STREAM_DRAW);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, IndexBufferSize, Indices.data(), GL_STREAM_DRAW);
+        IndexType = GL_UNSIGNED_SHORT;
+        IndexSize = sizeof(uint16_t);
+    }
+    else
+    {
+        glVertexAttribPointer(g_AttribPosition, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, Position));
+        glVertexAttribPointer(g_AttribUV, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, TexCoords));
+        glVertexAttribPointer(g_AttribColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, Col));
+
+        const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
+        const std::vector<uint32_t>& Indices = Buffer.GetIndices();
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(Vertices.size() * sizeof(OctaneGUI::Vertex)), Vertices.data(), GL_STREAM_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(Indices.size() * sizeof(uint32_t)), Indices.data(), GL_STREAM_DRAW);
+    }
 
     for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
     {
@@ -393,7 +410,7 @@ void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
             glBindTexture(GL_TEXTURE_2D, Command.TextureID());
         }
 
-        glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)Command.IndexCount(), GL_UNSIGNED_INT, (void*)(Command.IndexOffset() * sizeof(uint32_t)), (GLint)Command.VertexOffset());
+        glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)Command.IndexCount(), IndexType, (void*)(Command.IndexOffset() * IndexSize), (GLint)Command.VertexOffset());
     }
 
     glDeleteVertexArrays(1, &VertexArrayObject);
@@ -421,6 +438,24 @@ uint32_t LoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t
     return Texture;
 }
 
+bool SupportsCompactVertices()
+{
+    return true;
+}
+
+void UnloadTexture(uint32_t ID)
+{
+    // Textures released after Exit have already been deleted with the rest.
+    const std::vector<GLuint>::iterator It = std::find(g_Textures.begin(), g_Textures.end(), (GLuint)ID);
+    if (It == g_Textures.end())
+    {
+        return;
+    }
+
+    glDeleteTextures(1, &*It);
+    g_Textures.erase(It);
+}
+
 void Exit()
 {
     if (g_VertexBuffer != 0)
@@ -128,6 +128,24 @@ uint32_t LoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t
     return Result;
 }
 
+bool SupportsCompactVertices()
+{
+    // Vertices are converted to SFML's format on the CPU, so a smaller format saves nothing.
+    return false;
+}
+
+void UnloadTexture(uint32_t ID)
+{
+    for (std::vector<std::unique_ptr<sf::Texture>>::iterator It = g_Textures.begin(); It != g_Textures.end(); ++It)
+    {
+        if ((*It)->getNativeHandle() == ID)
+        {
+            g_Textures.erase(It);
+            break;
+        }
+    }
+}
+
 void Exit()
 {
     g_Textures.clear();
@@ -26,10 +26,12 @@ SOFTWARE.
 
 #include "Application.h"
 #include "Assert.h"
+#include "AssetCache.h"
 #include "Controls/Container.h"
 #include "Controls/ControlList.h"
 #include "Controls/WindowContainer.h"
 #include "Event.h"
+#include "FrameCapture.h"
 #include "Icons.h"
 #include "Json.h"
 #include "Paint.h"
@@ -45,6 +47,8 @@ SOFTWARE.
 
 #include <algorithm>
 #include <chrono>
+#include <cstdio>
+#include <filesystem>
 #include <sstream>
 #include <thread>
 
@@ -70,17 +74,21 @@ Application::~Application()
 
 bool Application::Initialize(const char* JsonStream, std::unordered_map<std::string, ControlList>& WindowControls)
 {
-    if (!Initialize())
-    {
-        Shutdown();
-        return false;
-    }
-
     bool IsError { false };
     const Json Root = Json::Parse(JsonStream, IsError);
     if (IsError)
     {
         printf("Error attempting to parse Json stream: '%s'\n", Root["Error"].String());
+        return false;
+    }
+
+    return Initialize(Root, WindowControls);
+}
+
+bool Application::Initialize(const Json& Root, std::unordered_map<std::string, ControlList>& WindowControls)
+{
+    if (!Initialize())
+    {
         Shutdown();
         return false;
     }
@@ -101,6 +109,11 @@ bool Application::Initialize(const char* JsonStream, std::unordered_map<std::str
     m_HighDPI = Root["HighDPI"].Boolean(m_HighDPI);
     m_CustomTitleBar = Root["CustomTitleBar"].Boolean(m_CustomTitleBar);
 
+    if (Root["CacheDirectory"].IsString())
+    {
+        AssetCache::SetDirectory(Root["CacheDirectory"].String());
+    }
+
     // First, create and load base settings for each defined window.
     Windows.ForEach([&](const std::string& Key, const Json& Value) -> void
         {
@@ -127,6 +140,8 @@ bool Application::Initialize(const char* JsonStream, std::unordered_map<std::str
         LoadIcons(IconsObject);
     }
 
+    // The theme's font is needed to lay out the first frame, so it is baked here while
+    // the icons are rasterized on the asset loader's workers.
     m_Theme->Load(Root["Theme"]);
     Assert(m_Theme->GetFont() != nullptr, "No font loaded with theme!");
 
@@ -156,11 +171,37 @@ bool Application::Initialize(const char* JsonStream, std::unordered_map<std::str
     m_Tools = std::make_shared<Tools::Interface>();
 #endif // TOOLS
 
+    const std::string RecordPath { m_CommandLine.Get("--record") };
+    if (!RecordPath.empty())
+    {
+        StartRecording(RecordPath.c_str());
+    }
+
+    const std::string ReplayPath { m_CommandLine.Get("--replay") };
+    if (!ReplayPath.empty())
+    {
+        const EventPlayer::Speed Speed_ { m_CommandLine.Get("--replay-speed") == "max" ? EventPlayer::Speed::Max : EventPlayer::Speed::Recorded };
+        if (!Replay(ReplayPath.c_str(), Speed_, [this]() -> void
+                {
+                    Quit();
+                }))
+        {
+            printf("Failed to load replay '%s'.\n", ReplayPath.c_str());
+        }
+    }
+
     return true;
 }
 
 void Application::Shutdown()
 {
+    m_Recorder.reset();
+    m_Player.reset();
+
+    if (IsCapturing())
+    {
+        StopCapture();
+    }
     m_LanguageServer.Shutdown();
     m_Network.Shutdown();
 
@@ -183,6 +224,29 @@ void Application::Shutdown()
 void Application::Update()
 {
     m_LanguageServer.Process();
+    m_FileSystem.ProcessWatches();
+
+    if (m_Posts.Depth() > 0)
+    {
+        PROFILER_SAMPLE("Application::Posts");
+        [[maybe_unused]] const size_t Processed = m_Posts.Drain(m_PostBudget);
+        PROFILER_COUNTER(Posts, Processed);
+    }
+
+    // Uploaded assets may replace placeholders anywhere, so every window is repainted.
+    if (m_AssetLoader.Process() > 0)
+    {
+        for (auto& Item : m_Windows)
+        {
+            Item.second->Repaint();
+        }
+    }
+
+    // Task results are handed back through Post, this only retires finished work.
+    m_TaskLoader.Process();
+
+    // Images packed while processing are uploaded with a single upload per atlas page.
+    m_TextureCache.Flush();
 
     for (auto& Item : m_Windows)
     {
@@ -192,15 +256,57 @@ void Application::Update()
         }
     }
 
+    std::vector<Window*> Repaint;
     for (auto& Item : m_Windows)
     {
-        if (Item.second->IsVisible())
+        if (Item.second->IsVisible() && Item.second->NeedsRepaint())
+        {
+            Repaint.push_back(Item.second.get());
+        }
+    }
+
+    if (Repaint.size() > 1 && m_ThreadPool.Threads() > 0)
+    {
+        PROFILER_SAMPLE_GROUP("Application::Tessellate");
+
+        std::vector<std::unique_ptr<Paint>> Brushes;
+        std::vector<OnEmptySignature> Tasks;
+        for (Window* Item : Repaint)
+        {
+            Brushes.push_back(std::make_unique<Paint>(m_Theme));
+            Brushes.back()->SetCompact(m_CompactVertices);
+            Tasks.push_back([Item, Brush = Brushes.back().get()]() -> void
+                {
+                    Item->Tessellate(*Brush);
+                });
+        }
+
+        m_ThreadPool.Run(Tasks);
+
+        // Frontends are not thread-safe, so submission stays on this thread and in order.
+        for (size_t I = 0; I < Repaint.size(); I++)
+        {
+            Repaint[I]->Submit(*Brushes[I]);
+        }
+    }
+    else
+    {
+        // A single window may still split its large subtrees across the pool.
+        for (Window* Item : Repaint)
         {
             Paint Brush(m_Theme);
-            Item.second->DoPaint(Brush);
+            Brush.SetCompact(m_CompactVertices);
+            Brush.SetThreadPool(&m_ThreadPool);
+            Item->DoPaint(Brush);
         }
     }
 
+    if (m_IdleScheduler.Pending() > 0)
+    {
+        PROFILER_SAMPLE("Application::Idle");
+        m_IdleScheduler.Run(m_IdleBudget);
+    }
+
     for (auto& Item : m_Windows)
     {
         if (Item.second->ShouldClose())
@@ -218,10 +324,12 @@ int Application::Run()
         {
             const int EventsProcessed { RunFrame() };
 
-            if (EventsProcessed <= 0)
+            // Replaying at full speed should not wait on events that will never come.
+            const bool FastReplay { m_Player && m_Player->GetSpeed() == EventPlayer::Speed::Max };
+            if (EventsProcessed <= 0 && m_Posts.Depth() == 0 && m_IdleScheduler.Pending() == 0 && !FastReplay)
             {
                 PROFILER_SAMPLE("Sleep");
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                WaitForPosts(std::chrono::milliseconds(10));
             }
         }
     }
@@ -239,6 +347,16 @@ int Application::RunFrame()
 
     PROFILER_FRAME();
 
+    if (m_Recorder)
+    {
+        m_Recorder->BeginFrame();
+    }
+
+    if (m_Player)
+    {
+        m_Player->BeginFrame();
+    }
+
     if (m_OnNewFrame)
     {
         m_OnNewFrame();
@@ -268,6 +386,18 @@ int Application::RunFrame()
 
     Update();
 
+    if (m_Player && m_Player->IsFinished())
+    {
+        m_Player.reset();
+
+        if (m_OnReplayFinished)
+        {
+            OnEmptySignature OnFinished { std::move(m_OnReplayFinished) };
+            m_OnReplayFinished = nullptr;
+            OnFinished();
+        }
+    }
+
     return EventsProcessed;
 }
 
@@ -461,6 +591,168 @@ TextureCache& Application::GetTextureCache()
     return m_TextureCache;
 }
 
+AssetLoader& Application::GetAssetLoader()
+{
+    return m_AssetLoader;
+}
+
+AssetLoader& Application::GetTaskLoader()
+{
+    return m_TaskLoader;
+}
+
+ThreadPool& Application::GetThreadPool()
+{
+    return m_ThreadPool;
+}
+
+void Application::Post(OnEmptySignature&& Fn)
+{
+    m_Posts.Push(std::move(Fn));
+    Wake();
+}
+
+void Application::PostToWindow(const char* ID, OnWindowSignature&& Fn)
+{
+    Post([this, Name = std::string(ID), Fn = std::move(Fn)]() -> void
+        {
+            const auto It = m_Windows.find(Name);
+            if (It != m_Windows.end() && !It->second->ShouldClose())
+            {
+                Fn(It->second.get());
+            }
+        });
+}
+
+Application& Application::SetPostBudget(std::chrono::microseconds Budget)
+{
+    m_PostBudget = Budget;
+    return *this;
+}
+
+std::chrono::microseconds Application::PostBudget() const
+{
+    return m_PostBudget;
+}
+
+WorkQueue::Stats Application::GetPostStats() const
+{
+    return m_Posts.GetStats();
+}
+
+IdleScheduler::TaskID Application::AddIdleTask(IdleScheduler::OnStepSignature&& Fn, IdleScheduler::Priority Priority_)
+{
+    return m_IdleScheduler.Add(std::move(Fn), Priority_);
+}
+
+bool Application::CancelIdleTask(IdleScheduler::TaskID ID)
+{
+    return m_IdleScheduler.Cancel(ID);
+}
+
+Application& Application::SetIdleBudget(std::chrono::microseconds Budget)
+{
+    m_IdleBudget = Budget;
+    return *this;
+}
+
+std::chrono::microseconds Application::IdleBudget() const
+{
+    return m_IdleBudget;
+}
+
+IdleScheduler& Application::GetIdleScheduler()
+{
+    return m_IdleScheduler;
+}
+
+Application& Application::SetCompactVertices(bool Compact)
+{
+    m_CompactVertices = Compact;
+    return *this;
+}
+
+bool Application::CompactVertices() const
+{
+    return m_CompactVertices;
+}
+
+bool Application::StartRecording(const char* Path)
+{
+    m_Recorder = std::make_unique<EventRecorder>();
+    if (!m_Recorder->Open(Path))
+    {
+        m_Recorder.reset();
+        return false;
+    }
+
+    return true;
+}
+
+void Application::StopRecording()
+{
+    m_Recorder.reset();
+}
+
+bool Application::IsRecording() const
+{
+    return m_Recorder != nullptr;
+}
+
+bool Application::Replay(const char* Path, EventPlayer::Speed Speed_, OnEmptySignature&& OnFinished)
+{
+    m_Player = std::make_unique<EventPlayer>();
+    if (!m_Player->Load(Path))
+    {
+        m_Player.reset();
+        return false;
+    }
+
+    m_Player->SetSpeed(Speed_);
+    m_OnReplayFinished = std::move(OnFinished);
+    return true;
+}
+
+bool Application::IsReplaying() const
+{
+    return m_Player != nullptr;
+}
+
+bool Application::StartCapture(const char* Directory, uint32_t Frames)
+{
+    // Pixels of textures uploaded before tracking can't be recovered, which would leave
+    // fonts and icons blank when the capture is replayed.
+    if (!FrameCapture::TrackTextures() && FrameCapture::HasUntrackedTextures())
+    {
+        printf("Unable to start capturing as textures have already been uploaded. Pass '--capture <directory>' on the command line instead.\n");
+        return false;
+    }
+
+    std::error_code Error;
+    std::filesystem::create_directories(Directory, Error);
+    if (Error)
+    {
+        return false;
+    }
+
+    m_CaptureDirectory = Directory;
+    m_CaptureRemaining = Frames;
+    m_CaptureCount = 0;
+    FrameCapture::SetTrackTextures(true);
+    return true;
+}
+
+void Application::StopCapture()
+{
+    m_CaptureDirectory.clear();
+    FrameCapture::SetTrackTextures(false);
+}
+
+bool Application::IsCapturing() const
+{
+    return !m_CaptureDirectory.empty();
+}
+
 bool Application::IsKeyPressed(Keyboard::Key Key) const
 {
     return std::find(m_PressedKeys.begin(), m_PressedKeys.end(), Key) != m_PressedKeys.end();
@@ -625,6 +917,14 @@ Application& Application::SetOnLoadTexture(OnLoadTextureSignature&& Fn)
     return *this;
 }
 
+Application& Application::SetOnUnloadTexture(OnUnloadTextureSignature&& Fn)
+{
+    // Textures can be released while the application's members are destroyed, so the
+    // callback is handed to Texture directly instead of going through this object.
+    Texture::SetOnUnload(std::move(Fn));
+    return *this;
+}
+
 Application& Application::SetOnExit(OnEmptySignature&& Fn)
 {
     m_OnExit = std::move(Fn);
@@ -669,6 +969,20 @@ Application& Application::SetOnCreateControl(OnCreateControlSignature&& Fn)
 
 void Application::OnPaint(Window* InWindow, const VertexBuffer& Buffers)
 {
+    if (IsCapturing())
+    {
+        char Name[32] {};
+        std::snprintf(Name, sizeof(Name), "_%06llu", (unsigned long long)m_CaptureCount);
+        const std::string Path = (std::filesystem::path(m_CaptureDirectory) / (std::string(InWindow->ID()) + Name + FrameCapture::Extension)).string();
+        FrameCapture::Save(Path.c_str(), InWindow->ID(), m_CaptureCount, InWindow->GetSize(), InWindow->RenderScale(), Buffers);
+        m_CaptureCount++;
+
+        if (m_CaptureRemaining > 0 && --m_CaptureRemaining == 0)
+        {
+            StopCapture();
+        }
+    }
+
     if (m_OnPaint)
     {
         m_OnPaint(InWindow, Buffers);
@@ -695,6 +1009,7 @@ void Application::DestroyWindow(const std::shared_ptr<Window>& Item)
     }
 
     OnWindowAction(Item.get(), WindowAction::Destroy);
+    m_IdleScheduler.CancelOwner(Item.get());
 
     Item
         ->SetVisible(false)
@@ -750,7 +1065,20 @@ int Application::ProcessEvent(const std::shared_ptr<Window>& Item)
     }
 
     int Processed = 0;
-    Event E = m_OnEvent(Item.get());
+    Event E { Event::Type::None };
+    if (m_Player && m_Player->HasNext(Item->ID()))
+    {
+        E = m_Player->Next(Item->ID());
+    }
+    else
+    {
+        E = m_OnEvent(Item.get());
+
+        if (m_Recorder && E.GetType() != Event::Type::None)
+        {
+            m_Recorder->Record(Item->ID(), E);
+        }
+    }
 
 #if TOOLS
     if (!m_Modals.empty() && !m_IgnoreModals)
@@ -887,6 +1215,15 @@ bool Application::Initialize()
             }
         });
 
+    m_TextureCache.SetLoader(&m_AssetLoader);
+
+    // Started before any textures are loaded so that their pixels can be captured.
+    const std::string CaptureDirectory { m_CommandLine.Get("--capture") };
+    if (!CaptureDirectory.empty())
+    {
+        StartCapture(CaptureDirectory.c_str(), (uint32_t)std::max<int>(m_CommandLine.GetInt("--capture-frames"), 0));
+    }
+
     m_IsRunning = true;
 
     return true;
@@ -919,7 +1256,7 @@ void Application::LoadIcons(const Json& Root)
             Definitions.push_back({ Item["Type"].String(), Item["FileName"].String() });
         }
 
-        m_Icons->Initialize(Definitions, IconSize);
+        m_Icons->Initialize(Definitions, IconSize, m_AssetLoader);
     }
 }
 
@@ -949,4 +1286,21 @@ std::shared_ptr<Window> Application::FocusedWindow() const
     return GetMainWindow();
 }
 
+void Application::Wake()
+{
+    std::lock_guard<std::mutex> Lock { m_WakeMutex };
+    m_Woken = true;
+    m_Wake.notify_one();
+}
+
+void Application::WaitForPosts(std::chrono::milliseconds Timeout)
+{
+    std::unique_lock<std::mutex> Lock { m_WakeMutex };
+    m_Wake.wait_for(Lock, Timeout, [this]() -> bool
+        {
+            return m_Woken;
+        });
+    m_Woken = false;
+}
+
 }
@@ -26,18 +26,27 @@ SOFTWARE.
 
 #pragma once
 
+#include "AssetLoader.h"
 #include "CallbackDefs.h"
 #include "CommandLine.h"
+#include "EventPlayer.h"
+#include "EventRecorder.h"
 #include "FileSystem.h"
+#include "IdleScheduler.h"
 #include "Keyboard.h"
 #include "LanguageServer.h"
 #include "Mouse.h"
 #include "Network.h"
 #include "SystemInfo.h"
 #include "TextureCache.h"
+#include "ThreadPool.h"
 #include "Vector2.h"
+#include "WorkQueue.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -92,6 +101,7 @@ public:
     typedef std::function<Event(Window*)> OnWindowEventSignature;
     typedef std::function<void(Window*, WindowAction)> OnWindowActionSignature;
     typedef std::function<uint32_t(const std::vector<uint8_t>&, uint32_t, uint32_t)> OnLoadTextureSignature;
+    typedef std::function<void(uint32_t)> OnUnloadTextureSignature;
     typedef std::function<void(const std::u32string&)> OnSetClipboardContentsSignature;
     typedef std::function<std::u32string(void)> OnGetClipboardContentsSignature;
     typedef std::function<void(Window*, const char32_t*)> OnSetWindowTitleSignature;
@@ -128,6 +138,18 @@ public:
     /// @return True if initialized successfully. False otherwise.
     bool Initialize(const char* JsonStream, std::unordered_map<std::string, ControlList>& WindowControls);
 
+    /// @brief Initializes the application with an already loaded JSON object.
+    ///
+    /// This allows applications to load their description from other sources, such as a
+    /// binary layout created with Json::ToBinary. See the stream version of Initialize
+    /// for the expected properties.
+    ///
+    /// @param Root The JSON object describing the application.
+    /// @param WindowControls List of controls that has a defined 'ID' property within their JSON
+    /// description for any defined window.
+    /// @return True if initialized successfully. False otherwise.
+    bool Initialize(const Json& Root, std::unordered_map<std::string, ControlList>& WindowControls);
+
     /// @brief Destroy all existing windows and cleans up any used resources.
     ///
     /// This function can be called manually, but is also called automatically when the
@@ -245,6 +267,120 @@ public:
     /// @return TextureCache reference.
     TextureCache& GetTextureCache();
 
+    /// @brief Retrieves the AssetLoader used to decode textures and icons on the thread pool.
+    /// Completed assets are uploaded during Update.
+    /// @return AssetLoader reference.
+    AssetLoader& GetAssetLoader();
+
+    /// @brief Retrieves the AssetLoader used to run the work of Tasks::Run. This shares the
+    /// thread pool with the asset loader but retires its jobs separately.
+    /// @return AssetLoader reference.
+    AssetLoader& GetTaskLoader();
+
+    /// @brief Retrieves the ThreadPool that all of the application's background work runs on.
+    ///
+    /// When more than one window needs to be repainted during Update, each window is
+    /// painted into its own VertexBuffer on this pool. The buffers are then handed to
+    /// the frontend one at a time on the calling thread. A single window instead paints
+    /// its large child subtrees on this pool, see Paint::SetThreadPool. Assets, tasks,
+    /// asynchronous window loads and file dialog listings are submitted to it as jobs.
+    ///
+    /// @return ThreadPool reference.
+    ThreadPool& GetThreadPool();
+
+    /// @brief Queues a callback to be invoked on the UI thread during Update.
+    ///
+    /// This is safe to call from any thread and is how worker threads should hand results
+    /// back to controls. Callbacks are invoked in the order they were posted and a blocked
+    /// Run loop is woken up to process them.
+    ///
+    /// @param Fn The callback to invoke.
+    void Post(OnEmptySignature&& Fn);
+
+    /// @brief Same as Post, but the callback is given the window with the given ID. The
+    /// callback is dropped if the window no longer exists or is closing.
+    void PostToWindow(const char* ID, OnWindowSignature&& Fn);
+
+    /// @brief Sets how long Update may spend invoking posted callbacks each frame. Any
+    /// remaining callbacks are invoked in the following frames so that input is still
+    /// processed. A budget of 0 invokes every posted callback.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetPostBudget(std::chrono::microseconds Budget);
+    std::chrono::microseconds PostBudget() const;
+
+    /// @brief Queue depth, throughput and latency of posted callbacks.
+    WorkQueue::Stats GetPostStats() const;
+
+    /// @brief Schedules work that is performed a step at a time after each Update.
+    ///
+    /// Steps are invoked until the idle budget is spent, so expensive work can be spread
+    /// across frames without blocking input. Run does not sleep while tasks are pending.
+    ///
+    /// @param Fn Performs a step and returns true once the task is finished.
+    /// @param Priority_ Tasks with a higher priority are stepped first.
+    /// @return The ID of the task, which can be given to CancelIdleTask.
+    IdleScheduler::TaskID AddIdleTask(IdleScheduler::OnStepSignature&& Fn, IdleScheduler::Priority Priority_ = IdleScheduler::Priority::Normal);
+    bool CancelIdleTask(IdleScheduler::TaskID ID);
+
+    /// @brief Sets how long idle tasks may run each frame.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetIdleBudget(std::chrono::microseconds Budget);
+    std::chrono::microseconds IdleBudget() const;
+    IdleScheduler& GetIdleScheduler();
+
+    /// @brief Paints windows into compact vertex buffers with 16-bit indices.
+    ///
+    /// Frontends enable this when their renderer can read CompactVertex and 16-bit
+    /// indices, which reduces the data uploaded every frame.
+    ///
+    /// @param Compact True to use the compact format.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetCompactVertices(bool Compact);
+    bool CompactVertices() const;
+
+    /// @brief Writes every event processed by each window to the given file.
+    ///
+    /// Recording can also be started by passing '--record <path>' on the command line.
+    ///
+    /// @param Path Location of the file to write to.
+    /// @return True if the file was opened.
+    bool StartRecording(const char* Path);
+    void StopRecording();
+    bool IsRecording() const;
+
+    /// @brief Feeds the events of a recording made with StartRecording to the windows
+    /// instead of the events from the frontend.
+    ///
+    /// Replaying at EventPlayer::Speed::Max delivers the recorded events frame by frame
+    /// without waiting, which allows recorded sessions to be used as repeatable benchmarks
+    /// and UI tests. Replay can also be started by passing '--replay <path>' and optionally
+    /// '--replay-speed max' on the command line, in which case the application quits when
+    /// the replay finishes.
+    ///
+    /// @param Path Location of the recording.
+    /// @param Speed_ How fast the events are delivered.
+    /// @param OnFinished Invoked once every recorded event has been delivered.
+    /// @return True if the recording was loaded.
+    bool Replay(const char* Path, EventPlayer::Speed Speed_ = EventPlayer::Speed::Recorded, OnEmptySignature&& OnFinished = nullptr);
+    bool IsReplaying() const;
+
+    /// @brief Saves the vertex buffer submitted by each window to a file in the given
+    /// directory, along with the pixels of the textures it references.
+    ///
+    /// The files can be rendered again with the FrameReplay tool to benchmark renderers
+    /// without running the application. Only the pixels of textures uploaded after capturing
+    /// was started can be saved, so capturing must start before any texture is uploaded by
+    /// passing '--capture <directory>' and optionally '--capture-frames <count>' on the
+    /// command line.
+    ///
+    /// @param Directory Location to save the captures to. It is created if needed.
+    /// @param Frames Number of buffers to save before stopping. 0 captures until StopCapture.
+    /// @return True if capturing was started. This is false once textures have been
+    /// uploaded without being tracked.
+    bool StartCapture(const char* Directory, uint32_t Frames = 0);
+    void StopCapture();
+    bool IsCapturing() const;
+
     /// @cond !IGNORE_FUNCTIONS
     /// @brief Used internally.
     bool IsKeyPressed(Keyboard::Key Key) const;
@@ -380,6 +516,17 @@ public:
     /// @return The Application object to allow for chaining methods.
     Application& SetOnLoadTexture(OnLoadTextureSignature&& Fn);
 
+    /// @brief Request for the frontend to release a texture.
+    ///
+    /// This callback is invoked with the ID returned by the OnLoadTexture callback
+    /// once the library no longer references the texture. It may still be invoked
+    /// after the OnExit callback for textures that outlive the application, so
+    /// frontends should ignore IDs they have already released.
+    ///
+    /// @param Fn The OnUnloadTextureSignature callback.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetOnUnloadTexture(OnUnloadTextureSignature&& Fn);
+
     /// @brief Callback invoked when the application is exiting.
     ///
     /// This is a good time for the frontend to cleanup any allocated
@@ -436,6 +583,8 @@ private:
     void LoadIcons(const Json& Root);
     void FocusWindow(const std::shared_ptr<Window>& Focus);
     std::shared_ptr<Window> FocusedWindow() const;
+    void Wake();
+    void WaitForPosts(std::chrono::milliseconds Timeout);
 
     CommandLine m_CommandLine {};
     std::unordered_map<std::string, std::shared_ptr<Window>> m_Windows;
@@ -445,10 +594,24 @@ private:
     std::shared_ptr<Icons> m_Icons { nullptr };
     bool m_IsRunning { false };
     std::vector<Keyboard::Key> m_PressedKeys {};
+    // Declared before the loaders so that workers finishing during shutdown can still post.
+    WorkQueue m_Posts {};
+    std::chrono::microseconds m_PostBudget { 2000 };
+    std::mutex m_WakeMutex {};
+    std::condition_variable m_Wake {};
+    bool m_Woken { false };
+    IdleScheduler m_IdleScheduler {};
+    std::chrono::microseconds m_IdleBudget { 4000 };
     TextureCache m_TextureCache {};
     FileSystem m_FileSystem { *this };
+    // Declared after everything jobs may use so that the loaders cancel their jobs and the
+    // pool finishes the running ones before anything else is destroyed.
+    ThreadPool m_ThreadPool {};
+    AssetLoader m_AssetLoader { m_ThreadPool };
+    AssetLoader m_TaskLoader { m_ThreadPool };
     bool m_HighDPI { true };
     bool m_CustomTitleBar { false };
+    bool m_CompactVertices { false };
     LanguageServer m_LanguageServer {};
     Network m_Network {};
     // Moving these members to be outside of the TOOLS declaration to prevent different class layouts.
@@ -456,6 +619,12 @@ private:
     bool m_IgnoreModals { false };
     std::shared_ptr<Tools::Interface> m_Tools { nullptr };
     SystemInfo m_SystemInfo {};
+    std::unique_ptr<EventRecorder> m_Recorder { nullptr };
+    std::unique_ptr<EventPlayer> m_Player { nullptr };
+    OnEmptySignature m_OnReplayFinished { nullptr };
+    std::string m_CaptureDirectory {};
+    uint32_t m_CaptureRemaining { 0 };
+    uint64_t m_CaptureCount { 0 };
 
     OnWindowActionSignature m_OnWindowAction { nullptr };
     OnWindowPaintSignature m_OnPaint { nullptr };
@@ -0,0 +1,250 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "AssetCache.h"
+#include "MappedFile.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace OctaneGUI
+{
+
+// Bump whenever the layout of an entry or the data stored by one of the users changes.
+static constexpr uint32_t Version = 1;
+static constexpr char Magic[4] = { 'O', 'G', 'A', 'C' };
+static constexpr const char* Extension = ".ogac";
+
+struct Header
+{
+    char Magic[4];
+    uint32_t Version;
+    uint64_t Key;
+    uint32_t Width;
+    uint32_t Height;
+    uint32_t MetadataSize;
+    uint32_t PixelsSize;
+};
+
+static uint64_t Mix(uint64_t Value)
+{
+    Value += 0x9E3779B97F4A7C15ull;
+    Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+    return Value ^ (Value >> 31);
+}
+
+std::string AssetCache::s_Directory {};
+
+AssetCache::Key::Key()
+{
+    Add(Version);
+}
+
+AssetCache::Key::Key(const char* Tag)
+    : Key()
+{
+    Add(Tag);
+}
+
+AssetCache::Key& AssetCache::Key::Add(const void* Data, size_t Size)
+{
+    const uint8_t* Bytes = (const uint8_t*)Data;
+
+    // Mix eight bytes at a time so that hashing a whole font file stays cheap compared
+    // to rasterizing it.
+    size_t Offset = 0;
+    for (; Offset + sizeof(uint64_t) <= Size; Offset += sizeof(uint64_t))
+    {
+        uint64_t Word = 0;
+        memcpy(&Word, Bytes + Offset, sizeof(Word));
+        m_Value = Mix(m_Value ^ Word);
+    }
+
+    uint64_t Tail = 0;
+    memcpy(&Tail, Bytes + Offset, Size - Offset);
+    m_Value = Mix(m_Value ^ Tail ^ ((uint64_t)Size << 56));
+    return *this;
+}
+
+AssetCache::Key& AssetCache::Key::Add(const char* Value)
+{
+    return Add(Value, strlen(Value));
+}
+
+AssetCache::Key& AssetCache::Key::Add(const std::string& Value)
+{
+    return Add(Value.data(), Value.size());
+}
+
+bool AssetCache::Key::AddFile(const char* Path)
+{
+    MappedFile File;
+    if (!File.Open(Path))
+    {
+        return false;
+    }
+
+    Add(File.Data(), File.Size());
+    return true;
+}
+
+uint64_t AssetCache::Key::Value() const
+{
+    return m_Value;
+}
+
+void AssetCache::SetDirectory(const char* Directory)
+{
+    s_Directory = Directory != nullptr ? Directory : "";
+}
+
+const char* AssetCache::Directory()
+{
+    return s_Directory.c_str();
+}
+
+bool AssetCache::Enabled()
+{
+    return !s_Directory.empty();
+}
+
+bool AssetCache::Load(const Key& InKey, Entry& Result)
+{
+    if (!Enabled())
+    {
+        return false;
+    }
+
+    MappedFile File;
+    if (!File.Open(Location(InKey).c_str()) || File.Size() < sizeof(Header))
+    {
+        return false;
+    }
+
+    Header Info {};
+    memcpy(&Info, File.Data(), sizeof(Info));
+    if (memcmp(Info.Magic, Magic, sizeof(Magic)) != 0
+        || Info.Version != Version
+        || Info.Key != InKey.Value()
+        || (uint64_t)Info.Width * Info.Height * 4 != Info.PixelsSize
+        || sizeof(Header) + (uint64_t)Info.MetadataSize + Info.PixelsSize != File.Size())
+    {
+        return false;
+    }
+
+    const uint8_t* Data = (const uint8_t*)File.Data() + sizeof(Header);
+    Result.Width = Info.Width;
+    Result.Height = Info.Height;
+    Result.Metadata.assign(Data, Data + Info.MetadataSize);
+    Data += Info.MetadataSize;
+    Result.Pixels.assign(Data, Data + Info.PixelsSize);
+    return true;
+}
+
+bool AssetCache::Store(const Key& InKey, const Entry& Item)
+{
+    if (!Enabled() || Item.Pixels.size() != (size_t)Item.Width * Item.Height * 4)
+    {
+        return false;
+    }
+
+    std::error_code Error;
+    std::filesystem::create_directories(s_Directory, Error);
+    if (Error)
+    {
+        return false;
+    }
+
+    Header Info {};
+    memcpy(Info.Magic, Magic, sizeof(Magic));
+    Info.Version = Version;
+    Info.Key = InKey.Value();
+    Info.Width = Item.Width;
+    Info.Height = Item.Height;
+    Info.MetadataSize = (uint32_t)Item.Metadata.size();
+    Info.PixelsSize = (uint32_t)Item.Pixels.size();
+
+    // Write to a temporary file first so that another process never maps a partially
+    // written entry.
+    const std::string Path = Location(InKey);
+    const std::string Temporary = Path + ".tmp";
+    {
+        std::ofstream Stream;
+        Stream.open(Temporary, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        if (!Stream.is_open())
+        {
+            return false;
+        }
+
+        Stream.write((const char*)&Info, sizeof(Info));
+        Stream.write((const char*)Item.Metadata.data(), Item.Metadata.size());
+        Stream.write((const char*)Item.Pixels.data(), Item.Pixels.size());
+        if (!Stream.good())
+        {
+            Stream.close();
+            std::filesystem::remove(Temporary, Error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(Temporary, Path, Error);
+    if (Error)
+    {
+        std::filesystem::remove(Temporary, Error);
+        return false;
+    }
+
+    return true;
+}
+
+void AssetCache::Clear()
+{
+    if (!Enabled())
+    {
+        return;
+    }
+
+    std::error_code Error;
+    for (const std::filesystem::directory_entry& Item : std::filesystem::directory_iterator(s_Directory, Error))
+    {
+        if (Item.path().extension() == Extension)
+        {
+            std::filesystem::remove(Item.path(), Error);
+        }
+    }
+}
+
+std::string AssetCache::Location(const Key& InKey)
+{
+    char Name[32] {};
+    std::snprintf(Name, sizeof(Name), "%016llx", (unsigned long long)InKey.Value());
+    return (std::filesystem::path(s_Directory) / (std::string(Name) + Extension)).string();
+}
+
+}
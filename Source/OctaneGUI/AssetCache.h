@@ -0,0 +1,97 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Persistent on-disk cache of rasterized assets.
+///
+/// Entries are content-addressed. The key is a hash of the source file contents and
+/// the parameters used to produce the pixels, so editing a source file or changing
+/// the render scale results in a new entry instead of a stale one. Each entry is a
+/// single file containing the image dimensions, optional metadata and the RGBA pixels.
+/// The cache is disabled until a directory is set.
+class AssetCache
+{
+public:
+    struct Entry
+    {
+        uint32_t Width { 0 };
+        uint32_t Height { 0 };
+        std::vector<uint8_t> Metadata {};
+        std::vector<uint8_t> Pixels {};
+    };
+
+    /// @brief Builds the hash used to identify an entry.
+    class Key
+    {
+    public:
+        Key();
+        Key(const char* Tag);
+
+        Key& Add(const void* Data, size_t Size);
+        Key& Add(const char* Value);
+        Key& Add(const std::string& Value);
+        bool AddFile(const char* Path);
+
+        template <typename T>
+        Key& Add(const T& Value)
+        {
+            static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be added directly to a key.");
+            return Add(&Value, sizeof(T));
+        }
+
+        uint64_t Value() const;
+
+    private:
+        uint64_t m_Value { 0 };
+    };
+
+    static void SetDirectory(const char* Directory);
+    static const char* Directory();
+    static bool Enabled();
+
+    static bool Load(const Key& InKey, Entry& Result);
+    static bool Store(const Key& InKey, const Entry& Item);
+
+    /// @brief Removes every entry in the cache directory.
+    static void Clear();
+
+private:
+    static std::string Location(const Key& InKey);
+
+    static std::string s_Directory;
+};
+
+}
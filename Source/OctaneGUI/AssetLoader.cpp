@@ -0,0 +1,132 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "AssetLoader.h"
+#include "ThreadPool.h"
+
+namespace OctaneGUI
+{
+
+AssetLoader::AssetLoader(ThreadPool& Pool)
+    : m_Pool(Pool)
+    , m_State(std::make_shared<State>())
+{
+}
+
+AssetLoader::~AssetLoader()
+{
+    std::unique_lock<std::mutex> Lock { m_State->Mutex };
+    m_State->Cancelled = true;
+    m_State->Done.wait(Lock, [this]() -> bool
+        {
+            return m_State->Running == 0;
+        });
+}
+
+void AssetLoader::Run(OnEmptySignature&& Work, OnEmptySignature&& Complete)
+{
+    {
+        std::lock_guard<std::mutex> Lock { m_State->Mutex };
+        m_State->Pending++;
+        m_State->Running++;
+    }
+
+    m_Pool.Submit([Item = m_State, Work = std::move(Work), Complete = std::move(Complete)]() mutable -> void
+        {
+            bool Cancelled = false;
+            {
+                std::lock_guard<std::mutex> Lock { Item->Mutex };
+                Cancelled = Item->Cancelled;
+            }
+
+            if (!Cancelled && Work)
+            {
+                Work();
+            }
+
+            {
+                std::lock_guard<std::mutex> Lock { Item->Mutex };
+                Item->Running--;
+                if (!Item->Cancelled)
+                {
+                    Item->Completed.push_back(std::move(Complete));
+                }
+            }
+            Item->Done.notify_all();
+        });
+}
+
+size_t AssetLoader::Process()
+{
+    std::vector<OnEmptySignature> Completed;
+    {
+        std::lock_guard<std::mutex> Lock { m_State->Mutex };
+        if (m_State->Completed.empty())
+        {
+            return 0;
+        }
+
+        Completed.swap(m_State->Completed);
+    }
+
+    // Completions may submit new jobs, so they are invoked outside of the lock and the
+    // pending count is only updated once they have run.
+    for (const OnEmptySignature& Complete : Completed)
+    {
+        if (Complete)
+        {
+            Complete();
+        }
+    }
+
+    std::lock_guard<std::mutex> Lock { m_State->Mutex };
+    m_State->Pending -= Completed.size();
+    return Completed.size();
+}
+
+void AssetLoader::Wait()
+{
+    while (Pending() > 0)
+    {
+        {
+            std::unique_lock<std::mutex> Lock { m_State->Mutex };
+            m_State->Done.wait(Lock, [this]() -> bool
+                {
+                    return !m_State->Completed.empty();
+                });
+        }
+
+        Process();
+    }
+}
+
+size_t AssetLoader::Pending() const
+{
+    std::lock_guard<std::mutex> Lock { m_State->Mutex };
+    return m_State->Pending;
+}
+
+}
@@ -0,0 +1,87 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "CallbackDefs.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class ThreadPool;
+
+/// @brief Runs asset decoding work on the workers of a ThreadPool.
+///
+/// Each job is split into the work, which runs on a worker and must not touch the
+/// renderer or any controls, and a completion, which is invoked on the thread calling
+/// Process. Completions are where textures are uploaded with Texture::Load.
+///
+/// Destroying the loader skips the work of jobs that have not started yet and waits for
+/// the ones that are running.
+class AssetLoader
+{
+public:
+    AssetLoader(ThreadPool& Pool);
+    AssetLoader(const AssetLoader&) = delete;
+    ~AssetLoader();
+
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    void Run(OnEmptySignature&& Work, OnEmptySignature&& Complete);
+
+    /// @brief Invokes the completions of all finished jobs.
+    /// @return The number of completions invoked.
+    size_t Process();
+
+    /// @brief Blocks until every submitted job has finished and its completion has been invoked.
+    void Wait();
+
+    /// @brief Number of jobs whose completion has not been invoked yet.
+    size_t Pending() const;
+
+private:
+    // Shared with the jobs queued on the pool, which may outlive the loader.
+    struct State
+    {
+    public:
+        std::mutex Mutex {};
+        std::condition_variable Done {};
+        std::vector<OnEmptySignature> Completed {};
+        size_t Pending { 0 };
+        size_t Running { 0 };
+        bool Cancelled { false };
+    };
+
+    ThreadPool& m_Pool;
+    std::shared_ptr<State> m_State { nullptr };
+};
+
+}
@@ -29,6 +29,7 @@ SOFTWARE.
 #include "../Json.h"
 #include "../Paint.h"
 #include "../Profiler.h"
+#include "../ThreadPool.h"
 #include "../Window.h"
 #include "Canvas.h"
 #include "CheckBox.h"
@@ -39,8 +40,10 @@ SOFTWARE.
 #include "Image.h"
 #include "ImageButton.h"
 #include "ListBox.h"
+#include "LogView.h"
 #include "MarginContainer.h"
 #include "Panel.h"
+#include "Plot.h"
 #include "RadioButton.h"
 #include "ScrollableContainer.h"
 #include "ScrollableViewControl.h"
@@ -60,6 +63,7 @@ SOFTWARE.
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 
 namespace OctaneGUI
 {
@@ -119,6 +123,10 @@ std::shared_ptr<Control> Container::CreateControl(const std::string& Type)
     {
         Result = AddControl<ListBox>();
     }
+    else if (Type == LogView::TypeName())
+    {
+        Result = AddControl<LogView>();
+    }
     else if (Type == MarginContainer::TypeName())
     {
         Result = AddControl<MarginContainer>();
@@ -127,6 +135,10 @@ std::shared_ptr<Control> Container::CreateControl(const std::string& Type)
     {
         Result = AddControl<Panel>();
     }
+    else if (Type == Plot::TypeName())
+    {
+        Result = AddControl<Plot>();
+    }
     else if (Type == RadioButton::TypeName())
     {
         Result = AddControl<RadioButton>();
@@ -195,6 +207,135 @@ std::shared_ptr<Control> Container::CreateControl(const std::string& Type)
     return Result;
 }
 
+std::shared_ptr<Control> Container::LoadControl(const Json& Root)
+{
+    std::shared_ptr<Control> Result = CreateControl(Root["Type"].String());
+    if (Result)
+    {
+        Result->OnLoad(Root);
+    }
+
+    return Result;
+}
+
+// Compares two control descriptions while ignoring their children.
+static bool SameProperties(const Json& Previous, const Json& Next)
+{
+    if (Previous.Count() - (Previous.Contains("Controls") ? 1 : 0) != Next.Count() - (Next.Contains("Controls") ? 1 : 0))
+    {
+        return false;
+    }
+
+    bool Result = true;
+    Next.ForEach([&](const std::string& Key, const Json& Value) -> void
+        {
+            Result = Result && (Key == "Controls" || (Previous.Contains(Key) && Previous[Key] == Value));
+        });
+
+    return Result;
+}
+
+bool Container::Patch(const Json& Previous, const Json& Next)
+{
+    const Json& PreviousControls = Previous["Controls"];
+    const Json& NextControls = Next["Controls"];
+
+    if (!IsPatchable() || !Previous.IsObject() || !Next.IsObject() || !SameProperties(Previous, Next))
+    {
+        return false;
+    }
+
+    // Children can only be matched if each one was created from the previous description.
+    if (m_Controls.size() != PreviousControls.Count())
+    {
+        return false;
+    }
+
+    for (unsigned int I = 0; I < PreviousControls.Count(); I++)
+    {
+        if (std::string(m_Controls[I]->GetType()) != PreviousControls[I]["Type"].String())
+        {
+            return false;
+        }
+    }
+
+    std::vector<bool> Matched(PreviousControls.Count(), false);
+    std::vector<std::shared_ptr<Control>> Controls;
+    bool Changed = PreviousControls.Count() != NextControls.Count();
+    for (unsigned int I = 0; I < NextControls.Count(); I++)
+    {
+        const Json& Item = NextControls[I];
+        const std::string ID = Item["ID"].String();
+
+        unsigned int Index = PreviousControls.Count();
+        if (ID.empty())
+        {
+            if (I < PreviousControls.Count() && !PreviousControls[I].Contains("ID"))
+            {
+                Index = I;
+            }
+        }
+        else
+        {
+            for (unsigned int J = 0; J < PreviousControls.Count(); J++)
+            {
+                if (!Matched[J] && ID == PreviousControls[J]["ID"].String())
+                {
+                    Index = J;
+                    break;
+                }
+            }
+        }
+
+        if (Index < PreviousControls.Count() && PreviousControls[Index]["Type"] == Item["Type"])
+        {
+            Matched[Index] = true;
+            const std::shared_ptr<Control>& Existing = m_Controls[Index];
+            const std::shared_ptr<Container> ExistingContainer = std::dynamic_pointer_cast<Container>(Existing);
+
+            if (PreviousControls[Index] == Item)
+            {
+                Changed = Changed || Index != I;
+                Controls.push_back(Existing);
+                continue;
+            }
+
+            if (ExistingContainer && ExistingContainer->Patch(PreviousControls[Index], Item))
+            {
+                Changed = Changed || Index != I;
+                Controls.push_back(Existing);
+                continue;
+            }
+        }
+
+        Changed = true;
+        std::shared_ptr<Control> NewControl = LoadControl(Item);
+        if (NewControl)
+        {
+            Controls.push_back(NewControl);
+        }
+    }
+
+    if (!Changed)
+    {
+        return true;
+    }
+
+    const std::vector<std::shared_ptr<Control>> Current = m_Controls;
+    for (const std::shared_ptr<Control>& Item : Current)
+    {
+        if (std::find(Controls.begin(), Controls.end(), Item) == Controls.end())
+        {
+            RemoveControl(Item);
+        }
+    }
+
+    m_Controls = std::move(Controls);
+    Invalidate(InvalidateType::Both);
+
+    return true;
+}
+
 Container* Container::InsertControl(const std::shared_ptr<Control>& Item, int Position)
 {
     if (HasControl(Item))
@@ -293,6 +434,7 @@ bool Container::ShouldClip() const
 Container* Container::Layout()
 {
     PROFILER_SAMPLE_GROUP((std::string(GetType()) + "::Layout").c_str());
+    PROFILER_COUNTER(Layouts, 1);
 
     m_InLayout = true;
 
@@ -337,6 +479,7 @@ std::weak_ptr<Control> Container::GetControl(const Vector2& Point) const
     for (int I = (int)m_Controls.size() - 1; I >= 0; I--)
     {
         const std::shared_ptr<Control>& Item = m_Controls[I];
+        PROFILER_COUNTER(HitTests, 1);
 
         const std::shared_ptr<Container> ItemContainer = std::dynamic_pointer_cast<Container>(Item);
         if (ItemContainer)
@@ -371,6 +514,28 @@ void Container::GetControls(std::vector<std::shared_ptr<Control>>& Controls) con
     }
 }
 
+size_t Container::CountControls(size_t Limit) const
+{
+    size_t Result = 0;
+    for (const std::shared_ptr<Control>& Item : m_Controls)
+    {
+        if (Result >= Limit)
+        {
+            break;
+        }
+
+        Result++;
+
+        const std::shared_ptr<Container> ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        if (ItemContainer)
+        {
+            Result += ItemContainer->CountControls(Limit - Result);
+        }
+    }
+
+    return Result;
+}
+
 Vector2 Container::ChildrenSize() const
 {
     Vector2 Result;
@@ -438,11 +603,14 @@ void Container::OnPaint(Paint& Brush) const
         Brush.PushClip(GetAbsoluteBounds());
     }
 
-    for (const std::shared_ptr<Control>& Item : m_Controls)
+    if (!PaintSubtrees(Brush))
     {
-        if (!Brush.IsClipped(Item->GetAbsoluteBounds()))
+        for (const std::shared_ptr<Control>& Item : m_Controls)
         {
-            Item->OnPaint(Brush);
+            if (!Brush.IsClipped(Item->GetAbsoluteBounds()))
+            {
+                Item->OnPaint(Brush);
+            }
         }
     }
 
@@ -452,6 +620,92 @@ void Container::OnPaint(Paint& Brush) const
     }
 }
 
+bool Container::PaintSubtrees(Paint& Brush) const
+{
+    ThreadPool* Pool = Brush.GetThreadPool();
+    if (Pool == nullptr || Pool->Threads() == 0)
+    {
+        return false;
+    }
+
+    const size_t Threshold = Brush.SubtreeThreshold();
+    std::vector<const Control*> Visible;
+    std::vector<bool> Large;
+    size_t LargeCount = 0;
+    for (const std::shared_ptr<Control>& Item : m_Controls)
+    {
+        if (Brush.IsClipped(Item->GetAbsoluteBounds()))
+        {
+            continue;
+        }
+
+        const std::shared_ptr<Container> ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        const bool IsLarge = ItemContainer && ItemContainer->CountControls(Threshold) >= Threshold;
+        Visible.push_back(Item.get());
+        Large.push_back(IsLarge);
+        LargeCount += IsLarge ? 1 : 0;
+    }
+
+    // With a single large subtree, the split is attempted further down. Small subtrees are
+    // painted without the pool so they are not counted again at every level.
+    if (LargeCount < 2)
+    {
+        for (size_t I = 0; I < Visible.size(); I++)
+        {
+            if (Large[I])
+            {
+                Visible[I]->OnPaint(Brush);
+            }
+            else
+            {
+                Brush.SetThreadPool(nullptr, Threshold);
+                Visible[I]->OnPaint(Brush);
+                Brush.SetThreadPool(Pool, Threshold);
+            }
+        }
+        return true;
+    }
+
+    // Each large subtree and each run of small controls between them is painted into its
+    // own segment, which are appended back in order once every task has finished.
+    std::vector<std::unique_ptr<Paint>> Segments;
+    std::vector<OnEmptySignature> Tasks;
+    size_t Begin = 0;
+    while (Begin < Visible.size())
+    {
+        size_t End = Begin + 1;
+        if (!Large[Begin])
+        {
+            while (End < Visible.size() && !Large[End])
+            {
+                End++;
+            }
+        }
+
+        Segments.push_back(Brush.CreateSegment());
+        Tasks.push_back([&Visible, Begin, End, Segment = Segments.back().get()]() -> void
+            {
+                for (size_t I = Begin; I < End; I++)
+                {
+                    Visible[I]->OnPaint(*Segment);
+                }
+            });
+        Begin = End;
+    }
+
+    {
+        PROFILER_SAMPLE("Container::PaintSubtrees");
+        Pool->Run(Tasks);
+    }
+
+    for (const std::unique_ptr<Paint>& Segment : Segments)
+    {
+        Brush.AppendSegment(*Segment);
+    }
+
+    return true;
+}
+
 void Container::OnLoad(const Json& Root)
 {
     Control::OnLoad(Root);
@@ -460,14 +714,7 @@ void Container::OnLoad(const Json& Root)
 
     for (unsigned int I = 0; I < Controls.Count(); I++)
     {
-        const Json& Item = Controls[I];
-
-        std::string Type = Item["Type"].String();
-        std::shared_ptr<Control> NewControl = CreateControl(Type);
-        if (NewControl)
-        {
-            NewControl->OnLoad(Item);
-        }
+        LoadControl(Controls[I]);
     }
 
     SetClip(Root["Clip"].Boolean(ShouldClip()));
@@ -552,6 +799,11 @@ void Container::PlaceControls(const std::vector<std::shared_ptr<Control>>& Contr
     }
 }
 
+bool Container::IsPatchable() const
+{
+    return std::strcmp(GetType(), TypeName()) == 0;
+}
+
 void Container::OnInsertControl(const std::shared_ptr<Control>&)
 {
 }
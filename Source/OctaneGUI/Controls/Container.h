@@ -29,6 +29,7 @@ SOFTWARE.
 #include "../VertexBuffer.h"
 #include "Control.h"
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -61,6 +62,21 @@ public:
     }
 
     std::shared_ptr<Control> CreateControl(const std::string& Type);
+    std::shared_ptr<Control> LoadControl(const Json& Root);
+
+    /// @brief Updates the child controls to match a new description of this container.
+    ///
+    /// Children in Next are matched to children in Previous by ID, or by position
+    /// for children without an ID. Unchanged children are kept as they are. Changed
+    /// child containers are patched recursively, and other changed children are
+    /// recreated from their description. Children that no longer exist are removed
+    /// and the rest are reordered to match Next.
+    ///
+    /// @param Previous The description this container was last loaded with.
+    /// @param Next The new description of this container.
+    /// @return False if this container could not be patched and must be reloaded. This
+    /// is always the case for containers that are not patchable, see IsPatchable.
+    virtual bool Patch(const Json& Previous, const Json& Next);
     Container* InsertControl(const std::shared_ptr<Control>& Item, int Position = -1);
     Container* RemoveControl(const std::shared_ptr<Control>& Item);
     bool HasControl(const std::shared_ptr<Control>& Item) const;
@@ -93,6 +109,10 @@ public:
     // TODO: Rename to GetAllControls.
     void GetControls(std::vector<std::shared_ptr<Control>>& Controls) const;
     const std::vector<std::shared_ptr<Control>>& Controls() const;
+
+    /// @brief Counts every control in this container's subtree, stopping once Limit is reached.
+    size_t CountControls(size_t Limit = SIZE_MAX) const;
+
     Vector2 ChildrenSize() const;
     virtual void GetControlList(ControlList& List) const;
     virtual Vector2 DesiredSize() const;
@@ -108,11 +128,18 @@ protected:
     void HandleInvalidate(std::shared_ptr<Control> Focus, InvalidateType Type);
 
     virtual void PlaceControls(const std::vector<std::shared_ptr<Control>>& Controls) const;
+
+    /// @brief Whether the children are created one-to-one from the "Controls" description,
+    /// which Patch relies on. Each class must confirm this for itself, so a subclass that
+    /// creates its own children is never patched through an ancestor.
+    virtual bool IsPatchable() const;
     virtual void OnInsertControl(const std::shared_ptr<Control>& Item);
     virtual void OnRemoveControl(const std::shared_ptr<Control>& Item);
     virtual void OnLayoutComplete();
 
 private:
+    bool PaintSubtrees(Paint& Brush) const;
+
     std::vector<std::shared_ptr<Control>> m_Controls;
     bool m_InLayout { false };
     bool m_Clip { false };
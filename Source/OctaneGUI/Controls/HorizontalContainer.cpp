@@ -26,6 +26,8 @@ SOFTWARE.
 
 #include "HorizontalContainer.h"
 
+#include <cstring>
+
 namespace OctaneGUI
 {
 
@@ -34,4 +36,9 @@ HorizontalContainer::HorizontalContainer(Window* InWindow)
 {
 }
 
+bool HorizontalContainer::IsPatchable() const
+{
+    return std::strcmp(GetType(), TypeName()) == 0;
+}
+
 }
@@ -38,6 +38,9 @@ class HorizontalContainer : public BoxContainer
 
 public:
     HorizontalContainer(Window* InWindow);
+
+protected:
+    virtual bool IsPatchable() const override;
 };
 
 }
@@ -55,12 +55,14 @@ Image& Image::SetTexture(const char* Path)
 
     if (!m_Texture)
     {
-        m_Texture = GetWindow()->GetTextureCache().Load(Path);
-
-        if (m_Texture)
-        {
-            SetUVs(Rect(Vector2::Zero, m_Texture->GetSize()));
-        }
+        std::weak_ptr<Image> Weak = TShare<Image>();
+        m_Texture = GetWindow()->GetTextureCache().Load(Path, [Weak](const std::shared_ptr<Texture>& Loaded) -> void
+            {
+                if (std::shared_ptr<Image> This = Weak.lock())
+                {
+                    This->OnTextureLoaded(Loaded);
+                }
+            });
     }
 
     return *this;
@@ -105,6 +107,12 @@ void Image::OnPaint(Paint& Brush) const
         return;
     }
 
+    if (!m_Texture->IsValid())
+    {
+        Brush.Rectangle(GetAbsoluteBounds(), GetProperty(ThemeProperties::Panel).ToColor());
+        return;
+    }
+
     PROFILER_SAMPLE_GROUP("Image::OnPaint");
 
     const Vector2 Size = m_Texture->GetSize();
@@ -156,4 +164,23 @@ bool Image::IsFixedSize() const
     return true;
 }
 
+void Image::OnTextureLoaded(const std::shared_ptr<Texture>& InTexture)
+{
+    // The texture may have been replaced while it was loading.
+    if (m_Texture && InTexture && m_Texture != InTexture)
+    {
+        return;
+    }
+
+    m_Texture = InTexture;
+
+    // Keep any UVs that were assigned while the texture was loading.
+    if (m_Texture && m_UVs.GetSize().IsZero())
+    {
+        SetUVs({ Vector2::Zero, m_Texture->GetSize() });
+    }
+
+    Invalidate();
+}
+
 }
@@ -39,6 +39,8 @@ class Texture;
 /// An Image is displayed through a loaded Texture object. The texture set can
 /// be a standalone texture, or UV coordinates can be defined to only show
 /// part of a texture. The tint of the image can also be set to change the color.
+/// Textures loaded by path may still be decoding, in which case a placeholder is
+/// painted and the image is resized once the texture is ready.
 class Image : public Control
 {
     CLASS(Image)
@@ -62,6 +64,8 @@ protected:
     virtual bool IsFixedSize() const override;
 
 private:
+    void OnTextureLoaded(const std::shared_ptr<Texture>& InTexture);
+
     std::shared_ptr<Texture> m_Texture { nullptr };
     Rect m_UVs {};
     Color m_Tint { Color::White };
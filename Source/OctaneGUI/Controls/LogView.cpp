@@ -0,0 +1,349 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "LogView.h"
+#include "../Application.h"
+#include "../Font.h"
+#include "../Json.h"
+#include "../Paint.h"
+#include "../Profiler.h"
+#include "../String.h"
+#include "../Theme.h"
+#include "../Window.h"
+#include "ScrollableContainer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace OctaneGUI
+{
+
+/// Sized to fit every line so that the scrollable container can scroll through them, but
+/// only paints the lines that are in view.
+class LogViewContent : public Control
+{
+    CLASS(LogViewContent)
+
+public:
+    LogViewContent(Window* InWindow, const LogView* View)
+        : Control(InWindow)
+        , m_View(View)
+    {
+    }
+
+    virtual void OnPaint(Paint& Brush) const override
+    {
+        PROFILER_SAMPLE_GROUP("LogViewContent::OnPaint");
+
+        const std::shared_ptr<Font>& TheFont = m_View->m_Font;
+        if (!TheFont)
+        {
+            return;
+        }
+
+        const float LineHeight = m_View->LineHeight();
+        const Vector2 Position = GetAbsolutePosition();
+        const Color TextColor = m_View->GetProperty(ThemeProperties::Text).ToColor();
+        const size_t First = m_View->FirstVisibleLine();
+        const size_t Last = std::min<size_t>(m_View->Count(), First + m_View->NumVisibleLines());
+        for (size_t I = First; I < Last; I++)
+        {
+            const Vector2 LinePosition { Position.X, Position.Y + (float)I * LineHeight };
+            Brush.Text(TheFont, LinePosition.Floor(), String::ToUTF32(m_View->Line(I)), TextColor);
+        }
+    }
+
+protected:
+    virtual bool IsFixedSize() const override
+    {
+        return true;
+    }
+
+private:
+    const LogView* m_View { nullptr };
+};
+
+LogView::LogView(Window* InWindow)
+    : ScrollableViewControl(InWindow)
+{
+    m_Buffer.SetCapacity(DefaultCapacity);
+    m_Content = Scrollable()->AddControl<LogViewContent>(this);
+
+    if (GetTheme())
+    {
+        UpdateFont();
+    }
+
+    SetSize({ 200.0f, 200.0f });
+}
+
+LogView::~LogView()
+{
+    Batch* Item = m_Pending.exchange(nullptr);
+    while (Item != nullptr)
+    {
+        Batch* Next = Item->Next;
+        delete Item;
+        Item = Next;
+    }
+}
+
+LogView& LogView::Append(std::string_view Text)
+{
+    const bool AtBottom = IsAtBottom();
+    const uint64_t Dropped = m_Buffer.Dropped();
+    const size_t Longest = m_Buffer.LongestLength();
+    const size_t Lines = m_Buffer.Append(Text);
+    Appended(Lines, Dropped, Longest, AtBottom);
+    return *this;
+}
+
+void LogView::AppendAsync(std::string&& Text)
+{
+    Batch* Item = new Batch { std::move(Text), nullptr };
+    Batch* Head = m_Pending.load(std::memory_order_relaxed);
+    do
+    {
+        Item->Next = Head;
+    } while (!m_Pending.compare_exchange_weak(Head, Item, std::memory_order_release, std::memory_order_relaxed));
+
+    // Only the first batch after a flush schedules another one. Later batches are picked
+    // up by the same flush.
+    if (Head == nullptr)
+    {
+        const std::weak_ptr<Control> Weak = weak_from_this();
+        GetWindow()->App().Post([Weak]() -> void
+            {
+                if (std::shared_ptr<Control> View = Weak.lock())
+                {
+                    static_cast<LogView*>(View.get())->Flush();
+                }
+            });
+    }
+}
+
+LogView& LogView::Flush()
+{
+    Batch* Head = m_Pending.exchange(nullptr, std::memory_order_acquire);
+    if (Head == nullptr)
+    {
+        return *this;
+    }
+
+    // Batches are pushed onto the front of the list, so reverse it to append in order.
+    Batch* Ordered = nullptr;
+    while (Head != nullptr)
+    {
+        Batch* Next = Head->Next;
+        Head->Next = Ordered;
+        Ordered = Head;
+        Head = Next;
+    }
+
+    const bool AtBottom = IsAtBottom();
+    const uint64_t Dropped = m_Buffer.Dropped();
+    const size_t Longest = m_Buffer.LongestLength();
+    size_t Lines = 0;
+    while (Ordered != nullptr)
+    {
+        Lines += m_Buffer.Append(Ordered->Text);
+        Batch* Next = Ordered->Next;
+        delete Ordered;
+        Ordered = Next;
+    }
+
+    Appended(Lines, Dropped, Longest, AtBottom);
+    return *this;
+}
+
+LogView& LogView::Clear()
+{
+    m_Buffer.Clear();
+    m_Width = 0.0f;
+    UpdateContentSize();
+    Scrollable()->SetOffset({ 0.0f, 0.0f });
+    Invalidate();
+    return *this;
+}
+
+LogView& LogView::SetCapacity(size_t Lines)
+{
+    const bool AtBottom = IsAtBottom();
+    const uint64_t Dropped = m_Buffer.Dropped();
+    m_Buffer.SetCapacity(Lines);
+    Appended(0, Dropped, m_Buffer.LongestLength(), AtBottom);
+    return *this;
+}
+
+size_t LogView::Capacity() const
+{
+    return m_Buffer.Capacity();
+}
+
+size_t LogView::Count() const
+{
+    return m_Buffer.Count();
+}
+
+std::string_view LogView::Line(size_t Index) const
+{
+    return m_Buffer.Line(Index);
+}
+
+const LogBuffer& LogView::Buffer() const
+{
+    return m_Buffer;
+}
+
+float LogView::LineHeight() const
+{
+    if (!m_Font)
+    {
+        return 0.0f;
+    }
+
+    return m_Font->Size();
+}
+
+size_t LogView::FirstVisibleLine() const
+{
+    const float Height = LineHeight();
+    if (Height <= 0.0f)
+    {
+        return 0;
+    }
+
+    return std::min<size_t>((size_t)(Scrollable()->Offset().Y / Height), Count());
+}
+
+size_t LogView::NumVisibleLines() const
+{
+    const float Height = LineHeight();
+    if (Height <= 0.0f)
+    {
+        return 0;
+    }
+
+    // One extra line for the partially visible line at the bottom.
+    const size_t Lines = (size_t)std::ceil(Scrollable()->GetScrollableSize().Y / Height) + 1;
+    return std::min<size_t>(Lines, Count() - FirstVisibleLine());
+}
+
+bool LogView::IsAtBottom() const
+{
+    return Scrollable()->Offset().Y >= Scrollable()->Overflow().Y - 1.0f;
+}
+
+LogView& LogView::ScrollToBottom()
+{
+    Scrollable()->SetOffset({ Scrollable()->Offset().X, Scrollable()->Overflow().Y });
+    Invalidate();
+    return *this;
+}
+
+void LogView::OnLoad(const Json& Root)
+{
+    Json Copy = Root;
+    Copy["Controls"] = Json();
+
+    Container::OnLoad(Copy);
+
+    SetCapacity((size_t)Root["Capacity"].Number((float)DefaultCapacity));
+
+    if (Root["Text"].IsString())
+    {
+        Append(Root["Text"].String());
+    }
+}
+
+void LogView::OnPaint(Paint& Brush) const
+{
+    PROFILER_SAMPLE_GROUP("LogView::OnPaint");
+
+    Brush.Rectangle(GetAbsoluteBounds(), GetProperty(ThemeProperties::TextInput_Background).ToColor());
+    ScrollableViewControl::OnPaint(Brush);
+}
+
+void LogView::OnThemeLoaded()
+{
+    ScrollableViewControl::OnThemeLoaded();
+
+    UpdateFont();
+
+    // Widths depend on the font, so the longest line is measured again.
+    m_Width = 0.0f;
+    Appended(m_Buffer.Count(), m_Buffer.Dropped(), 0, IsAtBottom());
+}
+
+void LogView::Appended(size_t Lines, uint64_t Dropped, size_t Longest, bool AtBottom)
+{
+    // Lines are only measured when a line longer than any before it was appended.
+    if (m_Font && m_Buffer.LongestLength() > Longest)
+    {
+        for (size_t I = m_Buffer.Count() - std::min<size_t>(Lines, m_Buffer.Count()); I < m_Buffer.Count(); I++)
+        {
+            const std::string_view Item = m_Buffer.Line(I);
+            if (Item.size() == m_Buffer.LongestLength())
+            {
+                m_Width = std::max<float>(m_Width, m_Font->Measure(String::ToUTF32(Item)).X);
+                break;
+            }
+        }
+    }
+
+    UpdateContentSize();
+
+    if (AtBottom)
+    {
+        ScrollToBottom();
+    }
+    else
+    {
+        // Keep the same lines in view when older lines are dropped.
+        const float Removed = (float)(m_Buffer.Dropped() - Dropped) * LineHeight();
+        if (Removed > 0.0f)
+        {
+            Scrollable()->AddOffset({ 0.0f, -Removed });
+        }
+    }
+
+    Invalidate();
+}
+
+void LogView::UpdateFont()
+{
+    const char* FontPath = GetProperty(ThemeProperties::FontPath).String(nullptr);
+    const float FontSize = GetProperty(ThemeProperties::FontSize).Float(LineHeight()) * RenderScale().Y;
+    m_Font = GetTheme()->GetOrAddFont(FontPath, FontSize);
+}
+
+void LogView::UpdateContentSize()
+{
+    m_Content->SetSize({ m_Width, (float)m_Buffer.Count() * LineHeight() });
+    Scrollable()->Update();
+}
+
+}
@@ -0,0 +1,112 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../LogBuffer.h"
+#include "ScrollableViewControl.h"
+
+#include <atomic>
+#include <string>
+#include <string_view>
+
+namespace OctaneGUI
+{
+
+class Font;
+class LogViewContent;
+
+/// @brief Read-only view of a stream of text lines, such as the output of a process.
+///
+/// Lines are kept in a LogBuffer and only the lines within view are painted, so appending
+/// does not depend on how many lines are already displayed. Lines can be appended from any
+/// thread with AppendAsync, which queues them without locking and appends every queued
+/// batch on the UI thread in a single step. While the view is scrolled to the bottom, it
+/// stays at the bottom as lines are appended.
+class LogView : public ScrollableViewControl
+{
+    CLASS(LogView)
+
+public:
+    static constexpr size_t DefaultCapacity = 100000;
+
+    LogView(Window* InWindow);
+    virtual ~LogView();
+
+    /// @brief Appends each line of the given text. Must be called on the UI thread.
+    LogView& Append(std::string_view Text);
+
+    /// @brief Queues text to be appended on the UI thread. Safe to call from any thread
+    /// while this control exists.
+    void AppendAsync(std::string&& Text);
+
+    /// @brief Appends any queued text immediately. Must be called on the UI thread.
+    LogView& Flush();
+
+    LogView& Clear();
+
+    /// @brief Sets the maximum number of lines to keep. 0 keeps every line.
+    LogView& SetCapacity(size_t Lines);
+    size_t Capacity() const;
+
+    size_t Count() const;
+    std::string_view Line(size_t Index) const;
+    const LogBuffer& Buffer() const;
+
+    float LineHeight() const;
+    size_t FirstVisibleLine() const;
+    size_t NumVisibleLines() const;
+
+    /// @brief Whether the view is scrolled to the last line.
+    bool IsAtBottom() const;
+    LogView& ScrollToBottom();
+
+    virtual void OnLoad(const Json& Root) override;
+    virtual void OnPaint(Paint& Brush) const override;
+    virtual void OnThemeLoaded() override;
+
+private:
+    friend class LogViewContent;
+
+    struct Batch
+    {
+    public:
+        std::string Text {};
+        Batch* Next { nullptr };
+    };
+
+    void Appended(size_t Lines, uint64_t Dropped, size_t Longest, bool AtBottom);
+    void UpdateFont();
+    void UpdateContentSize();
+
+    std::shared_ptr<LogViewContent> m_Content { nullptr };
+    std::shared_ptr<Font> m_Font { nullptr };
+    LogBuffer m_Buffer {};
+    float m_Width { 0.0f };
+    std::atomic<Batch*> m_Pending { nullptr };
+};
+
+}
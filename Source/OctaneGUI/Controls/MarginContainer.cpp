@@ -27,6 +27,8 @@ SOFTWARE.
 #include "MarginContainer.h"
 #include "../Json.h"
 
+#include <cstring>
+
 namespace OctaneGUI
 {
 
@@ -111,4 +113,9 @@ void MarginContainer::PlaceControls(const std::vector<std::shared_ptr<Control>>&
     }
 }
 
+bool MarginContainer::IsPatchable() const
+{
+    return std::strcmp(GetType(), TypeName()) == 0;
+}
+
 }
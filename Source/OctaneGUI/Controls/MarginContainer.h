@@ -49,6 +49,7 @@ public:
 
 protected:
     virtual void PlaceControls(const std::vector<std::shared_ptr<Control>>& Controls) const override;
+    virtual bool IsPatchable() const override;
 
 private:
     Rect m_Margins {};
@@ -0,0 +1,402 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Plot.h"
+#include "../Json.h"
+#include "../Paint.h"
+#include "../Profiler.h"
+#include "../Theme.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace OctaneGUI
+{
+
+// Colors given to series loaded without one.
+static const Color Palette[] = {
+    Color(86, 156, 214, 255),
+    Color(220, 120, 80, 255),
+    Color(106, 190, 100, 255),
+    Color(200, 170, 60, 255),
+    Color(170, 110, 210, 255),
+    Color(80, 190, 190, 255),
+};
+
+// Fraction of the Y range added above and below the samples in view when fitting.
+static constexpr float YMargin = 0.05f;
+
+// Amount the view is scaled for each step of the mouse wheel.
+static constexpr double ZoomStep = 0.8;
+
+Plot::Plot(Window* InWindow)
+    : Control(InWindow)
+{
+    SetSize({ 200.0f, 100.0f });
+}
+
+size_t Plot::AddSeries(Color Col)
+{
+    m_Styles.push_back({ Col, true });
+    Invalidate();
+    return m_Data.AddSeries();
+}
+
+Plot& Plot::SetSeriesColor(size_t Series, Color Col)
+{
+    m_Styles[Series].Col = Col;
+    Invalidate();
+    return *this;
+}
+
+Color Plot::SeriesColor(size_t Series) const
+{
+    return m_Styles[Series].Col;
+}
+
+Plot& Plot::SetSeriesVisible(size_t Series, bool Visible)
+{
+    m_Styles[Series].Visible = Visible;
+    Invalidate();
+    return *this;
+}
+
+bool Plot::IsSeriesVisible(size_t Series) const
+{
+    return m_Styles[Series].Visible;
+}
+
+Plot& Plot::Append(double X, const std::vector<float>& Values)
+{
+    const size_t Previous = m_Data.Count();
+    m_Data.Append(X, Values);
+    Appended(Previous);
+    return *this;
+}
+
+Plot& Plot::Append(const std::vector<double>& X, const std::vector<std::vector<float>>& Values)
+{
+    const size_t Previous = m_Data.Count();
+    m_Data.Append(X, Values);
+    Appended(Previous);
+    return *this;
+}
+
+Plot& Plot::Clear()
+{
+    m_Data.Clear();
+    Invalidate();
+    return *this;
+}
+
+const PlotData& Plot::Data() const
+{
+    return m_Data;
+}
+
+Plot& Plot::SetThickness(float Thickness)
+{
+    m_Thickness = Thickness;
+    Invalidate();
+    return *this;
+}
+
+float Plot::Thickness() const
+{
+    return m_Thickness;
+}
+
+Plot& Plot::SetView(double Min, double Max)
+{
+    m_ViewMin = Min;
+    m_ViewMax = std::max(Max, Min);
+    m_Fit = false;
+    Invalidate();
+    return *this;
+}
+
+double Plot::ViewMin() const
+{
+    if (m_Fit)
+    {
+        return m_Data.Count() > 0 ? m_Data.X(0) : 0.0;
+    }
+
+    return m_ViewMin;
+}
+
+double Plot::ViewMax() const
+{
+    if (m_Fit)
+    {
+        // The view excludes its maximum, so it ends just past the last sample.
+        return m_Data.Count() > 0 ? std::nextafter(m_Data.X(m_Data.Count() - 1), HUGE_VAL) : 1.0;
+    }
+
+    return m_ViewMax;
+}
+
+Plot& Plot::FitView()
+{
+    m_Fit = true;
+    Invalidate();
+    return *this;
+}
+
+Plot& Plot::SetFollow(bool Follow)
+{
+    m_Follow = Follow;
+    return *this;
+}
+
+bool Plot::IsFollowing() const
+{
+    return m_Follow;
+}
+
+Plot& Plot::SetYRange(float Min, float Max)
+{
+    m_YRange = { Min, Max };
+    Invalidate();
+    return *this;
+}
+
+PlotData::Range Plot::YRange() const
+{
+    if (m_YRange.Min < m_YRange.Max)
+    {
+        return m_YRange;
+    }
+
+    const size_t Begin = m_Data.LowerBound(ViewMin());
+    const size_t End = m_Data.LowerBound(ViewMax());
+
+    PlotData::Range Result { HUGE_VALF, -HUGE_VALF };
+    for (size_t Series = 0; Series < m_Styles.size(); Series++)
+    {
+        if (m_Styles[Series].Visible)
+        {
+            const PlotData::Range Span = m_Data.MinMax(Series, Begin, End);
+            Result.Min = std::min(Result.Min, Span.Min);
+            Result.Max = std::max(Result.Max, Span.Max);
+        }
+    }
+
+    if (Result.Min > Result.Max)
+    {
+        return { 0.0f, 1.0f };
+    }
+
+    const float Margin = Result.Max > Result.Min ? (Result.Max - Result.Min) * YMargin : 1.0f;
+    return { Result.Min - Margin, Result.Max + Margin };
+}
+
+void Plot::OnLoad(const Json& Root)
+{
+    Control::OnLoad(Root);
+
+    SetThickness(Root["Thickness"].Number(m_Thickness));
+    SetFollow(Root["Follow"].Boolean(m_Follow));
+
+    const Json& Series = Root["Series"];
+    for (unsigned int I = 0; I < Series.Count(); I++)
+    {
+        const Json& Item = Series[I];
+        const Color Col = Item["Color"].IsArray() ? Color::Parse(Item["Color"]) : Palette[m_Styles.size() % (sizeof(Palette) / sizeof(Color))];
+        const size_t Index = AddSeries(Col);
+        SetSeriesVisible(Index, Item["Visible"].Boolean(true));
+    }
+
+    const Json& Range = Root["YRange"];
+    if (Range.Count() == 2)
+    {
+        SetYRange(Range[0u].Number(), Range[1u].Number());
+    }
+}
+
+void Plot::OnPaint(Paint& Brush) const
+{
+    PROFILER_SAMPLE_GROUP("Plot::OnPaint");
+
+    const Rect Bounds = GetAbsoluteBounds();
+    Brush.Rectangle(Bounds, GetProperty(ThemeProperties::TextInput_Background).ToColor());
+
+    if (m_Data.Count() == 0 || Bounds.Width() < 1.0f || Bounds.Height() <= 0.0f)
+    {
+        return;
+    }
+
+    const PlotData::Range Range = YRange();
+
+    Brush.PushClip(Bounds);
+    for (size_t Series = 0; Series < m_Styles.size(); Series++)
+    {
+        if (m_Styles[Series].Visible)
+        {
+            PaintSeries(Brush, Series, Bounds, Range);
+        }
+    }
+    Brush.PopClip();
+}
+
+void Plot::OnMouseMove(const Vector2& Position)
+{
+    if (m_Panning)
+    {
+        const double Min = ViewMin();
+        const double Max = ViewMax();
+        const double Delta = (double)(Position.X - m_LastPosition.X) / (double)std::max(GetSize().X, 1.0f) * (Max - Min);
+        m_Follow = false;
+        SetView(Min - Delta, Max - Delta);
+    }
+
+    m_LastPosition = Position;
+}
+
+bool Plot::OnMousePressed(const Vector2& Position, Mouse::Button Button, Mouse::Count)
+{
+    m_LastPosition = Position;
+
+    if (Button == Mouse::Button::Left)
+    {
+        m_Panning = true;
+        return true;
+    }
+
+    return false;
+}
+
+void Plot::OnMouseReleased(const Vector2&, Mouse::Button Button)
+{
+    if (Button == Mouse::Button::Left)
+    {
+        m_Panning = false;
+    }
+}
+
+void Plot::OnMouseWheel(const Vector2& Delta)
+{
+    if (Delta.Y == 0.0f)
+    {
+        return;
+    }
+
+    // Zoom around the X value under the mouse, or the right edge while following.
+    const double Min = ViewMin();
+    const double Max = ViewMax();
+    const Rect Bounds = GetAbsoluteBounds();
+    const double Anchor = m_Follow
+        ? Max
+        : Min + (double)std::clamp((m_LastPosition.X - Bounds.Min.X) / std::max(Bounds.Width(), 1.0f), 0.0f, 1.0f) * (Max - Min);
+    const double Scale = std::pow(ZoomStep, (double)Delta.Y);
+    SetView(Anchor - (Anchor - Min) * Scale, Anchor + (Max - Anchor) * Scale);
+}
+
+void Plot::Appended(size_t Previous)
+{
+    if (m_Data.Count() == Previous)
+    {
+        return;
+    }
+
+    if (m_Follow && !m_Fit)
+    {
+        const double Width = m_ViewMax - m_ViewMin;
+        m_ViewMax = std::nextafter(m_Data.X(m_Data.Count() - 1), HUGE_VAL);
+        m_ViewMin = m_ViewMax - Width;
+    }
+
+    Invalidate();
+}
+
+void Plot::PaintSeries(Paint& Brush, size_t Series, const Rect& Bounds, const PlotData::Range& Range) const
+{
+    const double Min = ViewMin();
+    const double Max = ViewMax();
+    if (Max <= Min)
+    {
+        return;
+    }
+
+    const Color& Col = m_Styles[Series].Col;
+    const float HalfThickness = m_Thickness * 0.5f;
+    const double XScale = (double)Bounds.Width() / (Max - Min);
+    const float YScale = Bounds.Height() / (Range.Max - Range.Min);
+    const auto ToY = [&](float Value) -> float
+    {
+        return Bounds.Max.Y - (Value - Range.Min) * YScale;
+    };
+
+    // The samples just outside of the view are included so the line reaches the edges.
+    const size_t Columns = (size_t)std::ceil(Bounds.Width());
+    const size_t Begin = m_Data.LowerBound(Min);
+    const size_t End = m_Data.LowerBound(Max);
+
+    m_Upper.clear();
+    m_Lower.clear();
+
+    if (End - Begin <= Columns * 2)
+    {
+        const size_t First = Begin > 0 ? Begin - 1 : Begin;
+        const size_t Last = std::min(End + 1, m_Data.Count());
+        for (size_t I = First; I < Last; I++)
+        {
+            const float X = Bounds.Min.X + (float)((m_Data.X(I) - Min) * XScale);
+            m_Upper.push_back({ X, ToY(m_Data.Value(Series, I)) });
+        }
+
+        Brush.Polyline(m_Upper, Col, m_Thickness);
+        return;
+    }
+
+    // Each column's range is widened to reach the last sample of the column before it, so
+    // the band stays connected where the values jump between columns.
+    m_Data.Decimate(Series, Min, Max, Columns, m_Buckets);
+
+    bool HasPrevious = Begin > 0;
+    float Previous = HasPrevious ? m_Data.Value(Series, Begin - 1) : 0.0f;
+    for (size_t Column = 0; Column < Columns; Column++)
+    {
+        const PlotData::Bucket& Item = m_Buckets[Column];
+        if (Item.Count == 0)
+        {
+            continue;
+        }
+
+        const float Low = HasPrevious ? std::min(Item.Min, Previous) : Item.Min;
+        const float High = HasPrevious ? std::max(Item.Max, Previous) : Item.Max;
+        const float X = Bounds.Min.X + (float)Column + 0.5f;
+        m_Upper.push_back({ X, ToY(High) - HalfThickness });
+        m_Lower.push_back({ X, ToY(Low) + HalfThickness });
+
+        Previous = Item.Last;
+        HasPrevious = true;
+    }
+
+    Brush.Strip(m_Upper, m_Lower, Col);
+}
+
+}
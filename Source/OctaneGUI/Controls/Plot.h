@@ -0,0 +1,125 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../PlotData.h"
+#include "Control.h"
+
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Draws series of samples as lines over a range of X values.
+///
+/// When there are more samples in view than pixel columns, each column is reduced to the
+/// minimum and maximum of the samples that fall within it and the series is filled as a
+/// single band through those ranges. Otherwise a line is drawn through every sample in
+/// view. Either way a series is painted as one strip of triangles whose size depends on
+/// the width of the control rather than the number of samples. The view can be panned by
+/// dragging and zoomed with the mouse wheel.
+class Plot : public Control
+{
+    CLASS(Plot)
+
+public:
+    Plot(Window* InWindow);
+
+    /// @brief Adds a series painted with the given color and returns its index.
+    size_t AddSeries(Color Col);
+    Plot& SetSeriesColor(size_t Series, Color Col);
+    Color SeriesColor(size_t Series) const;
+    Plot& SetSeriesVisible(size_t Series, bool Visible);
+    bool IsSeriesVisible(size_t Series) const;
+
+    /// @brief Appends one sample to every series. See PlotData::Append.
+    Plot& Append(double X, const std::vector<float>& Values);
+
+    /// @brief Appends a batch of samples. See PlotData::Append.
+    Plot& Append(const std::vector<double>& X, const std::vector<std::vector<float>>& Values);
+
+    Plot& Clear();
+    const PlotData& Data() const;
+
+    Plot& SetThickness(float Thickness);
+    float Thickness() const;
+
+    /// @brief Shows the samples with X values in [Min, Max).
+    Plot& SetView(double Min, double Max);
+    double ViewMin() const;
+    double ViewMax() const;
+
+    /// @brief Shows every sample.
+    Plot& FitView();
+
+    /// @brief Keeps the newest sample at the right edge as samples are appended, without
+    /// changing the width of the view. Panning stops following.
+    Plot& SetFollow(bool Follow);
+    bool IsFollowing() const;
+
+    /// @brief Fixes the range of Y values shown. When Min is not less than Max, the range
+    /// fits the samples in view.
+    Plot& SetYRange(float Min, float Max);
+    PlotData::Range YRange() const;
+
+    virtual void OnLoad(const Json& Root) override;
+    virtual void OnPaint(Paint& Brush) const override;
+    virtual void OnMouseMove(const Vector2& Position) override;
+    virtual bool OnMousePressed(const Vector2& Position, Mouse::Button Button, Mouse::Count Count) override;
+    virtual void OnMouseReleased(const Vector2& Position, Mouse::Button Button) override;
+    virtual void OnMouseWheel(const Vector2& Delta) override;
+
+private:
+    struct Style
+    {
+    public:
+        Color Col {};
+        bool Visible { true };
+    };
+
+    void Appended(size_t Previous);
+    void PaintSeries(Paint& Brush, size_t Series, const Rect& Bounds, const PlotData::Range& Range) const;
+
+    PlotData m_Data {};
+    std::vector<Style> m_Styles {};
+    float m_Thickness { 1.0f };
+    double m_ViewMin { 0.0 };
+    double m_ViewMax { 0.0 };
+    bool m_Fit { true };
+    bool m_Follow { false };
+    PlotData::Range m_YRange { 0.0f, 0.0f };
+
+    bool m_Panning { false };
+    Vector2 m_LastPosition {};
+
+    // Reused between frames to avoid allocating while painting.
+    mutable std::vector<PlotData::Bucket> m_Buckets {};
+    mutable std::vector<Vector2> m_Upper {};
+    mutable std::vector<Vector2> m_Lower {};
+};
+
+}
@@ -26,9 +26,13 @@ SOFTWARE.
 
 #include "Table.h"
 #include "../Assert.h"
+#include "../Font.h"
 #include "../Json.h"
 #include "../Paint.h"
+#include "../Profiler.h"
 #include "../String.h"
+#include "../TableData.h"
+#include "../Theme.h"
 #include "../ThemeProperties.h"
 #include "HorizontalContainer.h"
 #include "ScrollableContainer.h"
@@ -37,9 +41,16 @@ SOFTWARE.
 #include "Text.h"
 #include "VerticalContainer.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace OctaneGUI
 {
 
+// Number of evenly spaced rows measured when fitting a column to a TableData, in addition
+// to the row with the most characters.
+static constexpr size_t FitSamples = 256;
+
 //
 // TableCell
 //
@@ -169,6 +180,28 @@ public:
         return std::static_pointer_cast<TableRow>(m_Rows->Get(Index));
     }
 
+    int32_t RowAt(const Vector2& Position) const
+    {
+        // Rows are stacked without spacing, so the first row that ends below the position
+        // can be found with a binary search.
+        size_t Lo = 0;
+        size_t Hi = Rows();
+        while (Lo < Hi)
+        {
+            const size_t Mid = Lo + (Hi - Lo) / 2;
+            if (Row(Mid)->GetAbsoluteBounds().Max.Y < Position.Y)
+            {
+                Lo = Mid + 1;
+            }
+            else
+            {
+                Hi = Mid;
+            }
+        }
+
+        return Lo < Rows() && IsInRow(Lo, Position) ? (int32_t)Lo : -1;
+    }
+
     bool IsInRow(size_t Index, const Vector2& Position) const
     {
         const std::shared_ptr<TableRow> Row = this->Row(Index);
@@ -201,6 +234,75 @@ private:
     std::shared_ptr<VerticalContainer> m_Rows { nullptr };
 };
 
+//
+// TableDataRows
+//
+
+/// Sized to fit every row of a table's data so that the rows can be scrolled through, but
+/// only paints the rows that are in view.
+class TableDataRows : public Control
+{
+    CLASS(TableDataRows)
+
+public:
+    TableDataRows(Window* InWindow, const Table* Owner)
+        : Control(InWindow)
+        , m_Table(Owner)
+    {
+    }
+
+    virtual void OnPaint(Paint& Brush) const override
+    {
+        PROFILER_SAMPLE_GROUP("TableDataRows::OnPaint");
+
+        const std::shared_ptr<TableData>& Data = m_Table->m_Data;
+        const std::shared_ptr<Font>& TheFont = m_Table->m_Font;
+        const float RowHeight = m_Table->RowHeight();
+        if (!Data || !TheFont || RowHeight <= 0.0f)
+        {
+            return;
+        }
+
+        const Vector2 Position = GetAbsolutePosition();
+        const Rect View = m_Table->m_Rows->Scrollable()->GetAbsoluteBounds();
+        size_t First = 0;
+        size_t Last = 0;
+        m_Table->VisibleRows(First, Last);
+        const Color TextColor = GetProperty(ThemeProperties::Text).ToColor();
+        const Splitter& Header = *m_Table->m_Header;
+        const float SeparatorWidth = Header.SplitterSize().X;
+
+        // Painting a column at a time keeps to one clip rectangle per column.
+        float X = Position.X;
+        const size_t Columns = std::min(Data->Columns(), Header.Count());
+        for (size_t Column = 0; Column < Columns && X < View.Max.X; Column++)
+        {
+            const float Width = Header.GetSplit(Column)->GetSize().X;
+            if (X + Width > View.Min.X)
+            {
+                Brush.PushClip({ X, View.Min.Y, X + Width, View.Max.Y });
+                for (size_t Row = First; Row < Last; Row++)
+                {
+                    const Vector2 CellPosition { X, Position.Y + (float)Row * RowHeight };
+                    Brush.Text(TheFont, CellPosition.Floor(), String::ToUTF32(Data->Format(Row, Column)), TextColor);
+                }
+                Brush.PopClip();
+            }
+
+            X += Width + SeparatorWidth;
+        }
+    }
+
+protected:
+    virtual bool IsFixedSize() const override
+    {
+        return true;
+    }
+
+private:
+    const Table* m_Table { nullptr };
+};
+
 //
 // Table
 //
@@ -230,6 +332,11 @@ Table::Table(Window* InWindow)
 
     m_Interaction = AddControl<Control>();
     m_Interaction->SetForwardMouseEvents(true);
+
+    if (GetTheme())
+    {
+        UpdateFont();
+    }
 }
 
 Table& Table::AddColumn(const char32_t* Label)
@@ -247,6 +354,16 @@ Table& Table::FitColumn(size_t Column)
     const std::shared_ptr<Container>& Heading = m_Header->GetSplit(Column);
 
     float Width = Heading->GetSize().X;
+    if (m_Data)
+    {
+        if (Column < m_Data->Columns())
+        {
+            Width = std::max<float>(Width, FitDataColumn(Column));
+        }
+        m_Header->SetSplitterSize(Column, Width);
+        return *this;
+    }
+
     for (size_t Row = 0; Row < Rows(); Row++)
     {
         const std::shared_ptr<Container> Cell = this->Cell(Row, Column);
@@ -265,6 +382,11 @@ Table& Table::SetColumnSize(size_t Column, float Size)
     return *this;
 }
 
+float Table::ColumnSize(size_t Column) const
+{
+    return m_Header->GetSplit(Column)->GetSize().X;
+}
+
 size_t Table::Columns() const
 {
     return m_Header->Count();
@@ -272,6 +394,12 @@ size_t Table::Columns() const
 
 Table& Table::AddRow()
 {
+    Assert(!m_Data, "Rows of controls can not be added while the table displays data.\n");
+    if (m_Data)
+    {
+        return *this;
+    }
+
     const size_t Index = m_Rows->Rows();
     std::shared_ptr<TableRow> Row = m_Rows->AddRow();
 
@@ -287,6 +415,12 @@ Table& Table::AddRow()
 
 Table& Table::ClearRows()
 {
+    if (m_Data)
+    {
+        m_Data->Clear();
+        return DataChanged();
+    }
+
     m_Rows->ClearRows();
     m_Selected = -1;
     return *this;
@@ -294,7 +428,84 @@ Table& Table::ClearRows()
 
 size_t Table::Rows() const
 {
-    return m_Rows->Rows();
+    return m_Data ? m_Data->Rows() : m_Rows->Rows();
+}
+
+Table& Table::SetData(const std::shared_ptr<TableData>& Data)
+{
+    m_Rows->ClearRows();
+    m_Hovered = -1;
+    m_Selected = -1;
+    m_Data = Data;
+
+    if (m_Data)
+    {
+        // The header may have been empty until now and needs to be laid out again.
+        if (Columns() < m_Data->Columns())
+        {
+            for (size_t Column = Columns(); Column < m_Data->Columns(); Column++)
+            {
+                AddColumn(String::ToUTF32(m_Data->Label(Column)).c_str());
+            }
+            Invalidate(InvalidateType::Layout);
+        }
+
+        if (!m_DataRows)
+        {
+            m_DataRows = m_Rows->Scrollable()->AddControl<TableDataRows>(this);
+        }
+    }
+    else if (m_DataRows)
+    {
+        m_Rows->Scrollable()->RemoveControl(m_DataRows);
+        m_DataRows = nullptr;
+    }
+
+    return DataChanged();
+}
+
+const std::shared_ptr<TableData>& Table::Data() const
+{
+    return m_Data;
+}
+
+Table& Table::DataChanged()
+{
+    if (m_Hovered >= (int32_t)Rows())
+    {
+        m_Hovered = -1;
+    }
+
+    if (m_Selected >= (int32_t)Rows())
+    {
+        m_Selected = -1;
+    }
+
+    SyncSize();
+    Invalidate();
+    return *this;
+}
+
+float Table::RowHeight() const
+{
+    return m_Font ? m_Font->Size() : 0.0f;
+}
+
+void Table::VisibleRows(size_t& First, size_t& Last) const
+{
+    First = 0;
+    Last = 0;
+
+    const float Height = RowHeight();
+    if (!m_Data || !m_DataRows || Height <= 0.0f)
+    {
+        return;
+    }
+
+    const float Position = m_DataRows->GetAbsolutePosition().Y;
+    const Rect View = m_Rows->Scrollable()->GetAbsoluteBounds();
+    Last = std::min<size_t>(m_Data->Rows(), (size_t)std::max(0.0f, std::ceil((View.Max.Y - Position) / Height)));
+    First = std::min<size_t>(Last, (size_t)std::max(0.0f, std::floor((View.Min.Y - Position) / Height)));
 }
 
 Table& Table::SetRowSelectable(bool Value)
@@ -310,6 +521,12 @@ bool Table::RowSelectable() const
 
 std::shared_ptr<Container> Table::Cell(size_t Row, size_t Column) const
 {
+    Assert(!m_Data, "Cells of controls can not be retrieved while the table displays data.\n");
+    if (m_Data)
+    {
+        return nullptr;
+    }
+
     std::shared_ptr<TableRow> RowContainer = m_Rows->Row(Row);
     return RowContainer->GetCellContainer(Column);
 }
@@ -427,13 +644,10 @@ void Table::OnMouseMove(const Vector2& Position)
         return;
     }
 
-    for (size_t I = 0; I < m_Rows->Rows(); I++)
+    const int32_t Row = RowAt(Position);
+    if (Row != -1)
     {
-        if (m_Rows->IsInRow(I, Position))
-        {
-            SetHovered((int32_t)I);
-            break;
-        }
+        SetHovered(Row);
     }
 }
 
@@ -482,8 +696,32 @@ void Table::OnMouseLeave()
     Invalidate(InvalidateType::Paint);
 }
 
+void Table::OnThemeLoaded()
+{
+    Container::OnThemeLoaded();
+
+    UpdateFont();
+    if (m_Data)
+    {
+        DataChanged();
+    }
+}
+
 void Table::SyncSize()
 {
+    if (m_DataRows)
+    {
+        float Width = 0.0f;
+        for (size_t Column = 0; Column < m_Header->Count(); Column++)
+        {
+            Width += m_Header->GetSplit(Column)->GetSize().X + (Column > 0 ? m_Header->SplitterSize().X : 0.0f);
+        }
+
+        m_DataRows->SetSize({ Width, (float)Rows() * RowHeight() });
+        m_Rows->Scrollable()->Update();
+        return;
+    }
+
     for (size_t Row = 0; Row < m_Rows->Rows(); Row++)
     {
         SyncSize(Row);
@@ -504,15 +742,27 @@ void Table::SyncSize(size_t Row)
 
 void Table::OnPaintSelection(Paint& Brush, size_t Index) const
 {
-    if (Index < m_Rows->Rows())
+    if (Index >= Rows())
     {
-        Color Background { GetProperty(ThemeProperties::TextSelectable_Hovered).ToColor() };
-        Background.A = 128;
-        const std::shared_ptr<Control>& Row = m_Rows->Row(Index);
-        Rect Bounds { Row->GetAbsoluteBounds() };
-        Bounds.SetSize({ m_Rows->GetSize().X > Bounds.Width() ? m_Rows->GetSize().X : Bounds.Width(), Bounds.Height() });
-        Brush.Rectangle(Bounds, Background);
+        return;
+    }
+
+    Color Background { GetProperty(ThemeProperties::TextSelectable_Hovered).ToColor() };
+    Background.A = 128;
+
+    if (m_DataRows)
+    {
+        const float Height = RowHeight();
+        const Vector2 Position { m_DataRows->GetAbsolutePosition() + Vector2(0.0f, (float)Index * Height) };
+        const float Width = std::max(m_Rows->GetSize().X, m_DataRows->GetSize().X);
+        Brush.Rectangle({ Position, Position + Vector2(Width, Height) }, Background);
+        return;
     }
+
+    const std::shared_ptr<Control>& Row = m_Rows->Row(Index);
+    Rect Bounds { Row->GetAbsoluteBounds() };
+    Bounds.SetSize({ m_Rows->GetSize().X > Bounds.Width() ? m_Rows->GetSize().X : Bounds.Width(), Bounds.Height() });
+    Brush.Rectangle(Bounds, Background);
 }
 
 void Table::SetHovered(int32_t Value)
@@ -524,4 +774,53 @@ void Table::SetHovered(int32_t Value)
     }
 }
 
+int32_t Table::RowAt(const Vector2& Position) const
+{
+    if (!m_DataRows)
+    {
+        return m_Rows->RowAt(Position);
+    }
+
+    // Every row has the same height, so the row follows from the distance to the first.
+    const float Height = RowHeight();
+    const float Y = Position.Y - m_DataRows->GetAbsolutePosition().Y;
+    if (Height <= 0.0f || Y < 0.0f || !m_Rows->Scrollable()->Contains(Position))
+    {
+        return -1;
+    }
+
+    const size_t Row = (size_t)(Y / Height);
+    return Row < m_Data->Rows() ? (int32_t)Row : -1;
+}
+
+float Table::FitDataColumn(size_t Column) const
+{
+    const size_t Count = m_Data->Rows();
+    if (!m_Font || Count == 0)
+    {
+        return 0.0f;
+    }
+
+    const auto Measure = [this, Column](size_t Row) -> float
+    {
+        return m_Font->Measure(String::ToUTF32(m_Data->Format(Row, Column))).X;
+    };
+
+    float Result = Measure(m_Data->LongestRow(Column));
+    const size_t Step = std::max<size_t>(1, Count / FitSamples);
+    for (size_t Row = 0; Row < Count; Row += Step)
+    {
+        Result = std::max(Result, Measure(Row));
+    }
+
+    return Result;
+}
+
+void Table::UpdateFont()
+{
+    const char* FontPath = GetProperty(ThemeProperties::FontPath).String(nullptr);
+    const float FontSize = GetProperty(ThemeProperties::FontSize).Float(RowHeight()) * RenderScale().Y;
+    m_Font = GetTheme()->GetOrAddFont(FontPath, FontSize);
+}
+
 }
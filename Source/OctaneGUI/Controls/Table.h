@@ -31,11 +31,20 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+class Font;
 class ScrollableViewControl;
 class Splitter;
+class TableData;
+class TableDataRows;
 class TableRows;
 class VerticalContainer;
 
+/// @brief Rows of cells under a header of resizable columns.
+///
+/// By default each row is made of controls that are added to its cells. Alternatively a
+/// TableData can be given, in which case no controls are created for the rows. Only the
+/// rows in view are painted, and the row under the mouse is found from the fixed row
+/// height.
 class Table : public Container
 {
     CLASS(Table)
@@ -48,15 +57,35 @@ public:
     Table& AddColumn(const char32_t* Label);
     Table& FitColumn(size_t Column);
     Table& SetColumnSize(size_t Column, float Size);
+    float ColumnSize(size_t Column) const;
     size_t Columns() const;
 
+    /// @brief Adds a row of cells. Not available while the table displays a TableData.
     Table& AddRow();
     Table& ClearRows();
     size_t Rows() const;
 
+    /// @brief Displays the rows of the given data instead of rows of controls. A column is
+    /// added to the header for each data column the table does not have yet. Passing null
+    /// returns to rows of controls.
+    Table& SetData(const std::shared_ptr<TableData>& Data);
+    const std::shared_ptr<TableData>& Data() const;
+
+    /// @brief Must be called after rows are added to or removed from the data.
+    Table& DataChanged();
+
+    /// @brief Height of each row while the table displays a TableData.
+    float RowHeight() const;
+
+    /// @brief Range of data rows that are in view, from First up to but not including
+    /// Last. The range is empty while the table displays rows of controls.
+    void VisibleRows(size_t& First, size_t& Last) const;
+
     Table& SetRowSelectable(bool Value);
     bool RowSelectable() const;
 
+    /// @brief Container for the controls of a cell. Not available while the table displays
+    /// a TableData.
     std::shared_ptr<Container> Cell(size_t Row, size_t Column) const;
 
     Table& SetOnSelected(OnSelectedSignature&& Fn);
@@ -71,12 +100,18 @@ public:
     virtual bool OnMousePressed(const Vector2& Position, Mouse::Button Button, Mouse::Count Count) override;
     virtual void OnMouseReleased(const Vector2& Position, Mouse::Button Button) override;
     virtual void OnMouseLeave() override;
+    virtual void OnThemeLoaded() override;
 
 private:
+    friend class TableDataRows;
+
     void SyncSize();
     void SyncSize(size_t Row);
     void OnPaintSelection(Paint& Brush, size_t Index) const;
     void SetHovered(int32_t Value);
+    int32_t RowAt(const Vector2& Position) const;
+    float FitDataColumn(size_t Column) const;
+    void UpdateFont();
 
     bool m_RowSelectable { false };
     int32_t m_Hovered { -1 };
@@ -85,6 +120,9 @@ private:
     std::shared_ptr<Splitter> m_Header { nullptr };
     std::shared_ptr<TableRows> m_Rows { nullptr };
     std::shared_ptr<Control> m_Interaction { nullptr };
+    std::shared_ptr<TableData> m_Data { nullptr };
+    std::shared_ptr<TableDataRows> m_DataRows { nullptr };
+    std::shared_ptr<Font> m_Font { nullptr };
     OnSelectedSignature m_OnSelected { nullptr };
     OnSelectedSignature m_OnDoubleClicked { nullptr };
 };
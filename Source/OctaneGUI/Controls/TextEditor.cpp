@@ -60,6 +60,7 @@ TextEditor::~TextEditor()
     if (GetWindow() != nullptr)
     {
         LS().UnregisterListener(m_ListenerID);
+        GetWindow()->App().FS().Unwatch(m_FileWatch);
     }
 }
 
@@ -142,17 +143,31 @@ TextEditor& TextEditor::RegisterLanguageServer()
 
 TextEditor& TextEditor::OpenFile(const char32_t* FileName)
 {
-    std::string Contents = GetWindow()->App().FS().LoadContents(FileName);
+    FileSystem& FS = GetWindow()->App().FS();
+    std::string Contents = FS.LoadContents(FileName);
     SetText(Contents.c_str());
     m_FileName = String::Replace(FileName, U"\\", U"/");
+    m_FileHash = std::hash<std::u32string_view>()(GetText());
     const std::u32string Extension { FileSystem::Extension(FileName) };
     Highlighter().SetRules(Syntax::Rules::Get(Extension));
     OpenDocument();
+
+    FS.Unwatch(m_FileWatch);
+    m_FileWatch = FS.Watch(m_FileName, false, [this](const std::vector<FileSystem::FileChange>& Changes) -> void
+        {
+            if (Changes.back().Change != FileSystem::FileChange::Type::Removed)
+            {
+                ReloadFile();
+            }
+        });
+
     return *this;
 }
 
 TextEditor& TextEditor::CloseFile()
 {
+    GetWindow()->App().FS().Unwatch(m_FileWatch);
+    m_FileWatch = 0;
     SetText(U"");
     LS().CloseDocument(m_FileName.c_str());
     m_FileName.clear();
@@ -385,4 +400,22 @@ void TextEditor::RetrieveSymbols()
     LS().GetDocumentSymbols(m_FileName.c_str());
 }
 
+void TextEditor::ReloadFile()
+{
+    // Local changes are kept over the changes on disk.
+    if (std::hash<std::u32string_view>()(GetText()) != m_FileHash)
+    {
+        return;
+    }
+
+    const std::string Contents = GetWindow()->App().FS().LoadContents(m_FileName);
+    const std::u32string Text = String::ToUTF32(Contents);
+    const size_t Hash = std::hash<std::u32string_view>()(Text);
+    if (Hash != m_FileHash)
+    {
+        SetText(Text.c_str());
+        m_FileHash = Hash;
+    }
+}
+
 }
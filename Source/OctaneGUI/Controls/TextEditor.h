@@ -81,10 +81,16 @@ private:
 
     void OpenDocument();
     void RetrieveSymbols();
+    void ReloadFile();
 
     bool m_MatchIndent { true };
     std::unordered_map<size_t, Color> m_LineColors {};
     std::u32string m_FileName {};
+
+    // Watches the open file so it can be reloaded when changed outside of the editor.
+    // The hash of the loaded contents is used to avoid replacing any local changes.
+    uint32_t m_FileWatch { 0 };
+    size_t m_FileHash { 0 };
     State m_State { State::None };
     LanguageServer::ListenerID m_ListenerID { LanguageServer::INVALID_LISTENER_ID };
 };
@@ -26,6 +26,8 @@ SOFTWARE.
 
 #include "VerticalContainer.h"
 
+#include <cstring>
+
 namespace OctaneGUI
 {
 
@@ -34,4 +36,9 @@ VerticalContainer::VerticalContainer(Window* InWindow)
 {
 }
 
+bool VerticalContainer::IsPatchable() const
+{
+    return std::strcmp(GetType(), TypeName()) == 0;
+}
+
 }
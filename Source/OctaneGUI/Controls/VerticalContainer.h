@@ -38,6 +38,9 @@ class VerticalContainer : public BoxContainer
 
 public:
     VerticalContainer(Window* InWindow);
+
+protected:
+    virtual bool IsPatchable() const override;
 };
 
 }
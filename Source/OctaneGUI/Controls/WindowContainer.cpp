@@ -290,6 +290,17 @@ std::weak_ptr<Control> WindowContainer::GetControl(const Vector2& Point) const
     return Result;
 }
 
+bool WindowContainer::Patch(const Json& Previous, const Json& Next)
+{
+    // Only the body is patched. Any change to the menu bar requires a full reload.
+    if (!Previous.IsObject() || !Next.IsObject() || Previous["MenuBar"] != Next["MenuBar"] || Previous["Controls"] != Next["Controls"])
+    {
+        return false;
+    }
+
+    return m_Body->Patch(Previous["Body"], Next["Body"]);
+}
+
 void WindowContainer::OnLoad(const Json& Root)
 {
     Container::OnLoad(Root);
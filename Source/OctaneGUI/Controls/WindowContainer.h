@@ -68,6 +68,7 @@ public:
     const std::shared_ptr<MenuBar>& GetMenuBar() const;
 
     virtual std::weak_ptr<Control> GetControl(const Vector2& Point) const override;
+    virtual bool Patch(const Json& Previous, const Json& Next) override;
 
     virtual void OnLoad(const Json& Root) override;
 
@@ -35,23 +35,168 @@ SOFTWARE.
 #include "../Controls/ScrollableViewControl.h"
 #include "../Controls/Splitter.h"
 #include "../Controls/Table.h"
-#include "../Controls/Text.h"
 #include "../Controls/TextButton.h"
 #include "../Controls/TextInput.h"
 #include "../Controls/TextSelectable.h"
 #include "../Controls/Tree.h"
 #include "../Controls/VerticalContainer.h"
 #include "../String.h"
+#include "../TableData.h"
+#include "../Timer.h"
 #include "../Window.h"
 #include "MessageBox.h"
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 
 namespace OctaneGUI
 {
 
 const char* ID = "OctaneGUI.FileDialog";
 
+// File sizes are retrieved after the listing is sorted. Rows without a size yet use this value.
+static constexpr uintmax_t UnknownSize { UINTMAX_MAX };
+
+// Number of rows added to the list each update.
+static constexpr size_t RowsPerUpdate { 1024 };
+
+// Number of items sorted at a time before the sorted runs are merged.
+static constexpr size_t ItemsPerSortRun { 4096 };
+
+// Number of file sizes retrieved before they are handed to the main thread.
+static constexpr size_t SizesPerBatch { 512 };
+
+// Owned by both the dialog and the worker thread, which may still be running after the
+// enumeration is cancelled.
+struct FileDialog::Enumeration
+{
+    std::atomic<bool> Cancelled { false };
+
+    // Rows in view, which have their sizes retrieved before the rest.
+    std::atomic<size_t> VisibleFirst { 0 };
+    std::atomic<size_t> VisibleLast { 0 };
+
+    // Shared with the worker thread.
+    std::mutex Mutex {};
+    std::vector<FileSystem::DirectoryItem> Listed {};
+    std::vector<std::pair<size_t, uintmax_t>> Sizes {};
+    bool IsListed { false };
+    bool IsDone { false };
+
+    // Only accessed on the main thread.
+    std::vector<FileSystem::DirectoryItem> Items {};
+    size_t Rows { 0 };
+};
+
+static bool MatchesFilter(const std::u32string& FileName, const FileDialogFilter& Filter)
+{
+    std::u32string Extension = String::ToLower(FileSystem::Extension(FileName));
+    if (!Extension.empty())
+    {
+        Extension = Extension.substr(1);
+    }
+
+    for (const std::u32string& Test : Filter.Extensions)
+    {
+        if (Test == U"*" || Extension == String::ToLower(Test))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Sorts the items by name in runs which are then merged so that a cancelled enumeration
+// does not have to wait for a large directory to finish sorting.
+static bool SortItems(std::vector<FileSystem::DirectoryItem>& Items, const std::atomic<bool>& Cancelled)
+{
+    const auto Compare = [](const FileSystem::DirectoryItem& A, const FileSystem::DirectoryItem& B) -> bool
+    {
+        return A.FileName < B.FileName;
+    };
+
+    const size_t Count = Items.size();
+    for (size_t Start = 0; Start < Count; Start += ItemsPerSortRun)
+    {
+        if (Cancelled)
+        {
+            return false;
+        }
+
+        std::sort(Items.begin() + Start, Items.begin() + std::min(Start + ItemsPerSortRun, Count), Compare);
+    }
+
+    for (size_t Width = ItemsPerSortRun; Width < Count; Width *= 2)
+    {
+        for (size_t Start = 0; Start + Width < Count; Start += Width * 2)
+        {
+            if (Cancelled)
+            {
+                return false;
+            }
+
+            std::inplace_merge(Items.begin() + Start, Items.begin() + Start + Width, Items.begin() + std::min(Start + Width * 2, Count), Compare);
+        }
+    }
+
+    return true;
+}
+
+enum class MemoryUnit : uint8_t
+{
+    B,
+    KB,
+    MB,
+    GB,
+    TB,
+    PB
+};
+
+const char* ToString(MemoryUnit Value)
+{
+    switch (Value)
+    {
+    case MemoryUnit::KB: return "KB";
+    case MemoryUnit::MB: return "MB";
+    case MemoryUnit::GB: return "GB";
+    case MemoryUnit::TB: return "TB";
+    case MemoryUnit::PB: return "PB";
+    case MemoryUnit::B:
+    default: break;
+    }
+
+    return "B";
+}
+
+static std::string FormatSize(uintmax_t Size)
+{
+    MemoryUnit Unit = MemoryUnit::B;
+    while (Size > 10000)
+    {
+        Size /= 1024;
+
+        switch (Unit)
+        {
+        case MemoryUnit::B: Unit = MemoryUnit::KB; break;
+        case MemoryUnit::KB: Unit = MemoryUnit::MB; break;
+        case MemoryUnit::MB: Unit = MemoryUnit::GB; break;
+        case MemoryUnit::GB: Unit = MemoryUnit::TB; break;
+        case MemoryUnit::TB:
+        default:
+            Unit = MemoryUnit::PB;
+        }
+
+        if (Unit == MemoryUnit::PB)
+        {
+            break;
+        }
+    }
+
+    return std::to_string(Size) + " " + ToString(Unit);
+}
+
 void SetFileDialogData(const std::shared_ptr<Window>& Dialog, FileDialogType Type, const std::vector<FileDialogFilter>& Filters)
 {
     const std::shared_ptr<FileDialog>& FD = std::static_pointer_cast<FileDialog>(Dialog->GetContainer()->Get(0));
@@ -121,17 +266,19 @@ FileDialog::FileDialog(Window* InWindow)
                 }
             });
 
-    // The right pane that contains the list of files in the selected directory.
+    // The right pane that contains the list of files in the selected directory. Listings
+    // can be large, so the rows are given as data instead of controls.
+    m_ListData = std::make_shared<TableData>();
+    m_ListData->AddColumn("Name", TableData::Type::Text);
+    m_ListData->AddColumn("Size", TableData::Type::Text);
+
     m_DirectoryList = BodySplitter->GetSplit(1)->AddControl<Table>();
     m_DirectoryList
-        ->AddColumn(U"Name")
-        .AddColumn(U"Size")
+        ->SetData(m_ListData)
         .SetRowSelectable(true)
-        .SetOnSelected([this](Table& Ref, size_t Selected) -> void
+        .SetOnSelected([this](Table&, size_t Selected) -> void
             {
-                const std::shared_ptr<Container> Cell = Ref.Cell(Selected, 0);
-                const std::shared_ptr<Text>& Contents = std::static_pointer_cast<Text>(Cell->Get(0));
-                m_Selected = Contents->GetText();
+                m_Selected = String::ToUTF32(m_ListData->Text(Selected, 0));
                 m_FileName->SetText(GetWindow()->App().FS().CombinePath(m_Directory, m_Selected).c_str());
             })
         .SetOnDoubleClicked([this](Table&, size_t) -> void
@@ -194,10 +341,20 @@ FileDialog::FileDialog(Window* InWindow)
                 Close(false);
             });
 
+    m_EnumerationTimer = InWindow->CreateTimer(0, true, [this]() -> void
+        {
+            UpdateEnumeration();
+        });
+
     m_Directory = GetWindow()->App().FS().CurrentDirectory();
     PopulateTree();
 }
 
+FileDialog::~FileDialog()
+{
+    CancelEnumeration();
+}
+
 FileDialog& FileDialog::SetType(FileDialogType Type)
 {
     m_Type = Type;
@@ -307,31 +464,28 @@ void FileDialog::PopulateTree()
 
 void FileDialog::PopulateChildren(const std::shared_ptr<Tree>& Parent, const std::u32string& Directory) const
 {
-    const FileSystem& FS = GetWindow()->App().FS();
-
-    std::vector<FileSystem::DirectoryItem> Items = FS.DirectoryItems(Directory.c_str());
-    std::sort(Items.begin(), Items.end(), [](const FileSystem::DirectoryItem& A, const FileSystem::DirectoryItem& B) -> bool
-        {
-            return A.FileName < B.FileName;
-        });
-    for (const FileSystem::DirectoryItem& Item : Items)
-    {
-        const std::u32string Path = FS.CombinePath(Directory, Item.FileName);
-
-        if (FS.IsDirectory(Path))
+    std::vector<std::u32string> Directories;
+    GetWindow()->App().FS().DirectoryItems(Directory, [&](FileSystem::DirectoryItem&& Item) -> bool
         {
-            const std::shared_ptr<Tree> Child = Parent->AddChild(Item.FileName.c_str());
-
-            if (HasDirectories(Path.c_str()))
+            if (Item.IsDirectory)
             {
-                Child->AddChild("");
+                Directories.push_back(std::move(Item.FileName));
             }
-        }
+            return true;
+        });
+    std::sort(Directories.begin(), Directories.end());
+
+    // Sub-directories are only enumerated when expanded. Each one is given an empty child
+    // so it can be toggled, which is replaced with the actual contents once toggled.
+    for (const std::u32string& Name : Directories)
+    {
+        Parent->AddChild(Name.c_str())->AddChild("");
     }
 }
 
 void FileDialog::PopulateList()
 {
+    CancelEnumeration();
     m_DirectoryList->ClearRows();
 
     FileDialogFilter Filter {};
@@ -341,109 +495,166 @@ void FileDialog::PopulateList()
         Filter = m_Filters[Index];
     }
 
+    m_Enumeration = std::make_shared<Enumeration>();
+    const std::shared_ptr<Enumeration> Pending = m_Enumeration;
     const FileSystem& FS = GetWindow()->App().FS();
+    const std::u32string Directory = m_Directory;
 
-    std::vector<FileSystem::DirectoryItem> Items = FS.DirectoryItems(m_Directory);
-    std::sort(Items.begin(), Items.end(), [](const FileSystem::DirectoryItem& A, const FileSystem::DirectoryItem& B) -> bool
+    GetWindow()->App().GetThreadPool().Submit([Pending, &FS, Directory, Filter]() -> void
         {
-            return A.FileName < B.FileName;
-        });
-    for (const FileSystem::DirectoryItem& Item : Items)
-    {
-        std::u32string Extension = String::ToLower(FS.Extension(Item.FileName));
-        if (!Extension.empty())
-        {
-            Extension = Extension.substr(1);
-        }
+            std::vector<FileSystem::DirectoryItem> Items;
+            FS.DirectoryItems(Directory, [&](FileSystem::DirectoryItem&& Item) -> bool
+                {
+                    if (MatchesFilter(Item.FileName, Filter))
+                    {
+                        Item.FileSize = Item.IsDirectory ? 0 : UnknownSize;
+                        Items.push_back(std::move(Item));
+                    }
+                    return !Pending->Cancelled;
+                });
+
+            if (!SortItems(Items, Pending->Cancelled))
+            {
+                return;
+            }
 
-        bool IsValidExtension = false;
-        for (const std::u32string& Test : Filter.Extensions)
-        {
-            if (Test == U"*" || Extension == String::ToLower(Test))
             {
-                IsValidExtension = true;
-                break;
+                std::lock_guard<std::mutex> Lock { Pending->Mutex };
+                Pending->Listed = Items;
+                Pending->IsListed = true;
             }
-        }
 
-        if (IsValidExtension)
-        {
-            AddListItem(Item.FileName.c_str(), (size_t)Item.FileSize);
-        }
-    }
-}
+            // Sizes of the rows in view are retrieved first and handed over right away, so
+            // rows scrolled into view are filled in without waiting for the ones above them.
+            // The rest are retrieved in list order in the background.
+            std::vector<bool> Known(Items.size(), false);
+            std::vector<std::pair<size_t, uintmax_t>> Sizes;
+            size_t Next = 0;
+            while (!Pending->Cancelled)
+            {
+                const size_t Last = std::min(Pending->VisibleLast.load(), Items.size());
+                size_t Index = Items.size();
+                for (size_t I = Pending->VisibleFirst; I < Last; I++)
+                {
+                    if (!Known[I] && !Items[I].IsDirectory)
+                    {
+                        Index = I;
+                        break;
+                    }
+                }
 
-enum class MemoryUnit : uint8_t
-{
-    B,
-    KB,
-    MB,
-    GB,
-    TB,
-    PB
-};
+                const bool Visible = Index < Items.size();
+                if (!Visible)
+                {
+                    while (Next < Items.size() && (Known[Next] || Items[Next].IsDirectory))
+                    {
+                        Next++;
+                    }
+                    Index = Next;
+                }
 
-const char* ToString(MemoryUnit Value)
-{
-    switch (Value)
-    {
-    case MemoryUnit::KB: return "KB";
-    case MemoryUnit::MB: return "MB";
-    case MemoryUnit::GB: return "GB";
-    case MemoryUnit::TB: return "TB";
-    case MemoryUnit::PB: return "PB";
-    case MemoryUnit::B:
-    default: break;
-    }
+                if (Index >= Items.size())
+                {
+                    break;
+                }
 
-    return "B";
+                Known[Index] = true;
+                Sizes.push_back({ Index, FS.FileSize(FS.CombinePath(Directory, Items[Index].FileName)) });
+                if (Visible || Sizes.size() >= SizesPerBatch)
+                {
+                    std::lock_guard<std::mutex> Lock { Pending->Mutex };
+                    Pending->Sizes.insert(Pending->Sizes.end(), Sizes.begin(), Sizes.end());
+                    Sizes.clear();
+                }
+            }
+
+            std::lock_guard<std::mutex> Lock { Pending->Mutex };
+            Pending->Sizes.insert(Pending->Sizes.end(), Sizes.begin(), Sizes.end());
+            Pending->IsDone = true;
+        });
+
+    m_EnumerationTimer->Start();
 }
 
-void FileDialog::AddListItem(const char32_t* Name, size_t Size)
+void FileDialog::UpdateEnumeration()
 {
-    const size_t Row = m_DirectoryList->Rows();
-    m_DirectoryList->AddRow();
+    if (!m_Enumeration)
+    {
+        m_EnumerationTimer->Stop();
+        return;
+    }
 
-    // Set name
-    m_DirectoryList
-        ->Cell(Row, 0)
-        ->AddControl<Text>()
-        ->SetText(Name);
+    Enumeration& Pending = *m_Enumeration;
 
-    // Set size
-    std::shared_ptr<HorizontalContainer> Outer = m_DirectoryList->Cell(Row, 1)->AddControl<HorizontalContainer>();
-    Outer
-        ->SetGrow(Grow::End)
-        .SetExpand(Expand::Width);
+    size_t First = 0;
+    size_t Last = 0;
+    m_DirectoryList->VisibleRows(First, Last);
+    Pending.VisibleFirst = First;
+    Pending.VisibleLast = Last;
 
-    MemoryUnit Unit = MemoryUnit::B;
-    while (Size > 10000)
+    std::vector<std::pair<size_t, uintmax_t>> Sizes;
+    bool IsDone = false;
     {
-        Size /= 1024;
-
-        switch (Unit)
+        std::lock_guard<std::mutex> Lock { Pending.Mutex };
+        if (Pending.IsListed)
         {
-        case MemoryUnit::B: Unit = MemoryUnit::KB; break;
-        case MemoryUnit::KB: Unit = MemoryUnit::MB; break;
-        case MemoryUnit::MB: Unit = MemoryUnit::GB; break;
-        case MemoryUnit::GB: Unit = MemoryUnit::TB; break;
-        case MemoryUnit::TB:
-        default:
-            Unit = MemoryUnit::PB;
+            Pending.Items = std::move(Pending.Listed);
+            Pending.IsListed = false;
         }
+        Sizes.swap(Pending.Sizes);
+        IsDone = Pending.IsDone;
+    }
 
-        if (Unit == MemoryUnit::PB)
+    for (const std::pair<size_t, uintmax_t>& Size : Sizes)
+    {
+        Pending.Items[Size.first].FileSize = Size.second;
+        if (Size.first < Pending.Rows)
         {
-            break;
+            m_ListData->SetText(Size.first, 1, FormatSize(Size.second));
         }
     }
 
-    Outer->AddControl<Text>()
-        ->SetText((std::to_string(Size) + " " + ToString(Unit)).c_str());
+    // A fixed number of rows is added each update so that a large directory does not
+    // hold up the frame.
+    const size_t End = std::min(Pending.Rows + RowsPerUpdate, Pending.Items.size());
+    const bool Added = End > Pending.Rows;
+    m_ListData->Resize(End);
+    for (; Pending.Rows < End; Pending.Rows++)
+    {
+        const FileSystem::DirectoryItem& Item = Pending.Items[Pending.Rows];
+        m_ListData->SetText(Pending.Rows, 0, String::ToMultiByte(Item.FileName));
+        m_ListData->SetText(Pending.Rows, 1, Item.FileSize == UnknownSize ? "" : FormatSize(Item.FileSize));
+    }
+
+    if (!Sizes.empty() || Added)
+    {
+        m_DirectoryList->DataChanged();
+    }
+
+    if (IsDone && Pending.Rows == Pending.Items.size())
+    {
+        CancelEnumeration();
+    }
+}
+
+void FileDialog::CancelEnumeration()
+{
+    m_EnumerationTimer->Stop();
+
+    if (!m_Enumeration)
+    {
+        return;
+    }
+
+    // The worker stops at its next check and releases the state once it returns.
+    m_Enumeration->Cancelled = true;
+    m_Enumeration = nullptr;
 }
 
 void FileDialog::Close(bool Success)
 {
+    CancelEnumeration();
+
     if (!Success)
     {
         m_FileName->SetText(U"");
@@ -528,21 +739,4 @@ bool FileDialog::IsEmpty(const std::shared_ptr<Tree>& Item) const
     return true;
 }
 
-bool FileDialog::HasDirectories(const std::u32string& Directory) const
-{
-    const FileSystem& FS = GetWindow()->App().FS();
-    const std::vector<FileSystem::DirectoryItem> Items = FS.DirectoryItems(Directory.c_str());
-
-    for (const FileSystem::DirectoryItem& Item : Items)
-    {
-        const std::u32string Path { FS.CombinePath(Directory, Item.FileName) };
-        if (FS.IsDirectory(Path))
-        {
-            return true;
-        }
-    }
-
-    return false;
-}
-
 }
@@ -36,8 +36,10 @@ class Application;
 class ComboBox;
 class ScrollableViewControl;
 class Table;
+class TableData;
 class TextButton;
 class TextInput;
+class Timer;
 class Tree;
 
 struct FileDialogFilter
@@ -57,22 +59,25 @@ public:
     static void Show(Application& App, FileDialogType Type, const std::vector<FileDialogFilter>& Filters, OnCloseSignature&& OnClose);
 
     FileDialog(Window* InWindow);
+    virtual ~FileDialog();
 
     FileDialog& SetType(FileDialogType Type);
     FileDialog& SetFilters(const std::vector<FileDialogFilter>& Filters);
     FileDialog& SetOnClose(OnCloseSignature&& Fn);
 
 private:
+    struct Enumeration;
+
     void PopulateTree();
     void PopulateChildren(const std::shared_ptr<Tree>& Parent, const std::u32string& Directory) const;
     void PopulateList();
-    void AddListItem(const char32_t* Name, size_t Size);
+    void UpdateEnumeration();
+    void CancelEnumeration();
     void Close(bool Success);
     void OnConfirm();
 
     std::u32string Path(const std::shared_ptr<Tree>& Item) const;
     bool IsEmpty(const std::shared_ptr<Tree>& Item) const;
-    bool HasDirectories(const std::u32string& Directory) const;
 
     std::u32string m_Directory {};
     std::u32string m_Selected {};
@@ -83,10 +88,17 @@ private:
     std::shared_ptr<ScrollableViewControl> m_DirectoryView { nullptr };
     std::shared_ptr<Tree> m_DirectoryTree { nullptr };
     std::shared_ptr<Table> m_DirectoryList { nullptr };
+    std::shared_ptr<TableData> m_ListData { nullptr };
     std::shared_ptr<TextInput> m_FileName { nullptr };
     std::shared_ptr<ComboBox> m_FilterBox { nullptr };
     std::shared_ptr<TextButton> m_ConfirmButton { nullptr };
 
+    // Directory listings are enumerated on a worker thread and added to the list in
+    // chunks by the timer. The worker is not waited on when cancelled, so the state
+    // is shared with it.
+    std::shared_ptr<Enumeration> m_Enumeration { nullptr };
+    std::shared_ptr<Timer> m_EnumerationTimer { nullptr };
+
     OnCloseSignature m_OnClose { nullptr };
 };
 
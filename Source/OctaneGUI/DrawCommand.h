@@ -46,6 +46,8 @@ public:
     Rect Clip() const;
 
 private:
+    friend class VertexBuffer;
+
     DrawCommand();
 
     uint32_t m_VertexOffset;
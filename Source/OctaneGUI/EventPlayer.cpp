@@ -0,0 +1,324 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "EventPlayer.h"
+#include "EventRecorder.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class EventReader
+{
+public:
+    EventReader(const std::vector<uint8_t>& Stream)
+        : m_Stream(Stream)
+    {
+    }
+
+    bool IsValid() const
+    {
+        return m_Valid;
+    }
+
+    bool AtEnd() const
+    {
+        return m_Offset >= m_Stream.size();
+    }
+
+    uint8_t Byte()
+    {
+        if (m_Offset + 1 > m_Stream.size())
+        {
+            m_Valid = false;
+            return 0;
+        }
+
+        return m_Stream[m_Offset++];
+    }
+
+    uint64_t VarInt()
+    {
+        uint64_t Result = 0;
+        for (int Shift = 0; Shift < 64 && m_Valid; Shift += 7)
+        {
+            const uint8_t Value = Byte();
+            Result |= (uint64_t)(Value & 0x7F) << Shift;
+            if ((Value & 0x80) == 0)
+            {
+                break;
+            }
+        }
+        return Result;
+    }
+
+    float Float()
+    {
+        float Result = 0.0f;
+        if (m_Offset + sizeof(float) > m_Stream.size())
+        {
+            m_Valid = false;
+            return Result;
+        }
+
+        std::memcpy(&Result, &m_Stream[m_Offset], sizeof(float));
+        m_Offset += sizeof(float);
+        return Result;
+    }
+
+    Vector2 Vector()
+    {
+        const float X = Float();
+        const float Y = Float();
+        return { X, Y };
+    }
+
+    std::string String(size_t Length)
+    {
+        if (m_Offset + Length > m_Stream.size())
+        {
+            m_Valid = false;
+            return "";
+        }
+
+        std::string Result(reinterpret_cast<const char*>(&m_Stream[m_Offset]), Length);
+        m_Offset += Length;
+        return Result;
+    }
+
+    void Skip(size_t Count)
+    {
+        m_Offset += Count;
+    }
+
+private:
+    const std::vector<uint8_t>& m_Stream;
+    size_t m_Offset { 0 };
+    bool m_Valid { true };
+};
+
+static Event ReadEvent(EventReader& Stream)
+{
+    const Event::Type Type = (Event::Type)Stream.Byte();
+    switch (Type)
+    {
+    case Event::Type::KeyPressed:
+    case Event::Type::KeyReleased: return Event(Type, Event::Key((Keyboard::Key)Stream.VarInt()));
+    case Event::Type::MouseMoved:
+    {
+        const Vector2 Position = Stream.Vector();
+        return Event(Event::MouseMove(Position.X, Position.Y));
+    }
+    case Event::Type::MousePressed:
+    case Event::Type::MouseReleased:
+    {
+        const Mouse::Button Button = (Mouse::Button)Stream.Byte();
+        const Vector2 Position = Stream.Vector();
+        const Mouse::Count Count = (Mouse::Count)Stream.Byte();
+        return Event(Type, Event::MouseButton(Button, Position.X, Position.Y, Count));
+    }
+    case Event::Type::MouseWheel:
+    {
+        const Vector2 Delta = Stream.Vector();
+        return Event(Event::MouseWheel((int)Delta.X, (int)Delta.Y));
+    }
+    case Event::Type::Text: return Event(Event::Text((uint32_t)Stream.VarInt()));
+    case Event::Type::WindowResized:
+    {
+        const Vector2 Size = Stream.Vector();
+        return Event(Event::WindowResized(Size.X, Size.Y));
+    }
+    case Event::Type::WindowMoved:
+    case Event::Type::WindowMaximized: return Event(Type, Event::WindowMoved(Stream.Vector()));
+    default: break;
+    }
+
+    return Event(Type);
+}
+
+EventPlayer::EventPlayer()
+{
+}
+
+EventPlayer::~EventPlayer()
+{
+}
+
+bool EventPlayer::Load(const char* Path)
+{
+    m_Windows.clear();
+    m_Frame = 0;
+    m_Started = false;
+    m_Pending = 0;
+
+    std::ifstream Stream(Path, std::ios_base::in | std::ios_base::binary);
+    if (!Stream.is_open())
+    {
+        return false;
+    }
+
+    const std::vector<uint8_t> Contents { std::istreambuf_iterator<char>(Stream), std::istreambuf_iterator<char>() };
+    uint32_t Header[2] {};
+    if (Contents.size() < sizeof(Header))
+    {
+        return false;
+    }
+
+    std::memcpy(Header, Contents.data(), sizeof(Header));
+    if (Header[0] != EventRecorder::Magic || Header[1] != EventRecorder::Version)
+    {
+        return false;
+    }
+
+    EventReader Source(Contents);
+    Source.Skip(sizeof(Header));
+
+    std::unordered_map<uint8_t, std::string> Names;
+    uint64_t Frame = 0;
+    int64_t Time = 0;
+    while (!Source.AtEnd() && Source.IsValid())
+    {
+        const EventRecorder::Tag Type = (EventRecorder::Tag)Source.Byte();
+        if (Type == EventRecorder::Tag::Window)
+        {
+            const uint8_t Index = Source.Byte();
+            Names[Index] = Source.String((size_t)Source.VarInt());
+        }
+        else if (Type == EventRecorder::Tag::Event)
+        {
+            const uint8_t Index = Source.Byte();
+            Frame += Source.VarInt();
+            Time += (int64_t)Source.VarInt();
+            const Event Data = ReadEvent(Source);
+
+            if (Source.IsValid() && Names.count(Index) > 0)
+            {
+                m_Windows[Names[Index]].push_back({ Frame, Time, Data });
+                m_Pending++;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return Source.IsValid();
+}
+
+EventPlayer& EventPlayer::SetSpeed(Speed Value)
+{
+    m_Speed = Value;
+    return *this;
+}
+
+EventPlayer::Speed EventPlayer::GetSpeed() const
+{
+    return m_Speed;
+}
+
+void EventPlayer::BeginFrame()
+{
+    if (!m_Started)
+    {
+        m_Started = true;
+        m_Start = std::chrono::steady_clock::now();
+    }
+
+    if (m_Speed == Speed::Recorded)
+    {
+        m_Frame++;
+        return;
+    }
+
+    // Frames without any events are skipped.
+    uint64_t Next = UINT64_MAX;
+    for (const std::pair<const std::string, std::deque<Item>>& Window : m_Windows)
+    {
+        if (!Window.second.empty())
+        {
+            Next = std::min<uint64_t>(Next, Window.second.front().Frame);
+        }
+    }
+
+    if (Next != UINT64_MAX)
+    {
+        m_Frame = std::max<uint64_t>(m_Frame + 1, Next);
+    }
+}
+
+bool EventPlayer::HasNext(const char* WindowID) const
+{
+    const auto It = m_Windows.find(WindowID);
+    if (!m_Started || It == m_Windows.end() || It->second.empty())
+    {
+        return false;
+    }
+
+    const Item& Front = It->second.front();
+    if (Front.Frame > m_Frame)
+    {
+        return false;
+    }
+
+    if (m_Speed == Speed::Recorded)
+    {
+        const int64_t Elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_Start).count();
+        return Front.Time <= Elapsed;
+    }
+
+    return true;
+}
+
+Event EventPlayer::Next(const char* WindowID)
+{
+    if (!HasNext(WindowID))
+    {
+        return Event(Event::Type::None);
+    }
+
+    std::deque<Item>& Queue = m_Windows[WindowID];
+    const Event Result = Queue.front().Data;
+    Queue.pop_front();
+    m_Pending--;
+    return Result;
+}
+
+bool EventPlayer::IsFinished() const
+{
+    return m_Pending == 0;
+}
+
+size_t EventPlayer::Pending() const
+{
+    return m_Pending;
+}
+
+}
@@ -0,0 +1,91 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "Event.h"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+namespace OctaneGUI
+{
+
+/// @brief Feeds events written by an EventRecorder back to an Application.
+///
+/// Events are delivered in the order they were recorded for each window, grouped into
+/// the same frames. At Recorded speed, an event is also held back until as much time has
+/// passed since playback started as had passed when it was recorded. At Max speed, each
+/// frame delivers the next group of events regardless of time.
+class EventPlayer
+{
+public:
+    enum class Speed : uint8_t
+    {
+        Recorded,
+        Max
+    };
+
+    EventPlayer();
+    ~EventPlayer();
+
+    bool Load(const char* Path);
+
+    EventPlayer& SetSpeed(Speed Value);
+    Speed GetSpeed() const;
+
+    /// @brief Advances to the next frame. Starts playback on the first call.
+    void BeginFrame();
+
+    bool HasNext(const char* WindowID) const;
+    Event Next(const char* WindowID);
+
+    bool IsFinished() const;
+
+    /// @brief Number of events that have not been delivered yet.
+    size_t Pending() const;
+
+private:
+    struct Item
+    {
+    public:
+        uint64_t Frame { 0 };
+        int64_t Time { 0 };
+        Event Data { Event::Type::None };
+    };
+
+    std::unordered_map<std::string, std::deque<Item>> m_Windows {};
+    Speed m_Speed { Speed::Recorded };
+    std::chrono::steady_clock::time_point m_Start {};
+    uint64_t m_Frame { 0 };
+    bool m_Started { false };
+    size_t m_Pending { 0 };
+};
+
+}
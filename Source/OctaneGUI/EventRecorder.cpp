@@ -0,0 +1,194 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "EventRecorder.h"
+#include "Event.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace OctaneGUI
+{
+
+static void WriteByte(std::vector<uint8_t>& Stream, uint8_t Value)
+{
+    Stream.push_back(Value);
+}
+
+static void WriteVarInt(std::vector<uint8_t>& Stream, uint64_t Value)
+{
+    while (Value >= 0x80)
+    {
+        Stream.push_back((uint8_t)(Value | 0x80));
+        Value >>= 7;
+    }
+    Stream.push_back((uint8_t)Value);
+}
+
+static void WriteFloat(std::vector<uint8_t>& Stream, float Value)
+{
+    uint8_t Bytes[sizeof(float)];
+    std::memcpy(Bytes, &Value, sizeof(float));
+    Stream.insert(Stream.end(), Bytes, Bytes + sizeof(float));
+}
+
+static void WriteVector(std::vector<uint8_t>& Stream, const Vector2& Value)
+{
+    WriteFloat(Stream, Value.X);
+    WriteFloat(Stream, Value.Y);
+}
+
+static void WriteData(std::vector<uint8_t>& Stream, const Event& Item)
+{
+    const Event::Data& Data = Item.GetData();
+    switch (Item.GetType())
+    {
+    case Event::Type::KeyPressed:
+    case Event::Type::KeyReleased: WriteVarInt(Stream, (uint64_t)Data.m_Key.m_Code); break;
+    case Event::Type::MouseMoved: WriteVector(Stream, Data.m_MouseMove.m_Position); break;
+    case Event::Type::MousePressed:
+    case Event::Type::MouseReleased:
+        WriteByte(Stream, (uint8_t)Data.m_MouseButton.m_Button);
+        WriteVector(Stream, Data.m_MouseButton.m_Position);
+        WriteByte(Stream, (uint8_t)Data.m_MouseButton.m_Count);
+        break;
+    case Event::Type::MouseWheel: WriteVector(Stream, Data.m_MouseWheel.Delta); break;
+    case Event::Type::Text: WriteVarInt(Stream, Data.m_Text.Code); break;
+    case Event::Type::WindowResized: WriteVector(Stream, Data.m_Resized.m_Size); break;
+    case Event::Type::WindowMoved:
+    case Event::Type::WindowMaximized: WriteVector(Stream, Data.m_Moved.m_Position); break;
+    default: break;
+    }
+}
+
+EventRecorder::EventRecorder()
+{
+}
+
+EventRecorder::~EventRecorder()
+{
+    Close();
+}
+
+bool EventRecorder::Open(const char* Path)
+{
+    Close();
+
+    m_Stream.open(Path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!m_Stream.is_open())
+    {
+        return false;
+    }
+
+    m_Windows.clear();
+    m_Start = std::chrono::steady_clock::now();
+    m_Frame = 0;
+    m_LastFrame = 0;
+    m_LastTime = 0;
+    m_Count = 0;
+
+    const uint32_t Header[2] { Magic, Version };
+    m_Stream.write(reinterpret_cast<const char*>(Header), sizeof(Header));
+    return true;
+}
+
+bool EventRecorder::IsOpen() const
+{
+    return m_Stream.is_open();
+}
+
+void EventRecorder::Close()
+{
+    if (!m_Stream.is_open())
+    {
+        return;
+    }
+
+    Flush();
+    m_Stream.close();
+}
+
+void EventRecorder::BeginFrame()
+{
+    m_Frame++;
+}
+
+void EventRecorder::Record(const char* WindowID, const Event& Item)
+{
+    if (!m_Stream.is_open())
+    {
+        return;
+    }
+
+    auto It = m_Windows.find(WindowID);
+    if (It == m_Windows.end())
+    {
+        const uint8_t Index = (uint8_t)m_Windows.size();
+        const size_t Length = std::strlen(WindowID);
+        WriteByte(m_Buffer, (uint8_t)Tag::Window);
+        WriteByte(m_Buffer, Index);
+        WriteVarInt(m_Buffer, Length);
+        m_Buffer.insert(m_Buffer.end(), WindowID, WindowID + Length);
+        It = m_Windows.emplace(WindowID, Index).first;
+    }
+
+    const int64_t Time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_Start).count();
+    WriteByte(m_Buffer, (uint8_t)Tag::Event);
+    WriteByte(m_Buffer, It->second);
+    WriteVarInt(m_Buffer, m_Frame - m_LastFrame);
+    WriteVarInt(m_Buffer, (uint64_t)std::max<int64_t>(Time - m_LastTime, 0));
+    WriteByte(m_Buffer, (uint8_t)Item.GetType());
+    WriteData(m_Buffer, Item);
+
+    m_LastFrame = m_Frame;
+    m_LastTime = std::max<int64_t>(Time, m_LastTime);
+    m_Count++;
+
+    // Keep memory bounded for long sessions.
+    if (m_Buffer.size() >= 64 * 1024)
+    {
+        Flush();
+    }
+}
+
+size_t EventRecorder::Count() const
+{
+    return m_Count;
+}
+
+void EventRecorder::Flush()
+{
+    if (m_Buffer.empty())
+    {
+        return;
+    }
+
+    m_Stream.write(reinterpret_cast<const char*>(m_Buffer.data()), m_Buffer.size());
+    m_Stream.flush();
+    m_Buffer.clear();
+}
+
+}
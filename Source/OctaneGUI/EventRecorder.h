@@ -0,0 +1,90 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class Event;
+
+/// @brief Writes the events processed by an Application to a compact binary log.
+///
+/// Each event is stored with the ID of the window it was sent to, the frame it was
+/// processed in and the time since recording started, so that an EventPlayer can feed
+/// them back in the same frames or at the same times.
+///
+/// The log starts with Magic and Version followed by records. A window record assigns an
+/// index to a window ID and an event record holds the window index, the frame and time
+/// deltas as variable length integers, the event type and its data.
+class EventRecorder
+{
+public:
+    static constexpr uint32_t Magic = 0x5645474F; // "OGEV"
+    static constexpr uint32_t Version = 1;
+
+    enum class Tag : uint8_t
+    {
+        Window = 1,
+        Event = 2,
+    };
+
+    EventRecorder();
+    ~EventRecorder();
+
+    bool Open(const char* Path);
+    bool IsOpen() const;
+
+    /// @brief Writes any buffered records and closes the file.
+    void Close();
+
+    void BeginFrame();
+    void Record(const char* WindowID, const Event& Item);
+
+    /// @brief Number of events recorded since the file was opened.
+    size_t Count() const;
+
+private:
+    void Flush();
+
+    std::ofstream m_Stream {};
+    std::vector<uint8_t> m_Buffer {};
+    std::unordered_map<std::string, uint8_t> m_Windows {};
+    std::chrono::steady_clock::time_point m_Start {};
+    uint64_t m_Frame { 0 };
+    uint64_t m_LastFrame { 0 };
+    int64_t m_LastTime { 0 };
+    size_t m_Count { 0 };
+};
+
+}
@@ -26,6 +26,7 @@ SOFTWARE.
 
 #include "FileSystem.h"
 #include "Dialogs/FileDialog.h"
+#include "FileWatcher.h"
 #include "String.h"
 
 #include <filesystem>
@@ -131,12 +132,35 @@ std::vector<FileSystem::DirectoryItem> FileSystem::DirectoryItems(const std::u32
     for (const std::filesystem::directory_entry& Entry : std::filesystem::directory_iterator(Location, Options, Error))
     {
         uintmax_t Size = Entry.is_regular_file() ? Entry.file_size() : 0;
-        Result.push_back({ Entry.path().filename().u32string(), Size });
+        Result.push_back({ Entry.path().filename().u32string(), Size, Entry.is_directory() });
     }
 
     return Result;
 }
 
+void FileSystem::DirectoryItems(const std::u32string& Location, OnDirectoryItemSignature&& Callback) const
+{
+    const std::filesystem::directory_options Options { std::filesystem::directory_options::skip_permission_denied };
+    std::error_code Error;
+    for (const std::filesystem::directory_entry& Entry : std::filesystem::directory_iterator(Location, Options, Error))
+    {
+        // The entry's type is usually cached from the directory read, so no additional
+        // stat call is made here.
+        std::error_code TypeError;
+        if (!Callback({ Entry.path().filename().u32string(), 0, Entry.is_directory(TypeError) }))
+        {
+            break;
+        }
+    }
+}
+
+uintmax_t FileSystem::FileSize(const std::u32string& Location) const
+{
+    std::error_code Error;
+    const uintmax_t Result = std::filesystem::file_size(Location, Error);
+    return Error ? 0 : Result;
+}
+
 std::string FileSystem::LoadContents(const std::string& Location) const
 {
     std::string Result {};
@@ -246,4 +270,68 @@ FileSystem& FileSystem::SetOnFileDialogResult(OnFileDialogResultSignature&& Fn)
     return *this;
 }
 
+uint32_t FileSystem::Watch(const std::u32string& Location, bool Recursive, OnFilesChangedSignature&& Callback)
+{
+    if (!m_Watcher)
+    {
+        m_Watcher = std::make_unique<FileWatcher>(m_WatchPolling);
+        m_Watcher
+            ->SetDebounce(m_WatchDebounceMS)
+            .SetPollInterval(m_WatchPollIntervalMS);
+    }
+
+    return m_Watcher->Add(Location, Recursive, std::move(Callback));
+}
+
+bool FileSystem::Unwatch(uint32_t ID)
+{
+    return m_Watcher ? m_Watcher->Remove(ID) : false;
+}
+
+FileSystem& FileSystem::SetWatchPolling(bool WatchPolling)
+{
+    if (m_WatchPolling != WatchPolling)
+    {
+        m_WatchPolling = WatchPolling;
+        m_Watcher = nullptr;
+    }
+
+    return *this;
+}
+
+bool FileSystem::WatchPolling() const
+{
+    return m_Watcher ? m_Watcher->IsPolling() : m_WatchPolling;
+}
+
+FileSystem& FileSystem::SetWatchDebounce(int DebounceMS)
+{
+    m_WatchDebounceMS = DebounceMS;
+    if (m_Watcher)
+    {
+        m_Watcher->SetDebounce(DebounceMS);
+    }
+
+    return *this;
+}
+
+FileSystem& FileSystem::SetWatchPollInterval(int IntervalMS)
+{
+    m_WatchPollIntervalMS = IntervalMS;
+    if (m_Watcher)
+    {
+        m_Watcher->SetPollInterval(IntervalMS);
+    }
+
+    return *this;
+}
+
+void FileSystem::ProcessWatches()
+{
+    if (m_Watcher)
+    {
+        m_Watcher->Process();
+    }
+}
+
 }
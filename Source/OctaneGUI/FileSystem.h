@@ -30,6 +30,7 @@ SOFTWARE.
 
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -37,6 +38,7 @@ namespace OctaneGUI
 {
 
 class Application;
+class FileWatcher;
 struct FileDialogFilter;
 
 class FileSystem
@@ -47,10 +49,27 @@ public:
     public:
         std::u32string FileName {};
         uintmax_t FileSize { 0 };
+        bool IsDirectory { false };
+    };
+
+    struct FileChange
+    {
+    public:
+        enum class Type : uint8_t
+        {
+            Added,
+            Modified,
+            Removed
+        };
+
+        Type Change { Type::Modified };
+        std::u32string Location {};
     };
 
     typedef std::function<std::u32string(FileDialogType, const std::vector<FileDialogFilter>&)> OnFileDialogSignature;
     typedef std::function<void(FileDialogType, const std::u32string&)> OnFileDialogResultSignature;
+    typedef std::function<bool(DirectoryItem&&)> OnDirectoryItemSignature;
+    typedef std::function<void(const std::vector<FileChange>&)> OnFilesChangedSignature;
 
     static std::string Extension(const std::string& Location);
     static std::u32string Extension(const std::u32string& Location);
@@ -70,6 +89,16 @@ public:
     std::u32string FileName(const std::u32string& Location) const;
     std::vector<DirectoryItem> DirectoryItems(const std::u32string& Location) const;
 
+    /// @brief Enumerates the items of a directory without querying their file sizes.
+    ///
+    /// This only reads the directory itself, which makes it much cheaper than the
+    /// overload returning a vector for large directories. It is safe to call from
+    /// a worker thread.
+    /// @param Location The directory to enumerate.
+    /// @param Callback Invoked for each item. Returning false stops the enumeration.
+    void DirectoryItems(const std::u32string& Location, OnDirectoryItemSignature&& Callback) const;
+    uintmax_t FileSize(const std::u32string& Location) const;
+
     std::string LoadContents(const std::string& Location) const;
     std::string LoadContents(const std::u32string& Location) const;
 
@@ -83,6 +112,33 @@ public:
 
     void FileDialog(FileDialogType Type, const std::vector<FileDialogFilter>& Filters = {}) const;
 
+    /// @brief Watches a file or directory for changes made outside of the application.
+    ///
+    /// Changes are collected on a background thread and delivered in batches on the main
+    /// thread once the item has not changed for the debounce interval. Watching a
+    /// directory reports changes to its items, and to all sub-directories if recursive.
+    /// Directories are added to the watch on the background thread, so changes made
+    /// immediately after this call may not be reported.
+    /// @param Location The file or directory to watch. Must exist.
+    /// @param Recursive Also watch all sub-directories of a directory.
+    /// @param Callback Invoked on the main thread with the coalesced changes.
+    /// @return ID used to stop watching, or 0 if the location could not be watched.
+    uint32_t Watch(const std::u32string& Location, bool Recursive, OnFilesChangedSignature&& Callback);
+    bool Unwatch(uint32_t ID);
+
+    /// @brief Forces watches to poll the file system instead of using system notifications.
+    ///
+    /// Polling is always used on platforms without a notification backend. Changing this
+    /// removes all existing watches.
+    FileSystem& SetWatchPolling(bool WatchPolling);
+    bool WatchPolling() const;
+    FileSystem& SetWatchDebounce(int DebounceMS);
+    FileSystem& SetWatchPollInterval(int IntervalMS);
+
+    /// @brief Delivers any pending changes to the watch callbacks. Called by the
+    /// Application every frame.
+    void ProcessWatches();
+
     FileSystem& SetOnFileDialog(OnFileDialogSignature&& Fn);
     FileSystem& SetOnFileDialogResult(OnFileDialogResultSignature&& Fn);
 
@@ -92,6 +148,11 @@ private:
 
     OnFileDialogSignature m_OnFileDialog { nullptr };
     OnFileDialogResultSignature m_OnFileDialogResult { nullptr };
+
+    std::unique_ptr<FileWatcher> m_Watcher { nullptr };
+    bool m_WatchPolling { false };
+    int m_WatchDebounceMS { 100 };
+    int m_WatchPollIntervalMS { 500 };
 };
 
 }
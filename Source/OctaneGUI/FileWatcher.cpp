@@ -0,0 +1,651 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "FileWatcher.h"
+
+#include <algorithm>
+#include <iterator>
+
+#ifdef LINUX
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace OctaneGUI
+{
+
+static uint64_t Mix(uint64_t Value)
+{
+    Value += 0x9E3779B97F4A7C15ull;
+    Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+    return Value ^ (Value >> 31);
+}
+
+FileWatcher::FileWatcher(bool UsePolling)
+    : m_Polling(UsePolling)
+{
+#ifdef LINUX
+    if (!m_Polling)
+    {
+        m_Notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        m_WakeEvent = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_Notify != -1 && m_WakeEvent != -1)
+        {
+            m_Thread = std::thread([this]() -> void
+                {
+                    RunNotify();
+                });
+            return;
+        }
+
+        // Fall back to polling if inotify is not available.
+        if (m_Notify != -1)
+        {
+            close(m_Notify);
+            m_Notify = -1;
+        }
+
+        if (m_WakeEvent != -1)
+        {
+            close(m_WakeEvent);
+            m_WakeEvent = -1;
+        }
+    }
+#endif
+
+    m_Polling = true;
+    m_Thread = std::thread([this]() -> void
+        {
+            RunPolling();
+        });
+}
+
+FileWatcher::~FileWatcher()
+{
+    {
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        m_Stop = true;
+    }
+    m_Wake.notify_all();
+
+#ifdef LINUX
+    if (m_WakeEvent != -1)
+    {
+        const uint64_t Value = 1;
+        [[maybe_unused]] const ssize_t Written = write(m_WakeEvent, &Value, sizeof(Value));
+    }
+#endif
+
+    if (m_Thread.joinable())
+    {
+        m_Thread.join();
+    }
+
+#ifdef LINUX
+    if (m_Notify != -1)
+    {
+        close(m_Notify);
+    }
+
+    if (m_WakeEvent != -1)
+    {
+        close(m_WakeEvent);
+    }
+#endif
+}
+
+bool FileWatcher::IsPolling() const
+{
+    return m_Polling;
+}
+
+FileWatcher& FileWatcher::SetDebounce(int DebounceMS)
+{
+    m_DebounceMS = DebounceMS;
+    return *this;
+}
+
+FileWatcher& FileWatcher::SetPollInterval(int IntervalMS)
+{
+    m_PollIntervalMS = IntervalMS;
+    m_Wake.notify_all();
+    return *this;
+}
+
+uint32_t FileWatcher::Add(const std::u32string& Location, bool Recursive, FileSystem::OnFilesChangedSignature&& Callback)
+{
+    const std::filesystem::path Path { Location };
+    std::error_code Error;
+    const std::filesystem::file_status Status = std::filesystem::status(Path, Error);
+    if (Error || !std::filesystem::exists(Status))
+    {
+        return 0;
+    }
+
+    // Files are watched through their directory so that they are still followed when
+    // saved by replacing the file.
+    Watch Item;
+    if (std::filesystem::is_directory(Status))
+    {
+        Item.Directory = Path;
+        Item.Recursive = Recursive;
+    }
+    else
+    {
+        Item.Directory = Path.parent_path().empty() ? std::filesystem::path(".") : Path.parent_path();
+        Item.FileName = Path.filename().string();
+    }
+    Item.Callback = std::move(Callback);
+
+    uint32_t ID = 0;
+    {
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        ID = m_NextID++;
+        m_Watches.emplace(ID, std::move(Item));
+#ifdef LINUX
+        m_Added.push_back(ID);
+#endif
+    }
+
+#ifdef LINUX
+    if (!m_Polling)
+    {
+        const uint64_t Value = 1;
+        [[maybe_unused]] const ssize_t Written = write(m_WakeEvent, &Value, sizeof(Value));
+    }
+#endif
+
+    m_Wake.notify_all();
+    return ID;
+}
+
+bool FileWatcher::Remove(uint32_t ID)
+{
+    std::lock_guard<std::mutex> Lock { m_Mutex };
+    if (m_Watches.erase(ID) == 0)
+    {
+        return false;
+    }
+
+    for (std::map<std::pair<uint32_t, std::string>, Pending>::iterator It = m_Pending.begin(); It != m_Pending.end();)
+    {
+        It = It->first.first == ID ? m_Pending.erase(It) : std::next(It);
+    }
+
+#ifdef LINUX
+    for (std::unordered_map<int, std::vector<std::pair<uint32_t, std::filesystem::path>>>::iterator It = m_Descriptors.begin(); It != m_Descriptors.end();)
+    {
+        std::vector<std::pair<uint32_t, std::filesystem::path>>& Owners = It->second;
+        Owners.erase(std::remove_if(Owners.begin(), Owners.end(), [ID](const std::pair<uint32_t, std::filesystem::path>& Owner) -> bool
+                         {
+                             return Owner.first == ID;
+                         }),
+            Owners.end());
+
+        if (Owners.empty())
+        {
+            inotify_rm_watch(m_Notify, It->first);
+            It = m_Descriptors.erase(It);
+        }
+        else
+        {
+            ++It;
+        }
+    }
+#endif
+
+    return true;
+}
+
+void FileWatcher::Process()
+{
+    std::vector<std::pair<FileSystem::OnFilesChangedSignature, std::vector<FileSystem::FileChange>>> Ready;
+
+    {
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        if (m_Pending.empty())
+        {
+            return;
+        }
+
+        std::unordered_map<uint32_t, size_t> Indices;
+        for (std::map<std::pair<uint32_t, std::string>, Pending>::iterator It = m_Pending.begin(); It != m_Pending.end();)
+        {
+            if (It->second.Stamp.MeasureMS() < m_DebounceMS)
+            {
+                ++It;
+                continue;
+            }
+
+            const uint32_t ID = It->first.first;
+            const std::unordered_map<uint32_t, Watch>::const_iterator Item = m_Watches.find(ID);
+            if (Item != m_Watches.end())
+            {
+                const std::pair<std::unordered_map<uint32_t, size_t>::iterator, bool> Index = Indices.emplace(ID, Ready.size());
+                if (Index.second)
+                {
+                    Ready.push_back({ Item->second.Callback, {} });
+                }
+
+                Ready[Index.first->second].second.push_back({ It->second.Change, std::filesystem::path(It->first.second).u32string() });
+            }
+
+            It = m_Pending.erase(It);
+        }
+    }
+
+    for (const std::pair<FileSystem::OnFilesChangedSignature, std::vector<FileSystem::FileChange>>& Item : Ready)
+    {
+        if (Item.first)
+        {
+            Item.first(Item.second);
+        }
+    }
+}
+
+void FileWatcher::Queue(uint32_t ID, const std::filesystem::path& Location, FileSystem::FileChange::Type Change)
+{
+    typedef FileSystem::FileChange::Type Type;
+
+    const std::pair<std::map<std::pair<uint32_t, std::string>, Pending>::iterator, bool> Result = m_Pending.emplace(std::make_pair(ID, Location.string()), Pending { Change });
+    if (Result.second)
+    {
+        return;
+    }
+
+    Pending& Item = Result.first->second;
+    if (Item.Change == Type::Added && Change == Type::Removed)
+    {
+        // Created and removed before it was ever reported.
+        m_Pending.erase(Result.first);
+        return;
+    }
+
+    if (Item.Change == Type::Removed && Change == Type::Added)
+    {
+        // Replaced, such as when an editor saves through a temporary file.
+        Item.Change = Type::Modified;
+    }
+    else if (Item.Change != Type::Added)
+    {
+        Item.Change = Change;
+    }
+
+    Item.Stamp.Reset();
+}
+
+void FileWatcher::RunPolling()
+{
+    while (!m_Stop)
+    {
+        std::vector<std::pair<uint32_t, Watch>> Items;
+        {
+            std::lock_guard<std::mutex> Lock { m_Mutex };
+            for (const std::pair<const uint32_t, Watch>& Item : m_Watches)
+            {
+                Items.push_back({ Item.first, { Item.second.Directory, Item.second.FileName, Item.second.Recursive, nullptr } });
+            }
+        }
+
+        for (std::unordered_map<uint32_t, PollState>::iterator It = m_PollStates.begin(); It != m_PollStates.end();)
+        {
+            const bool Exists = std::find_if(Items.begin(), Items.end(), [&](const std::pair<uint32_t, Watch>& Item) -> bool
+                                    {
+                                        return Item.first == It->first;
+                                    })
+                != Items.end();
+            It = Exists ? std::next(It) : m_PollStates.erase(It);
+        }
+
+        // Directories are scanned without holding the lock so that adding watches and
+        // delivering changes are not blocked by large directories.
+        for (const std::pair<uint32_t, Watch>& Item : Items)
+        {
+            ChangeList Changes;
+            Scan(m_PollStates[Item.first], Item.second, Changes);
+
+            if (!Changes.empty())
+            {
+                std::lock_guard<std::mutex> Lock { m_Mutex };
+                if (m_Watches.find(Item.first) != m_Watches.end())
+                {
+                    for (const std::pair<std::filesystem::path, FileSystem::FileChange::Type>& Change : Changes)
+                    {
+                        Queue(Item.first, Change.first, Change.second);
+                    }
+                }
+            }
+        }
+
+        std::unique_lock<std::mutex> Lock { m_Mutex };
+        m_Wake.wait_for(Lock, std::chrono::milliseconds(m_PollIntervalMS), [&]() -> bool
+            {
+                return m_Stop || m_Watches.size() != Items.size();
+            });
+    }
+}
+
+void FileWatcher::Scan(PollState& State, const Watch& Item, ChangeList& Changes) const
+{
+    std::unordered_set<std::string> Visited;
+    ScanDirectory(State, Item, Item.Directory, Changes, Visited);
+
+    for (std::unordered_map<std::string, Snapshot>::iterator It = State.Directories.begin(); It != State.Directories.end();)
+    {
+        It = Visited.find(It->first) == Visited.end() ? State.Directories.erase(It) : std::next(It);
+    }
+
+    // The first scan only records the current state.
+    if (!State.Scanned)
+    {
+        Changes.clear();
+        State.Scanned = true;
+    }
+}
+
+void FileWatcher::ScanDirectory(PollState& State, const Watch& Item, const std::filesystem::path& Directory, ChangeList& Changes, std::unordered_set<std::string>& Visited) const
+{
+    typedef FileSystem::FileChange::Type Type;
+
+    Visited.insert(Directory.string());
+
+    struct Entry
+    {
+    public:
+        std::string Name {};
+        int64_t Time { 0 };
+        uintmax_t Size { 0 };
+        bool IsDirectory { false };
+    };
+
+    std::vector<Entry> Entries;
+    uint64_t Hash = 0;
+    const std::filesystem::directory_options Options { std::filesystem::directory_options::skip_permission_denied };
+    std::error_code Error;
+    for (const std::filesystem::directory_entry& Child : std::filesystem::directory_iterator(Directory, Options, Error))
+    {
+        Entry Current;
+        Current.Name = Child.path().filename().string();
+        if (!Item.FileName.empty() && Current.Name != Item.FileName)
+        {
+            continue;
+        }
+
+        // A directory's own time changes with its contents, which are reported separately.
+        std::error_code EntryError;
+        Current.IsDirectory = Child.is_directory(EntryError);
+        if (!Current.IsDirectory)
+        {
+            Current.Time = (int64_t)Child.last_write_time(EntryError).time_since_epoch().count();
+            Current.Size = Child.file_size(EntryError);
+        }
+
+        // Entries are summed so the hash does not depend on the enumeration order.
+        Hash += Mix(std::hash<std::string>()(Current.Name) ^ Mix((uint64_t)Current.Time ^ Mix(Current.Size)));
+        Entries.push_back(std::move(Current));
+    }
+
+    Snapshot& Previous = State.Directories[Directory.string()];
+    if (Previous.Hash != Hash || Previous.Entries.size() != Entries.size())
+    {
+        std::unordered_map<std::string, std::pair<int64_t, uintmax_t>> Current;
+        Current.reserve(Entries.size());
+        for (const Entry& Value : Entries)
+        {
+            const std::pair<int64_t, uintmax_t> Stamp { Value.Time, Value.Size };
+            const std::unordered_map<std::string, std::pair<int64_t, uintmax_t>>::const_iterator It = Previous.Entries.find(Value.Name);
+            if (It == Previous.Entries.end())
+            {
+                Changes.push_back({ Directory / Value.Name, Type::Added });
+            }
+            else if (It->second != Stamp)
+            {
+                Changes.push_back({ Directory / Value.Name, Type::Modified });
+            }
+
+            Current.emplace(Value.Name, Stamp);
+        }
+
+        for (const std::pair<const std::string, std::pair<int64_t, uintmax_t>>& Value : Previous.Entries)
+        {
+            if (Current.find(Value.first) == Current.end())
+            {
+                Changes.push_back({ Directory / Value.first, Type::Removed });
+            }
+        }
+
+        Previous.Hash = Hash;
+        Previous.Entries = std::move(Current);
+    }
+
+    if (!Item.Recursive)
+    {
+        return;
+    }
+
+    for (const Entry& Value : Entries)
+    {
+        if (Value.IsDirectory)
+        {
+            ScanDirectory(State, Item, Directory / Value.Name, Changes, Visited);
+        }
+    }
+}
+
+#ifdef LINUX
+static constexpr uint32_t NotifyMask { IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO };
+
+void FileWatcher::RunNotify()
+{
+    typedef FileSystem::FileChange::Type Type;
+
+    alignas(inotify_event) char Buffer[16384];
+    while (!m_Stop)
+    {
+        pollfd Descriptors[2] { { m_Notify, POLLIN, 0 }, { m_WakeEvent, POLLIN, 0 } };
+        if (poll(Descriptors, 2, -1) <= 0 || m_Stop)
+        {
+            continue;
+        }
+
+        if (Descriptors[1].revents & POLLIN)
+        {
+            uint64_t Value = 0;
+            [[maybe_unused]] const ssize_t Read = read(m_WakeEvent, &Value, sizeof(Value));
+            AddWatches();
+        }
+
+        const ssize_t Length = read(m_Notify, Buffer, sizeof(Buffer));
+        if (Length <= 0)
+        {
+            continue;
+        }
+
+        // New directories are added once the lock is released.
+        std::vector<std::pair<uint32_t, std::filesystem::path>> Directories;
+        std::unique_lock<std::mutex> Lock { m_Mutex };
+        for (const char* Ptr = Buffer; Ptr < Buffer + Length;)
+        {
+            const inotify_event* Event = (const inotify_event*)Ptr;
+            Ptr += sizeof(inotify_event) + Event->len;
+
+            // Events were dropped, so report every watch as modified.
+            if (Event->mask & IN_Q_OVERFLOW)
+            {
+                for (const std::pair<const uint32_t, Watch>& Item : m_Watches)
+                {
+                    Queue(Item.first, Item.second.Directory / Item.second.FileName, Type::Modified);
+                }
+                continue;
+            }
+
+            const std::unordered_map<int, std::vector<std::pair<uint32_t, std::filesystem::path>>>::iterator Owners = m_Descriptors.find(Event->wd);
+            if (Owners == m_Descriptors.end())
+            {
+                continue;
+            }
+
+            if (Event->mask & IN_IGNORED)
+            {
+                m_Descriptors.erase(Owners);
+                continue;
+            }
+
+            if (Event->len == 0)
+            {
+                continue;
+            }
+
+            const std::string Name { Event->name };
+            Type Change = Type::Modified;
+            if (Event->mask & (IN_CREATE | IN_MOVED_TO))
+            {
+                Change = Type::Added;
+            }
+            else if (Event->mask & (IN_DELETE | IN_MOVED_FROM))
+            {
+                Change = Type::Removed;
+            }
+
+            for (const std::pair<uint32_t, std::filesystem::path>& Owner : Owners->second)
+            {
+                const std::unordered_map<uint32_t, Watch>::const_iterator Item = m_Watches.find(Owner.first);
+                if (Item == m_Watches.end() || (!Item->second.FileName.empty() && Item->second.FileName != Name))
+                {
+                    continue;
+                }
+
+                const std::filesystem::path Location = Owner.second / Name;
+                Queue(Owner.first, Location, Change);
+
+                if (Item->second.Recursive && (Event->mask & IN_ISDIR) && Change == Type::Added)
+                {
+                    Directories.push_back({ Owner.first, Location });
+                }
+            }
+        }
+        Lock.unlock();
+
+        for (const std::pair<uint32_t, std::filesystem::path>& Directory : Directories)
+        {
+            AddDirectory(Directory.first, Directory.second, true, true);
+        }
+    }
+}
+
+void FileWatcher::AddWatches()
+{
+    std::vector<std::pair<uint32_t, Watch>> Items;
+    {
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        for (uint32_t ID : m_Added)
+        {
+            const std::unordered_map<uint32_t, Watch>::const_iterator Item = m_Watches.find(ID);
+            if (Item != m_Watches.end())
+            {
+                Items.push_back({ ID, { Item->second.Directory, Item->second.FileName, Item->second.Recursive, nullptr } });
+            }
+        }
+        m_Added.clear();
+    }
+
+    for (const std::pair<uint32_t, Watch>& Item : Items)
+    {
+        AddDirectory(Item.first, Item.second.Directory, Item.second.Recursive, false);
+    }
+}
+
+void FileWatcher::AddDirectory(uint32_t ID, const std::filesystem::path& Directory, bool Recursive, bool ReportContents)
+{
+    const int Descriptor = inotify_add_watch(m_Notify, Directory.c_str(), NotifyMask | IN_ONLYDIR);
+    if (Descriptor == -1)
+    {
+        return;
+    }
+
+    {
+        // The watch may have been removed while its directories were being added.
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        if (m_Watches.find(ID) == m_Watches.end())
+        {
+            if (m_Descriptors.find(Descriptor) == m_Descriptors.end())
+            {
+                inotify_rm_watch(m_Notify, Descriptor);
+            }
+            return;
+        }
+
+        m_Descriptors[Descriptor].push_back({ ID, Directory });
+    }
+
+    if (!Recursive && !ReportContents)
+    {
+        return;
+    }
+
+    // Items may have been created in a new directory before it was watched. The tree is
+    // walked without holding the lock.
+    std::vector<std::filesystem::path> Items;
+    std::vector<std::filesystem::path> Directories;
+    const std::filesystem::directory_options Options { std::filesystem::directory_options::skip_permission_denied };
+    std::error_code Error;
+    for (const std::filesystem::directory_entry& Entry : std::filesystem::directory_iterator(Directory, Options, Error))
+    {
+        if (ReportContents)
+        {
+            Items.push_back(Entry.path());
+        }
+
+        std::error_code TypeError;
+        if (Recursive && Entry.is_directory(TypeError))
+        {
+            Directories.push_back(Entry.path());
+        }
+    }
+
+    if (!Items.empty())
+    {
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        if (m_Watches.find(ID) != m_Watches.end())
+        {
+            for (const std::filesystem::path& Item : Items)
+            {
+                Queue(ID, Item, FileSystem::FileChange::Type::Added);
+            }
+        }
+    }
+
+    for (const std::filesystem::path& Item : Directories)
+    {
+        AddDirectory(ID, Item, Recursive, ReportContents);
+    }
+}
+#endif
+
+}
@@ -0,0 +1,146 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "Clock.h"
+#include "Defines.h"
+#include "FileSystem.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Watches files and directories for changes on a background thread.
+///
+/// On Linux, changes are received from inotify. Other platforms, or when polling is
+/// requested, periodically compare a snapshot of each watched directory. Changes to
+/// the same item are coalesced and only delivered once no new change has been seen
+/// for the debounce interval. Callbacks are invoked on the thread calling Process.
+class FileWatcher
+{
+public:
+    FileWatcher(bool UsePolling);
+    ~FileWatcher();
+
+    bool IsPolling() const;
+    FileWatcher& SetDebounce(int DebounceMS);
+    FileWatcher& SetPollInterval(int IntervalMS);
+
+    uint32_t Add(const std::u32string& Location, bool Recursive, FileSystem::OnFilesChangedSignature&& Callback);
+    bool Remove(uint32_t ID);
+    void Process();
+
+private:
+    struct Watch
+    {
+    public:
+        std::filesystem::path Directory {};
+
+        // Only changes to this item within the directory are reported when set.
+        std::string FileName {};
+        bool Recursive { false };
+        FileSystem::OnFilesChangedSignature Callback { nullptr };
+    };
+
+    struct Pending
+    {
+    public:
+        FileSystem::FileChange::Type Change { FileSystem::FileChange::Type::Modified };
+        Clock Stamp {};
+    };
+
+    // Polling state for a single directory. The hash combines every entry so unchanged
+    // directories can be skipped without comparing each entry.
+    struct Snapshot
+    {
+    public:
+        uint64_t Hash { 0 };
+        std::unordered_map<std::string, std::pair<int64_t, uintmax_t>> Entries {};
+    };
+
+    struct PollState
+    {
+    public:
+        bool Scanned { false };
+        std::unordered_map<std::string, Snapshot> Directories {};
+    };
+
+    typedef std::vector<std::pair<std::filesystem::path, FileSystem::FileChange::Type>> ChangeList;
+
+    void Queue(uint32_t ID, const std::filesystem::path& Location, FileSystem::FileChange::Type Change);
+
+    void RunPolling();
+    void Scan(PollState& State, const Watch& Item, ChangeList& Changes) const;
+    void ScanDirectory(PollState& State, const Watch& Item, const std::filesystem::path& Directory, ChangeList& Changes, std::unordered_set<std::string>& Visited) const;
+
+#ifdef LINUX
+    void RunNotify();
+    void AddWatches();
+    void AddDirectory(uint32_t ID, const std::filesystem::path& Directory, bool Recursive, bool ReportContents);
+#endif
+
+    mutable std::mutex m_Mutex {};
+    std::unordered_map<uint32_t, Watch> m_Watches {};
+    std::map<std::pair<uint32_t, std::string>, Pending> m_Pending {};
+    uint32_t m_NextID { 1 };
+
+    std::atomic<bool> m_Stop { false };
+    std::atomic<int> m_DebounceMS { 100 };
+    std::atomic<int> m_PollIntervalMS { 500 };
+    bool m_Polling { true };
+    std::thread m_Thread {};
+
+    // Only accessed on the watcher thread.
+    std::unordered_map<uint32_t, PollState> m_PollStates {};
+    std::condition_variable m_Wake {};
+
+#ifdef LINUX
+    int m_Notify { -1 };
+    int m_WakeEvent { -1 };
+
+    // Multiple watches may share a directory and its descriptor.
+    std::unordered_map<int, std::vector<std::pair<uint32_t, std::filesystem::path>>> m_Descriptors {};
+
+    // Watches whose directories have not been added yet. Walking a directory tree can be
+    // slow, so this is done on the watcher thread instead of in Add.
+    std::vector<uint32_t> m_Added {};
+#endif
+};
+
+}
@@ -27,21 +27,32 @@ SOFTWARE.
 #include "FlyString.h"
 
 #include <functional>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 namespace OctaneGUI
 {
 
 std::unordered_map<size_t, std::string> g_Table {};
+// Windows may be painted on worker threads, which intern strings through profiler samples.
+std::shared_mutex g_TableMutex {};
 
 std::string_view Get(const char* Value)
 {
     size_t Hash = std::hash<std::string_view> {}(Value);
-    if (g_Table.find(Hash) == g_Table.end())
+
     {
-        g_Table[Hash] = Value;
+        std::shared_lock<std::shared_mutex> Lock(g_TableMutex);
+        const std::unordered_map<size_t, std::string>::const_iterator It = g_Table.find(Hash);
+        if (It != g_Table.end())
+        {
+            return It->second;
+        }
     }
-    return g_Table[Hash];
+
+    std::unique_lock<std::shared_mutex> Lock(g_TableMutex);
+    return g_Table.emplace(Hash, Value).first->second;
 }
 
 FlyString::FlyString()
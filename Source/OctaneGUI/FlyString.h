@@ -26,6 +26,7 @@ SOFTWARE.
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 namespace OctaneGUI
@@ -51,3 +52,18 @@ private:
 };
 
 }
+
+namespace std
+{
+
+// Strings are interned so hashing the address of the shared data is enough to identify a FlyString.
+template <>
+struct hash<OctaneGUI::FlyString>
+{
+    size_t operator()(const OctaneGUI::FlyString& Value) const
+    {
+        return std::hash<const void*> {}(Value.Data());
+    }
+};
+
+}
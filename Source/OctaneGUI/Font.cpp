@@ -25,6 +25,7 @@ SOFTWARE.
 */
 
 #include "Font.h"
+#include "AssetCache.h"
 #include "Rect.h"
 #define STB_RECT_PACK_IMPLEMENTATION
 #include "External/stb/stb_rect_pack.h"
@@ -33,6 +34,7 @@ SOFTWARE.
 #include "Texture.h"
 
 #include <cmath>
+#include <cstring>
 #include <fstream>
 
 namespace OctaneGUI
@@ -108,12 +110,26 @@ bool Font::Load(const char* Path, float Size, const std::vector<Range>& Ranges)
     Stream.read(&Buffer[0], Buffer.size());
     Stream.close();
 
-    float LineGap;
-    stbtt_GetScaledFontVMetrics((uint8_t*)Buffer.data(), 0, Size, &m_Ascent, &m_Descent, &LineGap);
-
     m_Size = Size;
     m_Path = Path;
 
+    // The atlas only depends on the font contents, the size and the requested ranges.
+    AssetCache::Key CacheKey { "Font" };
+    CacheKey.Add(Buffer.data(), Buffer.size()).Add(Size);
+    for (const Range& Range_ : Ranges)
+    {
+        CacheKey.Add(Range_.Min).Add(Range_.Max);
+    }
+
+    AssetCache::Entry Cached;
+    if (AssetCache::Load(CacheKey, Cached) && LoadCached(Cached.Metadata, Cached.Pixels, Cached.Width, Cached.Height))
+    {
+        return true;
+    }
+
+    float LineGap;
+    stbtt_GetScaledFontVMetrics((uint8_t*)Buffer.data(), 0, Size, &m_Ascent, &m_Descent, &LineGap);
+
     // 1. Initialize the font data from the input stream.
     Vector2 TextureSize { 128.0f, 128.0f };
     const uint8_t* Data = (uint8_t*)Buffer.data();
@@ -226,6 +242,82 @@ bool Font::Load(const char* Path, float Size, const std::vector<Range>& Ranges)
 
     m_SpaceSize = Measure(U" ");
 
+    if (AssetCache::Enabled())
+    {
+        Cached.Width = (uint32_t)TextureSize.X;
+        Cached.Height = (uint32_t)TextureSize.Y;
+        Cached.Metadata = CacheMetadata();
+        Cached.Pixels = std::move(RGBA32);
+        AssetCache::Store(CacheKey, Cached);
+    }
+
+    return true;
+}
+
+template <typename T>
+static void Write(std::vector<uint8_t>& Stream, const T& Value)
+{
+    const uint8_t* Bytes = (const uint8_t*)&Value;
+    Stream.insert(Stream.end(), Bytes, Bytes + sizeof(T));
+}
+
+template <typename T>
+static bool Read(const std::vector<uint8_t>& Stream, size_t& Offset, T& Value)
+{
+    if (Offset + sizeof(T) > Stream.size())
+    {
+        return false;
+    }
+
+    memcpy(&Value, &Stream[Offset], sizeof(T));
+    Offset += sizeof(T);
+    return true;
+}
+
+std::vector<uint8_t> Font::CacheMetadata() const
+{
+    std::vector<uint8_t> Result;
+    Write(Result, m_Ascent);
+    Write(Result, m_Descent);
+    Write(Result, (uint32_t)m_Glyphs.size());
+    for (const std::pair<const unsigned int, Glyph>& Item : m_Glyphs)
+    {
+        Write(Result, (uint32_t)Item.first);
+        Write(Result, Item.second);
+    }
+    return Result;
+}
+
+bool Font::LoadCached(const std::vector<uint8_t>& Metadata, const std::vector<uint8_t>& Pixels, uint32_t Width, uint32_t Height)
+{
+    size_t Offset = 0;
+    uint32_t Count = 0;
+    if (!Read(Metadata, Offset, m_Ascent) || !Read(Metadata, Offset, m_Descent) || !Read(Metadata, Offset, Count))
+    {
+        return false;
+    }
+
+    GlyphMap Glyphs;
+    for (uint32_t I = 0; I < Count; I++)
+    {
+        uint32_t Codepoint = 0;
+        Glyph Item;
+        if (!Read(Metadata, Offset, Codepoint) || !Read(Metadata, Offset, Item))
+        {
+            return false;
+        }
+
+        Glyphs[Codepoint] = Item;
+    }
+
+    m_Texture = Texture::Load(Pixels, Width, Height);
+    if (!m_Texture)
+    {
+        return false;
+    }
+
+    m_Glyphs = std::move(Glyphs);
+    m_SpaceSize = Measure(U" ");
     return true;
 }
 
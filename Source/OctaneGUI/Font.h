@@ -96,6 +96,8 @@ private:
     typedef std::unordered_map<unsigned int, Glyph> GlyphMap;
 
     const Glyph& GetGlyph(uint32_t CodePoint) const;
+    std::vector<uint8_t> CacheMetadata() const;
+    bool LoadCached(const std::vector<uint8_t>& Metadata, const std::vector<uint8_t>& Pixels, uint32_t Width, uint32_t Height);
 
     static int s_TabSize;
 
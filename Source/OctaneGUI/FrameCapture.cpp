@@ -0,0 +1,328 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "FrameCapture.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace OctaneGUI
+{
+
+// Bump whenever the layout of a capture changes.
+static constexpr uint32_t Version = 1;
+static constexpr char Magic[4] = { 'O', 'G', 'F', 'C' };
+
+struct Header
+{
+    char Magic[4];
+    uint32_t Version;
+    uint64_t Number;
+    float Width;
+    float Height;
+    float ScaleX;
+    float ScaleY;
+    uint32_t Compact;
+    uint32_t VertexSize;
+    uint32_t IDLength;
+    uint32_t VertexCount;
+    uint32_t IndexCount;
+    uint32_t CommandCount;
+    uint32_t TextureCount;
+};
+
+struct CommandData
+{
+    uint32_t VertexOffset;
+    uint32_t IndexOffset;
+    uint32_t IndexCount;
+    uint32_t TextureID;
+    float Clip[4];
+};
+
+struct TextureHeader
+{
+    uint32_t ID;
+    uint32_t Width;
+    uint32_t Height;
+};
+
+static std::atomic<bool> s_Track { false };
+static std::mutex s_TexturesMutex {};
+static std::unordered_map<uint32_t, FrameCapture::TextureData> s_Textures {};
+
+// Live textures whose pixels are not known because they were uploaded while tracking was disabled.
+static std::unordered_set<uint32_t> s_Untracked {};
+
+// Copies Count items of T from the file, advancing Offset. Returns false if the file is too short.
+template <typename T>
+static bool Read(const MappedFile& File, size_t& Offset, std::vector<T>& Result, size_t Count)
+{
+    if (Offset + Count * sizeof(T) > File.Size())
+    {
+        return false;
+    }
+
+    Result.resize(Count);
+    std::memcpy((void*)Result.data(), File.Data() + Offset, Count * sizeof(T));
+    Offset += Count * sizeof(T);
+    return true;
+}
+
+// Every command must only reference indices and vertices that exist in the buffer, since
+// replaying a capture indexes into them without any checks.
+template <typename I>
+static bool Validate(const std::vector<CommandData>& Commands, const std::vector<I>& Indices, size_t VertexCount)
+{
+    for (const CommandData& Command : Commands)
+    {
+        if ((uint64_t)Command.IndexOffset + Command.IndexCount > Indices.size() || Command.VertexOffset > VertexCount)
+        {
+            return false;
+        }
+
+        for (uint32_t Index = 0; Index < Command.IndexCount; Index++)
+        {
+            if ((uint64_t)Command.VertexOffset + Indices[Command.IndexOffset + Index] >= VertexCount)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+static void Write(std::ofstream& Stream, const std::vector<T>& Items)
+{
+    Stream.write((const char*)Items.data(), Items.size() * sizeof(T));
+}
+
+void FrameCapture::SetTrackTextures(bool Track)
+{
+    std::lock_guard<std::mutex> Lock { s_TexturesMutex };
+    s_Track = Track;
+
+    if (!Track)
+    {
+        for (const std::pair<const uint32_t, TextureData>& Item : s_Textures)
+        {
+            s_Untracked.insert(Item.first);
+        }
+        s_Textures.clear();
+    }
+}
+
+bool FrameCapture::TrackTextures()
+{
+    return s_Track;
+}
+
+bool FrameCapture::HasUntrackedTextures()
+{
+    std::lock_guard<std::mutex> Lock { s_TexturesMutex };
+    return !s_Untracked.empty();
+}
+
+bool FrameCapture::Save(const char* Path, const char* WindowID, uint64_t Number, const Vector2& Size, const Vector2& RenderScale, const VertexBuffer& Buffer)
+{
+    std::vector<CommandData> Commands;
+    std::vector<uint32_t> TextureIDs;
+    for (const DrawCommand& Command : Buffer.Commands())
+    {
+        const Rect Clip = Command.Clip();
+        Commands.push_back({ Command.VertexOffset(), Command.IndexOffset(), Command.IndexCount(), Command.TextureID(), { Clip.Min.X, Clip.Min.Y, Clip.Max.X, Clip.Max.Y } });
+
+        if (Command.TextureID() != 0 && std::find(TextureIDs.begin(), TextureIDs.end(), Command.TextureID()) == TextureIDs.end())
+        {
+            TextureIDs.push_back(Command.TextureID());
+        }
+    }
+
+    std::ofstream Stream;
+    Stream.open(Path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!Stream.is_open())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> Lock { s_TexturesMutex };
+
+    // Textures that were uploaded before tracking was enabled are left out.
+    std::vector<const TextureData*> Textures;
+    for (uint32_t ID : TextureIDs)
+    {
+        const auto It = s_Textures.find(ID);
+        if (It != s_Textures.end())
+        {
+            Textures.push_back(&It->second);
+        }
+    }
+
+    Header Info {};
+    std::memcpy(Info.Magic, Magic, sizeof(Magic));
+    Info.Version = Version;
+    Info.Number = Number;
+    Info.Width = Size.X;
+    Info.Height = Size.Y;
+    Info.ScaleX = RenderScale.X;
+    Info.ScaleY = RenderScale.Y;
+    Info.Compact = Buffer.IsCompact() ? 1 : 0;
+    Info.VertexSize = Buffer.IsCompact() ? (uint32_t)sizeof(CompactVertex) : (uint32_t)sizeof(Vertex);
+    Info.IDLength = (uint32_t)std::strlen(WindowID);
+    Info.VertexCount = Buffer.GetVertexCount();
+    Info.IndexCount = Buffer.GetIndexCount();
+    Info.CommandCount = (uint32_t)Commands.size();
+    Info.TextureCount = (uint32_t)Textures.size();
+
+    Stream.write((const char*)&Info, sizeof(Info));
+    Stream.write(WindowID, Info.IDLength);
+    if (Buffer.IsCompact())
+    {
+        Write(Stream, Buffer.GetCompactVertices());
+        Write(Stream, Buffer.GetCompactIndices());
+    }
+    else
+    {
+        Write(Stream, Buffer.GetVertices());
+        Write(Stream, Buffer.GetIndices());
+    }
+    Write(Stream, Commands);
+
+    for (const TextureData* Item : Textures)
+    {
+        const TextureHeader Texture { Item->ID, Item->Width, Item->Height };
+        Stream.write((const char*)&Texture, sizeof(Texture));
+        Write(Stream, Item->Pixels);
+    }
+
+    return Stream.good();
+}
+
+bool FrameCapture::Load(const char* Path, Frame& Result)
+{
+    MappedFile File;
+    if (!File.Open(Path) || File.Size() < sizeof(Header))
+    {
+        return false;
+    }
+
+    Header Info {};
+    std::memcpy(&Info, File.Data(), sizeof(Info));
+    if (std::memcmp(Info.Magic, Magic, sizeof(Magic)) != 0
+        || Info.Version != Version
+        || Info.VertexSize != (Info.Compact != 0 ? sizeof(CompactVertex) : sizeof(Vertex)))
+    {
+        return false;
+    }
+
+    size_t Offset = sizeof(Header);
+    if (Offset + Info.IDLength > File.Size())
+    {
+        return false;
+    }
+
+    Result = Frame();
+    Result.WindowID.assign(File.Data() + Offset, Info.IDLength);
+    Result.Number = Info.Number;
+    Result.Size = { Info.Width, Info.Height };
+    Result.RenderScale = { Info.ScaleX, Info.ScaleY };
+    Offset += Info.IDLength;
+
+    VertexBuffer& Buffer = Result.Buffer;
+    Buffer.SetCompact(Info.Compact != 0);
+    const bool Valid = Info.Compact != 0
+        ? Read(File, Offset, Buffer.m_CompactVertices, Info.VertexCount) && Read(File, Offset, Buffer.m_CompactIndices, Info.IndexCount)
+        : Read(File, Offset, Buffer.m_Vertices, Info.VertexCount) && Read(File, Offset, Buffer.m_Indices, Info.IndexCount);
+
+    std::vector<CommandData> Commands;
+    if (!Valid || !Read(File, Offset, Commands, Info.CommandCount))
+    {
+        return false;
+    }
+
+    const bool InRange = Info.Compact != 0
+        ? Validate(Commands, Buffer.m_CompactIndices, Buffer.m_CompactVertices.size())
+        : Validate(Commands, Buffer.m_Indices, Buffer.m_Vertices.size());
+    if (!InRange)
+    {
+        return false;
+    }
+
+    for (const CommandData& Command : Commands)
+    {
+        Buffer.m_Commands.emplace_back(Command.VertexOffset, Command.IndexOffset, Command.IndexCount, Command.TextureID, Rect(Command.Clip[0], Command.Clip[1], Command.Clip[2], Command.Clip[3]));
+    }
+
+    for (uint32_t I = 0; I < Info.TextureCount; I++)
+    {
+        std::vector<TextureHeader> Texture;
+        if (!Read(File, Offset, Texture, 1))
+        {
+            return false;
+        }
+
+        TextureData Item { Texture[0].ID, Texture[0].Width, Texture[0].Height, {} };
+        if (!Read(File, Offset, Item.Pixels, (size_t)Item.Width * Item.Height * 4))
+        {
+            return false;
+        }
+
+        Result.Textures.push_back(std::move(Item));
+    }
+
+    return Offset == File.Size();
+}
+
+void FrameCapture::OnUploaded(uint32_t ID, const std::vector<uint8_t>& Pixels, uint32_t Width, uint32_t Height)
+{
+    std::lock_guard<std::mutex> Lock { s_TexturesMutex };
+    if (!s_Track || Pixels.size() != (size_t)Width * Height * 4)
+    {
+        s_Textures.erase(ID);
+        s_Untracked.insert(ID);
+        return;
+    }
+
+    s_Textures[ID] = { ID, Width, Height, Pixels };
+    s_Untracked.erase(ID);
+}
+
+void FrameCapture::OnReleased(uint32_t ID)
+{
+    std::lock_guard<std::mutex> Lock { s_TexturesMutex };
+    s_Textures.erase(ID);
+    s_Untracked.erase(ID);
+}
+
+}
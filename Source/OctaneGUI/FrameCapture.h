@@ -0,0 +1,91 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "Vector2.h"
+#include "VertexBuffer.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Saves the geometry submitted by a window to a file so that it can be rendered
+/// again outside of the application.
+///
+/// A capture holds the window's vertices, indices and draw commands along with the pixels
+/// of every texture the commands reference. Texture pixels are only known for textures
+/// uploaded while texture tracking is enabled, so tracking must be enabled before the
+/// application loads its theme and icons. Pixels can not be read back from the renderer,
+/// so textures uploaded before that can never be saved.
+class FrameCapture
+{
+public:
+    struct TextureData
+    {
+        uint32_t ID { 0 };
+        uint32_t Width { 0 };
+        uint32_t Height { 0 };
+        std::vector<uint8_t> Pixels {};
+    };
+
+    struct Frame
+    {
+        std::string WindowID {};
+        uint64_t Number { 0 };
+        Vector2 Size {};
+        Vector2 RenderScale { 1.0f, 1.0f };
+        VertexBuffer Buffer {};
+        std::vector<TextureData> Textures {};
+    };
+
+    static constexpr const char* Extension = ".ogfc";
+
+    /// @brief Keeps a copy of the pixels of every texture uploaded from now on. Disabling
+    /// tracking releases the copies.
+    static void SetTrackTextures(bool Track);
+    static bool TrackTextures();
+
+    /// @brief True if any live texture was uploaded while tracking was disabled, in which
+    /// case captures will be missing its pixels.
+    static bool HasUntrackedTextures();
+
+    static bool Save(const char* Path, const char* WindowID, uint64_t Number, const Vector2& Size, const Vector2& RenderScale, const VertexBuffer& Buffer);
+    /// @brief Reads a capture. Files whose draw commands reference indices or vertices
+    /// outside of the saved buffers are rejected.
+    static bool Load(const char* Path, Frame& Result);
+
+private:
+    friend class Texture;
+
+    static void OnUploaded(uint32_t ID, const std::vector<uint8_t>& Pixels, uint32_t Width, uint32_t Height);
+    static void OnReleased(uint32_t ID);
+};
+
+}
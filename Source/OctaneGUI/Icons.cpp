@@ -25,9 +25,13 @@ SOFTWARE.
 */
 
 #include "Icons.h"
+#include "AssetCache.h"
+#include "AssetLoader.h"
 #include "Color.h"
 #include "Texture.h"
+#include "ThreadPool.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace OctaneGUI
@@ -166,28 +170,99 @@ void Icons::Initialize()
 }
 
 void Icons::Initialize(const std::vector<Definition>& Definitions, const Vector2& IconSize)
+{
+    ThreadPool Pool;
+    Pool.SetThreads(0);
+    AssetLoader Loader { Pool };
+    Initialize(Definitions, IconSize, Loader);
+    Loader.Wait();
+}
+
+void Icons::Initialize(const std::vector<Definition>& Definitions, const Vector2& IconSize, AssetLoader& Loader)
 {
     const uint32_t IconW = (uint32_t)IconSize.X;
     const uint32_t IconH = (uint32_t)IconSize.Y;
     const uint32_t Width = IconW;
     const uint32_t Height = IconH * (uint32_t)Type::Max;
-    std::vector<uint8_t> Data;
-    Data.resize(Width * Height * 4);
 
-    size_t DataOffset = 0;
+    // The icon size already has the render scale applied, so a change in scale will
+    // result in a different entry. Hashing every icon file is skipped without a cache.
+    const bool UseCache = AssetCache::Enabled();
+    AssetCache::Key CacheKey { "Icons" };
+    CacheKey.Add(IconW).Add(IconH);
+
     Vector2 Offset;
     for (const Definition& Item : Definitions)
     {
-        const std::vector<uint8_t> IconData = Texture::LoadSVGData(Item.FileName.c_str(), IconW, IconH);
-        memcpy(&Data[DataOffset], IconData.data(), IconData.size());
-        DataOffset += IconData.size();
+        if (UseCache)
+        {
+            CacheKey.Add(Item.Name);
+            CacheKey.AddFile(Item.FileName.c_str());
+        }
 
         Type IconType = ToType(Item.Name);
         m_UVs[(int)IconType] = { Offset.X, Offset.Y, Offset.X + IconSize.X, Offset.Y + IconSize.Y };
         Offset.Y += IconSize.Y;
     }
 
-    m_Texture = Texture::Load(Data, Width, Height);
+    // The size is known up front so that normalized UVs can be computed while loading.
+    m_Texture = std::make_shared<Texture>();
+    m_Texture->m_Size = { (float)Width, (float)Height };
+
+    AssetCache::Entry Cached;
+    if (UseCache && AssetCache::Load(CacheKey, Cached) && Cached.Width == Width && Cached.Height == Height)
+    {
+        m_Texture->Upload(Cached.Pixels, Width, Height);
+        return;
+    }
+
+    // Each icon is rasterized into its own slice of the strip. The last job to finish
+    // uploads the strip and stores it in the cache.
+    struct Strip
+    {
+        std::vector<uint8_t> Data {};
+        size_t Remaining { 0 };
+    };
+
+    std::shared_ptr<Strip> Result = std::make_shared<Strip>();
+    Result->Data.resize(Width * Height * 4);
+    const size_t Count = std::min<size_t>(Definitions.size(), (size_t)Type::Max);
+    Result->Remaining = Count;
+    if (Count == 0)
+    {
+        m_Texture->Upload(Result->Data, Width, Height);
+        return;
+    }
+
+    const std::shared_ptr<Texture> Target = m_Texture;
+    const size_t SliceSize = (size_t)IconW * IconH * 4;
+    for (size_t I = 0; I < Count; I++)
+    {
+        const std::string FileName = Definitions[I].FileName;
+        Loader.Run([Result, FileName, IconW, IconH, SliceSize, I]() -> void
+            {
+                const std::vector<uint8_t> IconData = Texture::LoadSVGData(FileName.c_str(), IconW, IconH);
+                memcpy(&Result->Data[SliceSize * I], IconData.data(), std::min<size_t>(IconData.size(), SliceSize));
+            },
+            [Result, Target, CacheKey, UseCache, Width, Height]() -> void
+            {
+                if (--Result->Remaining > 0)
+                {
+                    return;
+                }
+
+                Target->Upload(Result->Data, Width, Height);
+
+                if (UseCache)
+                {
+                    AssetCache::Entry Entry;
+                    Entry.Width = Width;
+                    Entry.Height = Height;
+                    Entry.Pixels = std::move(Result->Data);
+                    AssetCache::Store(CacheKey, Entry);
+                }
+            });
+    }
 }
 
 std::shared_ptr<Texture> Icons::GetTexture() const
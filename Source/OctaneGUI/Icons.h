@@ -36,6 +36,7 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+class AssetLoader;
 class Texture;
 
 class Icons
@@ -74,6 +75,10 @@ public:
 
     void Initialize();
     void Initialize(const std::vector<Definition>& Definitions, const Vector2& IconSize);
+
+    /// @brief Rasterizes the icons on the loader's workers. The texture is a placeholder
+    /// with the final size until the loader uploads the pixels.
+    void Initialize(const std::vector<Definition>& Definitions, const Vector2& IconSize, AssetLoader& Loader);
     std::shared_ptr<Texture> GetTexture() const;
     Rect GetUVs(Type InType) const;
     Rect GetUVsNormalized(Type InType) const;
@@ -0,0 +1,189 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "IdleScheduler.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace OctaneGUI
+{
+
+IdleScheduler::IdleScheduler()
+{
+}
+
+IdleScheduler::~IdleScheduler()
+{
+}
+
+IdleScheduler::TaskID IdleScheduler::Add(OnStepSignature&& Fn, Priority Priority_, const void* Owner)
+{
+    assert(Priority_ < Priority::Count);
+
+    m_NextID++;
+    if (m_NextID == InvalidID)
+    {
+        m_NextID++;
+    }
+
+    m_Queues[(size_t)Priority_].push_back({ m_NextID, std::move(Fn), Owner });
+    return m_NextID;
+}
+
+bool IdleScheduler::Cancel(TaskID ID)
+{
+    if (ID == InvalidID)
+    {
+        return false;
+    }
+
+    if (ID == m_Running)
+    {
+        const bool Result = !m_RunningCancelled;
+        m_RunningCancelled = true;
+        return Result;
+    }
+
+    for (std::deque<Item>& Queue : m_Queues)
+    {
+        const std::deque<Item>::iterator It = std::find_if(Queue.begin(), Queue.end(), [ID](const Item& Task) -> bool
+            {
+                return Task.ID == ID;
+            });
+
+        if (It != Queue.end())
+        {
+            Queue.erase(It);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void IdleScheduler::CancelOwner(const void* Owner)
+{
+    if (Owner == nullptr)
+    {
+        return;
+    }
+
+    if (m_Running != InvalidID && m_RunningOwner == Owner)
+    {
+        m_RunningCancelled = true;
+    }
+
+    for (std::deque<Item>& Queue : m_Queues)
+    {
+        Queue.erase(std::remove_if(Queue.begin(), Queue.end(), [Owner](const Item& Task) -> bool
+            {
+                return Task.Owner == Owner;
+            }),
+            Queue.end());
+    }
+}
+
+size_t IdleScheduler::Run(std::chrono::microseconds Budget)
+{
+    const std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+    size_t Result = 0;
+
+    while (true)
+    {
+        std::deque<Item>* Queue = nullptr;
+        for (std::deque<Item>& Candidate : m_Queues)
+        {
+            if (!Candidate.empty())
+            {
+                Queue = &Candidate;
+                break;
+            }
+        }
+
+        if (Queue == nullptr)
+        {
+            break;
+        }
+
+        // The task is taken out of its queue while it runs so that steps may add or cancel tasks.
+        Item Task = std::move(Queue->front());
+        Queue->pop_front();
+
+        m_Running = Task.ID;
+        m_RunningOwner = Task.Owner;
+        m_RunningCancelled = false;
+        const bool Finished = Task.Fn();
+        m_Running = InvalidID;
+        m_RunningOwner = nullptr;
+        Result++;
+
+        if (!Finished && !m_RunningCancelled)
+        {
+            Queue->push_back(std::move(Task));
+        }
+
+        if (std::chrono::steady_clock::now() - Start >= Budget)
+        {
+            break;
+        }
+    }
+
+    return Result;
+}
+
+size_t IdleScheduler::Pending() const
+{
+    size_t Result = 0;
+    for (const std::deque<Item>& Queue : m_Queues)
+    {
+        Result += Queue.size();
+    }
+    return Result;
+}
+
+bool IdleScheduler::IsPending(TaskID ID) const
+{
+    if (ID != InvalidID && ID == m_Running)
+    {
+        return !m_RunningCancelled;
+    }
+
+    for (const std::deque<Item>& Queue : m_Queues)
+    {
+        for (const Item& Task : Queue)
+        {
+            if (Task.ID == ID)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+}
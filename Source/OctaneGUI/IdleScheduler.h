@@ -0,0 +1,96 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+namespace OctaneGUI
+{
+
+/// @brief Spreads expensive work across frames.
+///
+/// An idle task is a function that performs one small step of its work each time it is
+/// invoked and returns true once everything is done. Each call to Run invokes steps until
+/// the budget is spent, always starting with the highest priority. Tasks with the same
+/// priority take turns so that one long task does not hold back the others.
+class IdleScheduler
+{
+public:
+    enum class Priority : uint8_t
+    {
+        High,
+        Normal,
+        Low,
+        Count
+    };
+
+    typedef uint32_t TaskID;
+    static constexpr TaskID InvalidID = 0;
+
+    /// @brief Performs a step of work. Returns true when the task is finished.
+    typedef std::function<bool()> OnStepSignature;
+
+    IdleScheduler();
+    ~IdleScheduler();
+
+    /// @param Owner Optional object the task belongs to, see CancelOwner.
+    TaskID Add(OnStepSignature&& Fn, Priority Priority_ = Priority::Normal, const void* Owner = nullptr);
+
+    /// @brief Removes a task. This may be called from within a step, including the
+    /// task's own step.
+    /// @return True if the task was still pending.
+    bool Cancel(TaskID ID);
+    void CancelOwner(const void* Owner);
+
+    /// @brief Invokes steps until no tasks remain or the budget is spent. At least one
+    /// step is always invoked.
+    /// @return The number of steps invoked.
+    size_t Run(std::chrono::microseconds Budget);
+
+    size_t Pending() const;
+    bool IsPending(TaskID ID) const;
+
+private:
+    struct Item
+    {
+    public:
+        TaskID ID { InvalidID };
+        OnStepSignature Fn { nullptr };
+        const void* Owner { nullptr };
+    };
+
+    std::deque<Item> m_Queues[(size_t)Priority::Count] {};
+    TaskID m_NextID { InvalidID };
+    TaskID m_Running { InvalidID };
+    const void* m_RunningOwner { nullptr };
+    bool m_RunningCancelled { false };
+};
+
+}
@@ -26,81 +26,1035 @@ SOFTWARE.
 
 #include "Json.h"
 #include "Assert.h"
-#include "String.h"
 
 #include <cctype>
 #include <climits>
 #include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
-#include <iterator>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 
 namespace OctaneGUI
 {
 
-// TODO: Maybe move this into its own file to be used by other systems.
-class Lexer
+class Json::Members
 {
 public:
-    Lexer(const char* Stream)
-        : m_Stream(Stream)
+    typedef std::pair<std::string, Json> Member;
+
+    const std::vector<Member>& Items() const
+    {
+        return m_Items;
+    }
+
+    void Reserve(size_t Count)
+    {
+        m_Items.reserve(Count);
+    }
+
+    const Json* Find(std::string_view Key) const
+    {
+        const size_t Index = IndexOf(Key);
+        return Index < m_Items.size() ? &m_Items[Index].second : nullptr;
+    }
+
+    Json* Find(std::string_view Key)
+    {
+        const size_t Index = IndexOf(Key);
+        return Index < m_Items.size() ? &m_Items[Index].second : nullptr;
+    }
+
+    Json& Insert(std::string_view Key)
+    {
+        Json* Result = Find(Key);
+        if (Result != nullptr)
+        {
+            return *Result;
+        }
+
+        return Append(std::string(Key), Json());
+    }
+
+    // The caller is responsible for making sure the key does not already exist.
+    Json& Append(std::string&& Key, Json&& Value)
+    {
+        m_Items.emplace_back(std::move(Key), std::move(Value));
+
+        if (m_Items.size() > HashThreshold)
+        {
+            if (m_Index.size() < m_Items.size() * 2)
+            {
+                Rebuild();
+            }
+            else
+            {
+                AddToIndex(m_Items.size() - 1);
+            }
+        }
+
+        return m_Items.back().second;
+    }
+
+    bool Erase(std::string_view Key)
+    {
+        const size_t Index = IndexOf(Key);
+        if (Index >= m_Items.size())
+        {
+            return false;
+        }
+
+        m_Items.erase(m_Items.begin() + Index);
+        Rebuild();
+        return true;
+    }
+
+private:
+    // Objects with this many members or less are searched linearly.
+    static constexpr size_t HashThreshold { 16 };
+
+    size_t IndexOf(std::string_view Key) const
+    {
+        if (m_Index.empty())
+        {
+            for (size_t I = 0; I < m_Items.size(); I++)
+            {
+                if (m_Items[I].first == Key)
+                {
+                    return I;
+                }
+            }
+
+            return m_Items.size();
+        }
+
+        const size_t Mask = m_Index.size() - 1;
+        for (size_t Slot = std::hash<std::string_view>()(Key) & Mask; m_Index[Slot] != 0; Slot = (Slot + 1) & Mask)
+        {
+            const size_t Index = m_Index[Slot] - 1;
+            if (m_Items[Index].first == Key)
+            {
+                return Index;
+            }
+        }
+
+        return m_Items.size();
+    }
+
+    void Rebuild()
+    {
+        m_Index.clear();
+
+        if (m_Items.size() <= HashThreshold)
+        {
+            return;
+        }
+
+        size_t Size = 64;
+        while (Size < m_Items.size() * 4)
+        {
+            Size *= 2;
+        }
+
+        m_Index.assign(Size, 0);
+        for (size_t I = 0; I < m_Items.size(); I++)
+        {
+            AddToIndex(I);
+        }
+    }
+
+    void AddToIndex(size_t Index)
+    {
+        const size_t Mask = m_Index.size() - 1;
+        size_t Slot = std::hash<std::string_view>()(m_Items[Index].first) & Mask;
+        while (m_Index[Slot] != 0)
+        {
+            Slot = (Slot + 1) & Mask;
+        }
+
+        m_Index[Slot] = (uint32_t)(Index + 1);
+    }
+
+    std::vector<Member> m_Items {};
+
+    // Open addressed table of item indices offset by one. Empty for small objects.
+    std::vector<uint32_t> m_Index {};
+};
+
+static void AppendUTF8(std::string& Result, uint32_t Code)
+{
+    if (Code < 0x80)
+    {
+        Result += (char)Code;
+    }
+    else if (Code < 0x800)
+    {
+        Result += (char)(0xC0 | (Code >> 6));
+        Result += (char)(0x80 | (Code & 0x3F));
+    }
+    else if (Code < 0x10000)
+    {
+        Result += (char)(0xE0 | (Code >> 12));
+        Result += (char)(0x80 | ((Code >> 6) & 0x3F));
+        Result += (char)(0x80 | (Code & 0x3F));
+    }
+    else
+    {
+        Result += (char)(0xF0 | (Code >> 18));
+        Result += (char)(0x80 | ((Code >> 12) & 0x3F));
+        Result += (char)(0x80 | ((Code >> 6) & 0x3F));
+        Result += (char)(0x80 | (Code & 0x3F));
+    }
+}
+
+static void AppendEscaped(std::string& Result, std::string_view Value)
+{
+    Result += '"';
+    for (const char Ch : Value)
+    {
+        switch (Ch)
+        {
+        case '"': Result += "\\\""; break;
+        case '\\': Result += "\\\\"; break;
+        case '\b': Result += "\\b"; break;
+        case '\f': Result += "\\f"; break;
+        case '\n': Result += "\\n"; break;
+        case '\r': Result += "\\r"; break;
+        case '\t': Result += "\\t"; break;
+        default:
+        {
+            if ((unsigned char)Ch < 0x20)
+            {
+                char Buffer[8] {};
+                std::snprintf(Buffer, sizeof(Buffer), "\\u%04x", (unsigned int)Ch);
+                Result += Buffer;
+            }
+            else
+            {
+                Result += Ch;
+            }
+        }
+        }
+    }
+    Result += '"';
+}
+
+// Arrays and objects are parsed recursively. Deeper streams are rejected instead of
+// exhausting the stack.
+static constexpr unsigned int MaxDepth { 256 };
+
+// Single pass parser that reads directly from the stream. Values for arrays and objects
+// are collected on shared scratch stacks and moved into exactly sized containers once
+// the closing character is found.
+class JsonReader
+{
+public:
+    JsonReader(const char* Stream)
+        : m_Begin(Stream)
+        , m_Stream(Stream)
+    {
+    }
+
+    Json Parse(bool& IsError)
+    {
+        Json Result;
+        IsError = !ParseValue(Result);
+        return IsError ? std::move(m_Error) : std::move(Result);
+    }
+
+private:
+    bool IsEnd() const
+    {
+        return *m_Stream == '\0';
+    }
+
+    void ConsumeSpaces()
+    {
+        while (std::isspace((unsigned char)*m_Stream))
+        {
+            m_Stream++;
+        }
+    }
+
+    bool ParseValue(Json& Value)
+    {
+        ConsumeSpaces();
+
+        // Characters that can not start a value are skipped. A separator or space
+        // results in a null value.
+        while (!IsEnd())
+        {
+            const unsigned char Ch = *m_Stream;
+            if (Ch == '{' || Ch == '[' || Ch == '"' || std::isalnum(Ch) || Ch == '.' || Ch == '-')
+            {
+                break;
+            }
+            else if (Ch == ',' || Ch == '}' || Ch == ']' || std::isspace(Ch))
+            {
+                return true;
+            }
+
+            m_Stream++;
+        }
+
+        switch (*m_Stream)
+        {
+        case '\0': return true;
+        case '{':
+        case '[':
+        {
+            if (m_Depth >= MaxDepth)
+            {
+                return Error("Exceeded the maximum nesting depth of %u.", MaxDepth);
+            }
+
+            const bool IsObject = *m_Stream++ == '{';
+            m_Depth++;
+            const bool Result = IsObject ? ParseObject(Value) : ParseArray(Value);
+            m_Depth--;
+            return Result;
+        }
+        case '"':
+        {
+            m_Stream++;
+            if (!ParseString(m_String))
+            {
+                return false;
+            }
+
+            Value = m_String;
+            return true;
+        }
+        default: break;
+        }
+
+        return ParseLiteral(Value);
+    }
+
+    bool ParseString(std::string& Result)
+    {
+        Result.clear();
+
+        while (true)
+        {
+            const size_t Length = std::strcspn(m_Stream, "\"\\");
+            Result.append(m_Stream, Length);
+            m_Stream += Length;
+
+            if (*m_Stream == '"')
+            {
+                m_Stream++;
+                return true;
+            }
+            else if (*m_Stream == '\\')
+            {
+                m_Stream++;
+                if (!ParseEscape(Result))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                return Error("Unterminated string.");
+            }
+        }
+    }
+
+    bool ParseEscape(std::string& Result)
+    {
+        const char Ch = *m_Stream;
+        switch (Ch)
+        {
+        case '"':
+        case '\\':
+        case '/': Result += Ch; break;
+        case 'b': Result += '\b'; break;
+        case 'f': Result += '\f'; break;
+        case 'n': Result += '\n'; break;
+        case 'r': Result += '\r'; break;
+        case 't': Result += '\t'; break;
+        case 'u':
+        {
+            m_Stream++;
+            uint32_t Code = 0;
+            if (!ParseHex(Code))
+            {
+                return false;
+            }
+
+            // Combine surrogate pairs. Unpaired surrogates are replaced.
+            if (Code >= 0xD800 && Code <= 0xDBFF && m_Stream[0] == '\\' && m_Stream[1] == 'u')
+            {
+                const char* Restore = m_Stream;
+                uint32_t Low = 0;
+                m_Stream += 2;
+                if (!ParseHex(Low))
+                {
+                    return false;
+                }
+
+                if (Low >= 0xDC00 && Low <= 0xDFFF)
+                {
+                    Code = 0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00);
+                }
+                else
+                {
+                    m_Stream = Restore;
+                }
+            }
+
+            if (Code >= 0xD800 && Code <= 0xDFFF)
+            {
+                Code = 0xFFFD;
+            }
+
+            AppendUTF8(Result, Code);
+            return true;
+        }
+        case '\0': return Error("Unterminated string.");
+        default:
+        {
+            Result += '\\';
+            Result += Ch;
+        }
+        }
+
+        m_Stream++;
+        return true;
+    }
+
+    bool ParseHex(uint32_t& Code)
+    {
+        for (int I = 0; I < 4; I++)
+        {
+            const char Ch = *m_Stream;
+            uint32_t Digit = 0;
+            if (Ch >= '0' && Ch <= '9')
+            {
+                Digit = Ch - '0';
+            }
+            else if (Ch >= 'a' && Ch <= 'f')
+            {
+                Digit = Ch - 'a' + 10;
+            }
+            else if (Ch >= 'A' && Ch <= 'F')
+            {
+                Digit = Ch - 'A' + 10;
+            }
+            else
+            {
+                return Error("Invalid unicode escape sequence.");
+            }
+
+            Code = (Code << 4) | Digit;
+            m_Stream++;
+        }
+
+        return true;
+    }
+
+    bool ParseLiteral(Json& Value)
     {
+        const char* Start = m_Stream;
+        while (std::isalnum((unsigned char)*m_Stream) || *m_Stream == '.' || *m_Stream == '-' || *m_Stream == '+')
+        {
+            m_Stream++;
+        }
+
+        const std::string_view Token { Start, (size_t)(m_Stream - Start) };
+        if (Matches(Token, "true"))
+        {
+            Value = true;
+        }
+        else if (Matches(Token, "false"))
+        {
+            Value = false;
+        }
+        else if (Matches(Token, "null"))
+        {
+            // Do nothing.
+        }
+        else
+        {
+            char* End = nullptr;
+            const double Number = Token.find_first_not_of("-+.0123456789eE") == std::string_view::npos
+                ? std::strtod(Start, &End)
+                : 0.0;
+
+            if (End != m_Stream)
+            {
+                return Error("Invalid Json value '%s'.", std::string(Token).c_str());
+            }
+
+            Value = Number;
+        }
+
+        return true;
+    }
+
+    bool ParseArray(Json& Value)
+    {
+        const size_t Base = m_Values.size();
+
+        while (true)
+        {
+            ConsumeSpaces();
+
+            if (*m_Stream == ']')
+            {
+                m_Stream++;
+                break;
+            }
+
+            Json Item;
+            if (!ParseValue(Item))
+            {
+                return false;
+            }
+
+            if (!Item.IsNull())
+            {
+                m_Values.push_back(std::move(Item));
+            }
+
+            ConsumeSpaces();
+
+            if (*m_Stream == ']')
+            {
+                m_Stream++;
+                break;
+            }
+            else if (*m_Stream == ',')
+            {
+                m_Stream++;
+            }
+            else if (IsEnd())
+            {
+                return Error("Unexpected end of stream. Expected ']'.");
+            }
+            else
+            {
+                return Error("Invalid array separator '%c'. Expected ',' or ']'.", *m_Stream);
+            }
+        }
+
+        Value = Json(Json::Type::Array);
+        std::vector<Json>& Array = *Value.m_Data.Array;
+        Array.reserve(m_Values.size() - Base);
+        for (size_t I = Base; I < m_Values.size(); I++)
+        {
+            Array.push_back(std::move(m_Values[I]));
+        }
+        m_Values.resize(Base);
+
+        return true;
     }
 
-    unsigned char Current() const
-    {
-        return *m_Stream;
+    bool ParseObject(Json& Value)
+    {
+        const size_t Base = m_Members.size();
+
+        while (true)
+        {
+            ConsumeSpaces();
+
+            // Empty object.
+            if (*m_Stream == '}')
+            {
+                m_Stream++;
+                break;
+            }
+
+            if (*m_Stream != '"')
+            {
+                return Error("Key does not start with '\"' character.");
+            }
+
+            m_Stream++;
+            std::string Key;
+            if (!ParseString(Key))
+            {
+                return false;
+            }
+
+            ConsumeSpaces();
+            if (*m_Stream != ':')
+            {
+                return Error("Expected ':' character. Found '%c' instead.", *m_Stream);
+            }
+
+            m_Stream++;
+            Json Item;
+            if (!ParseValue(Item))
+            {
+                return false;
+            }
+
+            m_Members.emplace_back(std::move(Key), std::move(Item));
+
+            ConsumeSpaces();
+
+            if (*m_Stream == '}')
+            {
+                // Object is complete.
+                m_Stream++;
+                break;
+            }
+            else if (*m_Stream == ',')
+            {
+                m_Stream++;
+            }
+            else if (IsEnd())
+            {
+                return Error("Unexpected end of stream. Expected '}'.");
+            }
+            else
+            {
+                return Error("Invalid object separator '%c'. Expected ',' or '}'.", *m_Stream);
+            }
+        }
+
+        Value = Json(Json::Type::Object);
+        Json::Members& Object = *Value.m_Data.Object;
+        Object.Reserve(m_Members.size() - Base);
+        for (size_t I = Base; I < m_Members.size(); I++)
+        {
+            // Later keys replace earlier duplicates.
+            Json::Members::Member& Member = m_Members[I];
+            if (Json* Existing = Object.Find(Member.first))
+            {
+                *Existing = std::move(Member.second);
+            }
+            else
+            {
+                Object.Append(std::move(Member.first), std::move(Member.second));
+            }
+        }
+        m_Members.resize(Base);
+
+        return true;
+    }
+
+    static bool Matches(std::string_view Token, const char* Value)
+    {
+        if (Token.size() != std::strlen(Value))
+        {
+            return false;
+        }
+
+        for (size_t I = 0; I < Token.size(); I++)
+        {
+            if (std::tolower((unsigned char)Token[I]) != Value[I])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool Error(const char* Message, ...)
+    {
+        va_list List;
+        va_start(List, Message);
+
+        std::string Buffer;
+        Buffer.resize(SHRT_MAX);
+        vsnprintf(Buffer.data(), Buffer.size(), Message, List);
+        Buffer.resize(std::strlen(Buffer.c_str()));
+
+        va_end(List);
+
+        // Line and column are only needed when reporting errors so they are computed here
+        // instead of being tracked while parsing.
+        int Line = 1;
+        int Column = 1;
+        for (const char* Ch = m_Begin + 1; Ch <= m_Stream && m_Begin < m_Stream; Ch++)
+        {
+            Column++;
+            if (*Ch == '\n')
+            {
+                Line++;
+                Column = 1;
+            }
+        }
+
+        const std::string Position = std::to_string(Line) + ":" + std::to_string(Column);
+        m_Error = Json(Json::Type::Object);
+        m_Error["Error"] = Position + " " + Buffer;
+        m_Error["Line"] = (float)Line;
+        m_Error["Column"] = (float)Column;
+
+        return false;
+    }
+
+    const char* m_Begin { nullptr };
+    const char* m_Stream { nullptr };
+    unsigned int m_Depth { 0 };
+    std::string m_String {};
+    std::vector<Json> m_Values {};
+    std::vector<Json::Members::Member> m_Members {};
+    Json m_Error {};
+};
+
+// Binary layout: a header with a magic tag, version and string count, followed by the
+// string table where each entry is a 32-bit length and its bytes. The root value comes
+// last. Each value is a type byte followed by its payload: one byte for booleans, a
+// 64-bit double for numbers, a string table index for strings and a count followed by
+// the items for arrays. Object members are a key index followed by the value. All
+// integers are little endian.
+static constexpr char BinaryMagic[4] { 'O', 'G', 'J', 'B' };
+static constexpr uint32_t BinaryVersion { 2 };
+static constexpr size_t BinaryHeaderSize { sizeof(BinaryMagic) + sizeof(uint32_t) * 2 };
+
+class JsonBinaryWriter
+{
+public:
+    std::string Write(const Json& Root)
+    {
+        WriteValue(Root);
+
+        std::string Result;
+        Result.append(BinaryMagic, sizeof(BinaryMagic));
+        WriteU32(Result, BinaryVersion);
+        WriteU32(Result, (uint32_t)m_Strings.size());
+        for (const std::string_view& Item : m_Strings)
+        {
+            WriteU32(Result, (uint32_t)Item.size());
+            Result.append(Item.data(), Item.size());
+        }
+        Result.append(m_Values);
+
+        return Result;
+    }
+
+private:
+    static void WriteU32(std::string& Stream, uint32_t Value)
+    {
+        const char Bytes[4] { (char)(Value & 0xFF), (char)((Value >> 8) & 0xFF), (char)((Value >> 16) & 0xFF), (char)((Value >> 24) & 0xFF) };
+        Stream.append(Bytes, sizeof(Bytes));
+    }
+
+    // Strings are views into the value being written, which outlives the writer.
+    uint32_t Intern(std::string_view Value)
+    {
+        const auto Result = m_Lookup.emplace(Value, (uint32_t)m_Strings.size());
+        if (Result.second)
+        {
+            m_Strings.push_back(Value);
+        }
+
+        return Result.first->second;
+    }
+
+    void WriteValue(const Json& Value)
+    {
+        m_Values.push_back((char)Value.m_Type);
+
+        switch (Value.m_Type)
+        {
+        case Json::Type::Boolean: m_Values.push_back(Value.m_Data.Bool ? 1 : 0); break;
+        case Json::Type::Number:
+        {
+            uint64_t Bits = 0;
+            std::memcpy(&Bits, &Value.m_Data.Number, sizeof(Bits));
+            WriteU32(m_Values, (uint32_t)(Bits & 0xFFFFFFFF));
+            WriteU32(m_Values, (uint32_t)(Bits >> 32));
+        }
+        break;
+        case Json::Type::String: WriteU32(m_Values, Intern(*Value.m_Data.String)); break;
+        case Json::Type::Array:
+        {
+            WriteU32(m_Values, (uint32_t)Value.m_Data.Array->size());
+            for (const Json& Item : *Value.m_Data.Array)
+            {
+                WriteValue(Item);
+            }
+        }
+        break;
+        case Json::Type::Object:
+        {
+            WriteU32(m_Values, (uint32_t)Value.m_Data.Object->Items().size());
+            for (const Json::Members::Member& Item : Value.m_Data.Object->Items())
+            {
+                WriteU32(m_Values, Intern(Item.first));
+                WriteValue(Item.second);
+            }
+        }
+        break;
+        case Json::Type::Null:
+        default: break;
+        }
+    }
+
+    std::vector<std::string_view> m_Strings {};
+    std::unordered_map<std::string_view, uint32_t> m_Lookup {};
+    std::string m_Values {};
+};
+
+class JsonBinaryReader
+{
+public:
+    JsonBinaryReader(const char* Data, size_t Size)
+        : m_Begin(Data)
+        , m_Stream(Data)
+        , m_End(Data + Size)
+    {
+    }
+
+    Json Read(bool& IsError)
+    {
+        Json Result;
+        IsError = !ReadHeader() || !ReadValue(Result);
+        if (!IsError && m_Stream != m_End)
+        {
+            IsError = Error("Unexpected data after the root value.");
+        }
+
+        return IsError ? std::move(m_Error) : std::move(Result);
+    }
+
+private:
+    bool ReadU32(uint32_t& Value)
+    {
+        if (m_End - m_Stream < 4)
+        {
+            return Error("Unexpected end of stream.");
+        }
+
+        const unsigned char* Bytes = (const unsigned char*)m_Stream;
+        Value = (uint32_t)Bytes[0] | ((uint32_t)Bytes[1] << 8) | ((uint32_t)Bytes[2] << 16) | ((uint32_t)Bytes[3] << 24);
+        m_Stream += 4;
+        return true;
+    }
+
+    bool ReadString(std::string_view& Value)
+    {
+        uint32_t Index = 0;
+        if (!ReadU32(Index))
+        {
+            return false;
+        }
+
+        if (Index >= m_Strings.size())
+        {
+            return Error("Invalid string index %u.", Index);
+        }
+
+        Value = m_Strings[Index];
+        return true;
+    }
+
+    bool ReadHeader()
+    {
+        if (!Json::IsBinary(m_Stream, m_End - m_Stream))
+        {
+            return Error("Stream is not a binary Json stream.");
+        }
+        m_Stream += sizeof(BinaryMagic);
+
+        uint32_t Version = 0;
+        uint32_t Count = 0;
+        ReadU32(Version);
+        ReadU32(Count);
+        if (Version != BinaryVersion)
+        {
+            return Error("Unsupported version %u. Expected %u.", Version, BinaryVersion);
+        }
+
+        // Each string needs at least its length so a corrupt count can not cause a huge allocation.
+        if (Count > (size_t)(m_End - m_Stream) / 4)
+        {
+            return Error("Invalid string count %u.", Count);
+        }
+
+        m_Strings.reserve(Count);
+        for (uint32_t I = 0; I < Count; I++)
+        {
+            uint32_t Length = 0;
+            if (!ReadU32(Length))
+            {
+                return false;
+            }
+
+            if (Length > (size_t)(m_End - m_Stream))
+            {
+                return Error("Unexpected end of stream.");
+            }
+
+            m_Strings.emplace_back(m_Stream, Length);
+            m_Stream += Length;
+        }
+
+        return true;
     }
 
-    unsigned char Next()
+    bool ReadValue(Json& Value)
     {
-        if (IsEnd())
+        if (m_Stream >= m_End)
         {
-            return Current();
+            return Error("Unexpected end of stream.");
         }
 
-        m_Stream++;
-        m_Column++;
-        if (Current() == '\n')
+        const unsigned char Type = (unsigned char)*m_Stream++;
+        switch ((Json::Type)Type)
+        {
+        case Json::Type::Null: Value = Json(); return true;
+
+        case Json::Type::Boolean:
         {
-            m_Line++;
-            m_Column = 1;
+            if (m_Stream >= m_End)
+            {
+                return Error("Unexpected end of stream.");
+            }
+
+            Value = *m_Stream++ != 0;
+            return true;
         }
-        return Current();
-    }
 
-    bool IsEnd() const
-    {
-        return Current() == '\0';
-    }
+        case Json::Type::Number:
+        {
+            uint32_t Low = 0;
+            uint32_t High = 0;
+            if (!ReadU32(Low) || !ReadU32(High))
+            {
+                return false;
+            }
 
-    bool IsSpace() const
-    {
-        return std::isspace(Current());
+            const uint64_t Bits = (uint64_t)Low | ((uint64_t)High << 32);
+            double Number = 0.0;
+            std::memcpy(&Number, &Bits, sizeof(Number));
+            Value = Number;
+            return true;
+        }
+
+        case Json::Type::String:
+        {
+            std::string_view String;
+            if (!ReadString(String))
+            {
+                return false;
+            }
+
+            Value = Json(Json::Type::String);
+            Value.m_Data.String->assign(String.data(), String.size());
+            return true;
+        }
+
+        case Json::Type::Array:
+        case Json::Type::Object:
+        {
+            if (m_Depth >= MaxDepth)
+            {
+                return Error("Exceeded the maximum nesting depth of %u.", MaxDepth);
+            }
+
+            m_Depth++;
+            const bool Result = (Json::Type)Type == Json::Type::Array ? ReadArray(Value) : ReadObject(Value);
+            m_Depth--;
+            return Result;
+        }
+
+        default: break;
+        }
+
+        return Error("Invalid value type %u.", (unsigned int)Type);
     }
 
-    void ConsumeSpaces()
+    bool ReadArray(Json& Value)
     {
-        while (!IsEnd() && IsSpace())
+        uint32_t Count = 0;
+        if (!ReadU32(Count))
+        {
+            return false;
+        }
+
+        // Every item takes at least one byte.
+        if (Count > (size_t)(m_End - m_Stream))
+        {
+            return Error("Invalid array count %u.", Count);
+        }
+
+        Value = Json(Json::Type::Array);
+        std::vector<Json>& Array = *Value.m_Data.Array;
+        Array.resize(Count);
+        for (Json& Item : Array)
         {
-            Next();
+            if (!ReadValue(Item))
+            {
+                return false;
+            }
         }
+
+        return true;
     }
 
-    int Line() const
+    bool ReadObject(Json& Value)
     {
-        return m_Line;
+        uint32_t Count = 0;
+        if (!ReadU32(Count))
+        {
+            return false;
+        }
+
+        // Every member takes at least a key index and a type byte.
+        if (Count > (size_t)(m_End - m_Stream) / 5)
+        {
+            return Error("Invalid object count %u.", Count);
+        }
+
+        Value = Json(Json::Type::Object);
+        Json::Members& Object = *Value.m_Data.Object;
+        Object.Reserve(Count);
+        for (uint32_t I = 0; I < Count; I++)
+        {
+            std::string_view Key;
+            Json Item;
+            if (!ReadString(Key) || !ReadValue(Item))
+            {
+                return false;
+            }
+
+            if (Json* Existing = Object.Find(Key))
+            {
+                *Existing = std::move(Item);
+            }
+            else
+            {
+                Object.Append(std::string(Key), std::move(Item));
+            }
+        }
+
+        return true;
     }
 
-    int Column() const
+    bool Error(const char* Message, ...)
     {
-        return m_Column;
+        va_list List;
+        va_start(List, Message);
+
+        char Buffer[256] {};
+        vsnprintf(Buffer, sizeof(Buffer), Message, List);
+
+        va_end(List);
+
+        m_Error = Json(Json::Type::Object);
+        m_Error["Error"] = Buffer;
+        m_Error["Offset"] = (float)(m_Stream - m_Begin);
+
+        return false;
     }
 
-private:
+    const char* m_Begin { nullptr };
     const char* m_Stream { nullptr };
-    int m_Line { 1 };
-    int m_Column { 1 };
+    const char* m_End { nullptr };
+    unsigned int m_Depth { 0 };
+    std::vector<std::string_view> m_Strings {};
+    Json m_Error {};
 };
 
 const char* Json::ToString(Type InType)
@@ -126,11 +1080,19 @@ Json Json::Parse(const char* Stream)
 
 Json Json::Parse(const char* Stream, bool& IsError)
 {
-    IsError = false;
-    Lexer Lex { Stream };
-    Json Result;
-    ParseValue(Lex, Result, IsError);
-    return Result;
+    JsonReader Reader { Stream };
+    return Reader.Parse(IsError);
+}
+
+Json Json::FromBinary(const char* Data, size_t Size, bool& IsError)
+{
+    JsonBinaryReader Reader { Data, Size };
+    return Reader.Read(IsError);
+}
+
+bool Json::IsBinary(const char* Data, size_t Size)
+{
+    return Data != nullptr && Size >= BinaryHeaderSize && std::memcmp(Data, BinaryMagic, sizeof(BinaryMagic)) == 0;
 }
 
 const Json Json::Invalid;
@@ -154,7 +1116,7 @@ Json::Json(Type InType)
     }
     else if (IsObject())
     {
-        m_Data.Object = new Map();
+        m_Data.Object = new Members();
     }
 }
 
@@ -170,6 +1132,12 @@ Json::Json(float Value)
     m_Data.Number = Value;
 }
 
+Json::Json(double Value)
+    : m_Type(Type::Number)
+{
+    m_Data.Number = Value;
+}
+
 Json::Json(const char* Value)
     : m_Type(Type::String)
 {
@@ -250,6 +1218,16 @@ float Json::Number(float Default) const
         return Default;
     }
 
+    return (float)m_Data.Number;
+}
+
+double Json::Double(double Default) const
+{
+    if (!IsNumber())
+    {
+        return Default;
+    }
+
     return m_Data.Number;
 }
 
@@ -267,7 +1245,7 @@ unsigned int Json::Count() const
 {
     if (IsObject())
     {
-        return (unsigned int)m_Data.Object->size();
+        return (unsigned int)m_Data.Object->Items().size();
     }
 
     if (IsArray())
@@ -285,7 +1263,7 @@ void Json::ForEach(std::function<void(const std::string&, const Json&)> Callback
         return;
     }
 
-    for (const std::pair<std::string, Json> Item : *m_Data.Object)
+    for (const Members::Member& Item : m_Data.Object->Items())
     {
         Callback(Item.first, Item.second);
     }
@@ -320,6 +1298,14 @@ Json& Json::operator=(float Value)
     return *this;
 }
 
+Json& Json::operator=(double Value)
+{
+    Clear();
+    m_Type = Type::Number;
+    m_Data.Number = Value;
+    return *this;
+}
+
 Json& Json::operator=(const char* Value)
 {
     Clear();
@@ -366,12 +1352,12 @@ bool Json::operator!=(const Json& Other) const
 
 Json& Json::operator[](const char* Key)
 {
-    return (*m_Data.Object)[Key];
+    return m_Data.Object->Insert(Key);
 }
 
 Json& Json::operator[](const std::string& Key)
 {
-    return (*m_Data.Object)[Key];
+    return m_Data.Object->Insert(Key);
 }
 
 Json& Json::operator[](unsigned int Index)
@@ -395,22 +1381,14 @@ Json& Json::Push(Json&& Value)
 
 const Json& Json::operator[](const char* Key) const
 {
-    if (!IsObject() || m_Data.Object->find(Key) == m_Data.Object->end())
-    {
-        return Invalid;
-    }
-
-    return m_Data.Object->at(Key);
+    const Json* Result = IsObject() ? m_Data.Object->Find(Key) : nullptr;
+    return Result != nullptr ? *Result : Invalid;
 }
 
 const Json& Json::operator[](const std::string& Key) const
 {
-    if (!IsObject() || m_Data.Object->find(Key) == m_Data.Object->end())
-    {
-        return Invalid;
-    }
-
-    return m_Data.Object->at(Key);
+    const Json* Result = IsObject() ? m_Data.Object->Find(Key) : nullptr;
+    return Result != nullptr ? *Result : Invalid;
 }
 
 const Json& Json::operator[](unsigned int Index) const
@@ -430,7 +1408,7 @@ bool Json::Contains(const std::string& Key) const
         return false;
     }
 
-    return m_Data.Object->find(Key) != m_Data.Object->end();
+    return m_Data.Object->Find(Key) != nullptr;
 }
 
 bool Json::Erase(const std::string& Key)
@@ -440,14 +1418,7 @@ bool Json::Erase(const std::string& Key)
         return false;
     }
 
-    if (!Contains(Key))
-    {
-        return false;
-    }
-
-    m_Data.Object->erase(Key);
-
-    return true;
+    return m_Data.Object->Erase(Key);
 }
 
 std::string Json::ToString() const
@@ -460,298 +1431,10 @@ std::string Json::ToStringPretty() const
     return ToString(true, 0);
 }
 
-void Json::ParseKey(Lexer& InLexer, std::string& Key, bool& IsError)
-{
-    Key = "";
-
-    bool Parsing = false;
-    while (!InLexer.IsEnd())
-    {
-        unsigned char Ch = InLexer.Current();
-
-        if (Ch == '"')
-        {
-            if (!Parsing)
-            {
-                Parsing = true;
-            }
-            else
-            {
-                // Advance after the current '"' character.
-                InLexer.Next();
-                break;
-            }
-        }
-        else if (Parsing)
-        {
-            Key += Ch;
-        }
-        else
-        {
-            Key = "Key does not start with '\"' character.";
-            IsError = true;
-            break;
-        }
-
-        InLexer.Next();
-    }
-}
-
-void Json::ParseValue(Lexer& InLexer, Json& Value, bool& IsError)
-{
-    Value = Json();
-
-    InLexer.ConsumeSpaces();
-
-    std::string Token;
-    bool ParseString = false;
-    unsigned char LastCh = 0;
-    while (!InLexer.IsEnd())
-    {
-        unsigned char Ch = InLexer.Current();
-
-        if (Ch == '{')
-        {
-            InLexer.Next();
-            ParseObject(InLexer, Value, IsError);
-            break;
-        }
-        else if (Ch == '[')
-        {
-            InLexer.Next();
-            ParseArray(InLexer, Value, IsError);
-            break;
-        }
-        else if (Ch == '"')
-        {
-            Token += Ch;
-            if (ParseString)
-            {
-                InLexer.Next();
-                break;
-            }
-            else
-            {
-                ParseString = true;
-            }
-        }
-        else if (!ParseString && (Ch == ',' || Ch == '}' || Ch == ']' || std::isspace(Ch)))
-        {
-            break;
-        }
-        else if (isalnum(Ch) || ParseString || Ch == '.' || Ch == '-')
-        {
-            // Check for valid escape sequences.
-            if (LastCh == '\\')
-            {
-                switch (Ch)
-                {
-                case '"': Ch = '\"'; break;
-                case '\\':
-                case '/': Token += Ch; break;
-                case 'b': Ch = '\b'; break;
-                case 'f': Ch = '\f'; break;
-                case 'n': Ch = '\n'; break;
-                case 'r': Ch = '\r'; break;
-                case 't': Ch = '\t'; break;
-                case 'u': break; // TODO: Implement parsing 4-digit hex value.
-                default: Token += LastCh;
-                }
-            }
-
-            if (Ch != '\\')
-            {
-                Token += Ch;
-            }
-        }
-
-        LastCh = Ch;
-        InLexer.Next();
-    }
-
-    // This may come up if the stream just contains a number or boolean.
-    if (!Token.empty())
-    {
-        Value = ParseToken(Token, IsError);
-
-        if (IsError)
-        {
-            Value = Error(InLexer, "Invalid Json value '%s'.", Token.c_str());
-        }
-    }
-}
-
-void Json::ParseArray(Lexer& InLexer, Json& Root, bool& IsError)
-{
-    Root = Json(Type::Array);
-
-    while (!InLexer.IsEnd())
-    {
-        if (InLexer.Current() == ']')
-        {
-            InLexer.Next();
-            break;
-        }
-
-        Json Value;
-        ParseValue(InLexer, Value, IsError);
-
-        if (IsError)
-        {
-            Root = std::move(Value);
-            break;
-        }
-        else if (!Value.IsNull())
-        {
-            Root.m_Data.Array->push_back(std::move(Value));
-        }
-
-        InLexer.ConsumeSpaces();
-
-        if (InLexer.Current() == ']')
-        {
-            InLexer.Next();
-            break;
-        }
-        else if (InLexer.Current() == ',')
-        {
-            InLexer.Next();
-        }
-        else
-        {
-            Root = Error(InLexer, "Invalid array separator '%c'. Expected ',' or '].", InLexer.Current());
-            IsError = true;
-            break;
-        }
-    }
-}
-
-void Json::ParseObject(Lexer& InLexer, Json& Root, bool& IsError)
+std::string Json::ToBinary() const
 {
-    Root = Json(Type::Object);
-
-    std::string Key;
-    while (!InLexer.IsEnd())
-    {
-        InLexer.ConsumeSpaces();
-
-        // Empty object.
-        if (InLexer.Current() == '}')
-        {
-            InLexer.Next();
-            break;
-        }
-
-        ParseKey(InLexer, Key, IsError);
-
-        if (IsError)
-        {
-            Root = Error(InLexer, "%s", Key.c_str());
-            break;
-        }
-        else
-        {
-            InLexer.ConsumeSpaces();
-            if (InLexer.Current() == ':')
-            {
-                Json Value;
-                InLexer.Next();
-                ParseValue(InLexer, Value, IsError);
-                if (IsError)
-                {
-                    Root = std::move(Value);
-                }
-                else
-                {
-                    Root[Key] = std::move(Value);
-                }
-            }
-            else
-            {
-                Root = Error(InLexer, "Expected ':' character. Found '%c' instead.", InLexer.Current());
-                IsError = true;
-                break;
-            }
-        }
-
-        InLexer.ConsumeSpaces();
-
-        if (InLexer.Current() == '}')
-        {
-            // Object is complete.
-            InLexer.Next();
-            break;
-        }
-        else if (InLexer.Current() == ',')
-        {
-            InLexer.Next();
-        }
-        else
-        {
-            Root = Error(InLexer, "Invalid object separator '%c'. Expected ',' or '}'.", InLexer.Current());
-            IsError = true;
-            break;
-        }
-    }
-}
-
-Json Json::ParseToken(const std::string& Token, bool& IsError)
-{
-    Json Result;
-
-    if (Token.empty())
-    {
-        return Result;
-    }
-
-    std::string Lower = String::ToLower(Token);
-    if (Token.front() == '\"' && Token.back() == '\"')
-    {
-        Result = Token.substr(1, Token.length() - 2);
-    }
-    else if (Lower == "true")
-    {
-        Result = true;
-    }
-    else if (Lower == "false")
-    {
-        Result = false;
-    }
-    else if (Lower == "null")
-    {
-        // Do nothing.
-    }
-    else if (Token.find_first_not_of("-.0123456789") == std::string::npos)
-    {
-        Result = std::stof(Token);
-    }
-    else
-    {
-        IsError = true;
-    }
-
-    return Result;
-}
-
-Json Json::Error(const Lexer& InLexer, const char* Message, ...)
-{
-    va_list List;
-    va_start(List, Message);
-
-    std::string Buffer;
-    Buffer.resize(SHRT_MAX);
-    vsnprintf(Buffer.data(), Buffer.size(), Message, List);
-
-    va_end(List);
-
-    const std::string Position = std::to_string(InLexer.Line()) + ":" + std::to_string(InLexer.Column());
-    Json Result { Type::Object };
-    Result["Error"] = Position + " " + Buffer;
-    Result["Line"] = (float)InLexer.Line();
-    Result["Column"] = (float)InLexer.Column();
-
-    // Should be move constructed.
-    return Result;
+    JsonBinaryWriter Writer;
+    return Writer.Write(*this);
 }
 
 void Json::Clear()
@@ -785,7 +1468,7 @@ bool Json::Equals(const Json& Other) const
         return true;
     }
 
-    if (IsNumber() && Other.IsNumber() && Number() == Other.Number())
+    if (IsNumber() && Other.IsNumber() && Double() == Other.Double())
     {
         return true;
     }
@@ -795,17 +1478,17 @@ bool Json::Equals(const Json& Other) const
         return true;
     }
 
-    if (IsObject() && Other.IsObject())
+    if (IsObject() && Other.IsObject() && Count() == Other.Count())
     {
         bool Result = true;
         ForEach([&](const std::string& Key, const Json& Value) -> void
             {
-                Result &= Value.Equals(Other[Key]);
+                Result = Result && Other.Contains(Key) && Value.Equals(Other[Key]);
             });
         return Result;
     }
 
-    if (IsArray() && Other.IsArray())
+    if (IsArray() && Other.IsArray() && Count() == Other.Count())
     {
         bool Result = true;
         for (unsigned int I = 0; I < Count(); I++)
@@ -825,7 +1508,7 @@ void Json::Copy(const Json& Other)
     switch (m_Type)
     {
     case Type::Boolean: m_Data.Bool = Other.Boolean(); break;
-    case Type::Number: m_Data.Number = Other.Number(); break;
+    case Type::Number: m_Data.Number = Other.Double(); break;
     case Type::String:
     {
         m_Data.String = new std::string();
@@ -834,8 +1517,7 @@ void Json::Copy(const Json& Other)
     break;
     case Type::Object:
     {
-        m_Data.Object = new Map();
-        *m_Data.Object = *Other.m_Data.Object;
+        m_Data.Object = new Members(*Other.m_Data.Object);
     }
     break;
     case Type::Array:
@@ -862,7 +1544,7 @@ void Json::Move(Json&& Other)
     switch (m_Type)
     {
     case Type::Boolean: m_Data.Bool = std::exchange(Other.m_Data.Bool, false); break;
-    case Type::Number: m_Data.Number = std::exchange(Other.m_Data.Number, 0.0f); break;
+    case Type::Number: m_Data.Number = std::exchange(Other.m_Data.Number, 0.0); break;
     case Type::String: m_Data.String = std::exchange(Other.m_Data.String, nullptr); break;
     case Type::Object: m_Data.Object = std::exchange(Other.m_Data.Object, nullptr); break;
     case Type::Array: m_Data.Array = std::exchange(Other.m_Data.Array, nullptr); break;
@@ -917,13 +1599,15 @@ std::string Json::ToString(bool Pretty, int Depth) const
             Result += "\n";
             Depth++;
         }
-        for (std::map<std::string, Json>::const_iterator It = m_Data.Object->begin(); It != m_Data.Object->end(); ++It)
+        const std::vector<Members::Member>& Items = m_Data.Object->Items();
+        for (size_t I = 0; I < Items.size(); I++)
         {
-            Result += std::string(Depth * 4, ' ') + "\"" + It->first + "\"";
+            Result += std::string(Depth * 4, ' ');
+            AppendEscaped(Result, Items[I].first);
             Result += ": ";
-            Result += It->second.ToString(Pretty, Depth);
+            Result += Items[I].second.ToString(Pretty, Depth);
 
-            if (std::next(It) != m_Data.Object->end())
+            if (I < Items.size() - 1)
             {
                 Result += ",";
             }
@@ -951,13 +1635,11 @@ std::string Json::ToString(bool Pretty, int Depth) const
     }
     else if (IsNumber())
     {
-        Result = std::to_string(Number());
+        Result = std::to_string(Double());
     }
     else
     {
-        Result += "\"";
-        Result += String();
-        Result += "\"";
+        AppendEscaped(Result, String());
     }
 
     return Result;
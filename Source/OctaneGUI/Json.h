@@ -27,17 +27,27 @@ SOFTWARE.
 #pragma once
 
 #include <functional>
-#include <map>
 #include <string>
 #include <vector>
 
 namespace OctaneGUI
 {
 
-class Lexer;
+class JsonBinaryReader;
+class JsonBinaryWriter;
+class JsonReader;
 
+/// @brief JSON value type used for loading and saving application data.
+///
+/// Objects keep their members in insertion order in a single contiguous array.
+/// Small objects are searched linearly while larger objects build a hash index
+/// for key lookups.
 class Json
 {
+    friend JsonBinaryReader;
+    friend JsonBinaryWriter;
+    friend JsonReader;
+
 public:
     enum class Type : unsigned char
     {
@@ -53,6 +63,17 @@ public:
     static Json Parse(const char* Stream);
     static Json Parse(const char* Stream, bool& IsError);
 
+    /// @brief Loads a value from the binary format produced by ToBinary.
+    ///
+    /// Strings are stored once in a table and referenced by index, so loading does
+    /// not need to tokenize any text. Errors are reported the same way as Parse.
+    /// @param Data Pointer to the binary contents, which may be memory mapped.
+    /// @param Size Number of bytes in Data.
+    /// @param IsError Set to true if the contents are not a valid binary stream.
+    /// @return The loaded value, or an object with an 'Error' property on failure.
+    static Json FromBinary(const char* Data, size_t Size, bool& IsError);
+    static bool IsBinary(const char* Data, size_t Size);
+
     // TODO: Maybe not allow declaring a Null type due to no memory allocation
     // 		 for retrieving values from array/string/object? Or memory allocation could
     // 		 be handled better?
@@ -60,6 +81,7 @@ public:
     Json(Type InType);
     Json(bool Value);
     Json(float Value);
+    Json(double Value);
     Json(const char* Value);
     Json(const std::string& Value);
     Json(const Json& Other);
@@ -76,6 +98,8 @@ public:
 
     bool Boolean(bool Default = false) const;
     float Number(float Default = 0.0f) const;
+    /// @brief Returns the number at full precision, which is used for large counts and times.
+    double Double(double Default = 0.0) const;
     const char* String(const char* Default = "") const;
     unsigned int Count() const;
 
@@ -84,6 +108,7 @@ public:
 
     Json& operator=(bool Value);
     Json& operator=(float Value);
+    Json& operator=(double Value);
     Json& operator=(const char* Value);
     Json& operator=(const std::string& Value);
     Json& operator=(const Json& Other);
@@ -108,26 +133,20 @@ public:
 
     std::string ToString() const;
     std::string ToStringPretty() const;
+    std::string ToBinary() const;
 
 private:
-    typedef std::map<std::string, Json> Map;
+    class Members;
 
     union Data
     {
         bool Bool;
-        float Number;
+        double Number;
         std::string* String;
         std::vector<Json>* Array;
-        Map* Object;
+        Members* Object;
     };
 
-    static void ParseKey(Lexer& InLexer, std::string& Key, bool& IsError);
-    static void ParseValue(Lexer& InLexer, Json& Value, bool& IsError);
-    static void ParseArray(Lexer& InLexer, Json& Root, bool& IsError);
-    static void ParseObject(Lexer& InLexer, Json& Root, bool& IsError);
-    static Json ParseToken(const std::string& Token, bool& IsError);
-    static Json Error(const Lexer& InLexer, const char* Message, ...);
-
     static const Json Invalid;
 
     void Clear();
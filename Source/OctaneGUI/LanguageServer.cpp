@@ -286,6 +286,11 @@ LanguageServer& LanguageServer::ClearListeners()
     return *this;
 }
 
+size_t LanguageServer::Listeners() const
+{
+    return m_Listeners.size();
+}
+
 #if WITH_LSTALK
 static LanguageServer::Server::Status ToStatus(LSTalk_ConnectionStatus Status)
 {
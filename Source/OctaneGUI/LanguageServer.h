@@ -135,6 +135,7 @@ public:
     ListenerID RegisterListener(OnNotificationSignature&& Fn);
     LanguageServer& UnregisterListener(ListenerID ID);
     LanguageServer& ClearListeners();
+    size_t Listeners() const;
 
     void Process();
 
@@ -0,0 +1,201 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "LogBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace OctaneGUI
+{
+
+LogBuffer::LogBuffer()
+{
+}
+
+LogBuffer::~LogBuffer()
+{
+}
+
+LogBuffer& LogBuffer::SetCapacity(size_t Lines)
+{
+    m_Capacity = Lines;
+    Trim();
+    return *this;
+}
+
+size_t LogBuffer::Capacity() const
+{
+    return m_Capacity;
+}
+
+size_t LogBuffer::Append(std::string_view Text)
+{
+    size_t Result = 0;
+    size_t Start = 0;
+    while (Start < Text.size())
+    {
+        const void* Found = std::memchr(Text.data() + Start, '\n', Text.size() - Start);
+        const size_t End = Found != nullptr ? (size_t)((const char*)Found - Text.data()) : Text.size();
+        AppendLine(Text.substr(Start, End - Start));
+        Start = End + 1;
+        Result++;
+    }
+
+    return Result;
+}
+
+void LogBuffer::AppendLine(std::string_view Line)
+{
+    if (!Line.empty() && Line.back() == '\r')
+    {
+        Line.remove_suffix(1);
+    }
+
+    Chunk& Target = Reserve(Line.size());
+    if (!Line.empty())
+    {
+        std::memcpy(Target.Data.get() + Target.Size, Line.data(), Line.size());
+    }
+
+    m_Lines.push_back({ m_FirstChunk + m_Chunks.size() - 1, (uint32_t)Target.Size, (uint32_t)Line.size() });
+    Target.Size += Line.size();
+    Target.Lines++;
+    m_Longest = std::max<size_t>(m_Longest, Line.size());
+
+    Trim();
+}
+
+std::string_view LogBuffer::Line(size_t Index) const
+{
+    if (Index >= m_Lines.size())
+    {
+        return {};
+    }
+
+    const Entry& Item = m_Lines[Index];
+    const Chunk& Source = m_Chunks[(size_t)(Item.Chunk - m_FirstChunk)];
+    return { Source.Data.get() + Item.Offset, Item.Length };
+}
+
+size_t LogBuffer::Count() const
+{
+    return m_Lines.size();
+}
+
+uint64_t LogBuffer::Dropped() const
+{
+    return m_Dropped;
+}
+
+size_t LogBuffer::LongestLength() const
+{
+    return m_Longest;
+}
+
+size_t LogBuffer::Bytes() const
+{
+    return m_Bytes;
+}
+
+void LogBuffer::Clear()
+{
+    while (!m_Chunks.empty())
+    {
+        Release(m_Chunks.front());
+        m_Chunks.pop_front();
+    }
+
+    m_Lines.clear();
+    m_FirstChunk = 0;
+    m_Dropped = 0;
+    m_Longest = 0;
+}
+
+LogBuffer::Chunk& LogBuffer::Reserve(size_t Size)
+{
+    if (!m_Chunks.empty() && m_Chunks.back().Capacity - m_Chunks.back().Size >= Size)
+    {
+        return m_Chunks.back();
+    }
+
+    // Lines never span chunks. A line larger than a chunk gets a chunk of its own.
+    Chunk Item;
+    if (!m_Free.empty() && m_Free.back().Capacity >= Size)
+    {
+        Item = std::move(m_Free.back());
+        m_Free.pop_back();
+    }
+    else
+    {
+        Item.Capacity = std::max<size_t>(Size, ChunkSize);
+        Item.Data.reset(new char[Item.Capacity]);
+        m_Bytes += Item.Capacity;
+    }
+
+    m_Chunks.push_back(std::move(Item));
+    return m_Chunks.back();
+}
+
+void LogBuffer::Trim()
+{
+    if (m_Capacity == 0)
+    {
+        return;
+    }
+
+    while (m_Lines.size() > m_Capacity)
+    {
+        Chunk& Front = m_Chunks[(size_t)(m_Lines.front().Chunk - m_FirstChunk)];
+        m_Lines.pop_front();
+        m_Dropped++;
+
+        if (--Front.Lines == 0 && m_Chunks.size() > 1)
+        {
+            Release(Front);
+            m_Chunks.pop_front();
+            m_FirstChunk++;
+        }
+    }
+}
+
+void LogBuffer::Release(Chunk& Item)
+{
+    // Only a single spare chunk is kept so that memory follows the cap. Oversized
+    // chunks are freed instead of being recycled.
+    if (m_Free.empty() && Item.Capacity == ChunkSize)
+    {
+        Item.Size = 0;
+        Item.Lines = 0;
+        m_Free.push_back(std::move(Item));
+    }
+    else
+    {
+        m_Bytes -= Item.Capacity;
+    }
+}
+
+}
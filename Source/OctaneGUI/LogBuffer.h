@@ -0,0 +1,109 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Append-only store of UTF-8 lines with an optional line cap.
+///
+/// Lines are copied into large chunks instead of being allocated individually, and an
+/// index of each line's chunk and offset allows random access. Once the cap is reached,
+/// the oldest lines are dropped and chunks that no longer hold any lines are recycled,
+/// so memory stays bounded no matter how many lines are appended.
+class LogBuffer
+{
+public:
+    static constexpr size_t ChunkSize = 64 * 1024;
+
+    LogBuffer();
+    ~LogBuffer();
+
+    /// @brief Sets the maximum number of lines to keep. 0 keeps every line.
+    LogBuffer& SetCapacity(size_t Lines);
+    size_t Capacity() const;
+
+    /// @brief Appends each line of the given text. Lines are separated by '\n', a trailing
+    /// '\r' is removed and a '\n' at the end of the text does not start an empty line.
+    /// @return The number of lines appended.
+    size_t Append(std::string_view Text);
+    void AppendLine(std::string_view Line);
+
+    std::string_view Line(size_t Index) const;
+    size_t Count() const;
+
+    /// @brief Total number of lines dropped because of the cap since the last Clear.
+    uint64_t Dropped() const;
+
+    /// @brief Length in bytes of the longest line appended since the last Clear.
+    size_t LongestLength() const;
+
+    /// @brief Bytes allocated for chunks, including recycled ones.
+    size_t Bytes() const;
+
+    void Clear();
+
+private:
+    struct Chunk
+    {
+    public:
+        std::unique_ptr<char[]> Data { nullptr };
+        size_t Capacity { 0 };
+        size_t Size { 0 };
+        size_t Lines { 0 };
+    };
+
+    struct Entry
+    {
+    public:
+        uint64_t Chunk { 0 };
+        uint32_t Offset { 0 };
+        uint32_t Length { 0 };
+    };
+
+    Chunk& Reserve(size_t Size);
+    void Trim();
+    void Release(Chunk& Item);
+
+    std::deque<Chunk> m_Chunks {};
+    std::vector<Chunk> m_Free {};
+    std::deque<Entry> m_Lines {};
+    uint64_t m_FirstChunk { 0 };
+    uint64_t m_Dropped { 0 };
+    size_t m_Capacity { 0 };
+    size_t m_Longest { 0 };
+    size_t m_Bytes { 0 };
+};
+
+}
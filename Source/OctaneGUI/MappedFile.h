@@ -0,0 +1,68 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "Defines.h"
+
+#include <cstddef>
+
+namespace OctaneGUI
+{
+
+/// @brief Read-only view of a file's contents mapped into memory.
+///
+/// The contents are paged in by the operating system as they are accessed instead
+/// of being copied into a buffer up front. The view is valid until the object is
+/// closed or destroyed.
+class MappedFile
+{
+public:
+    MappedFile();
+    MappedFile(const char* Location);
+    MappedFile(const MappedFile&) = delete;
+    ~MappedFile();
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const char* Location);
+    void Close();
+
+    bool IsOpen() const;
+    const char* Data() const;
+    size_t Size() const;
+
+private:
+    const char* m_Data { nullptr };
+    size_t m_Size { 0 };
+
+#ifdef WINDOWS
+    void* m_File { nullptr };
+    void* m_Mapping { nullptr };
+#endif
+};
+
+}
@@ -28,6 +28,8 @@ SOFTWARE.
 
 #include "Application.h"
 #include "Assert.h"
+#include "AssetCache.h"
+#include "AssetLoader.h"
 #include "Clock.h"
 #include "Color.h"
 #include "Controls/BoxContainer.h"
@@ -44,11 +46,13 @@ SOFTWARE.
 #include "Controls/Image.h"
 #include "Controls/ImageButton.h"
 #include "Controls/ListBox.h"
+#include "Controls/LogView.h"
 #include "Controls/MarginContainer.h"
 #include "Controls/Menu.h"
 #include "Controls/MenuBar.h"
 #include "Controls/MenuItem.h"
 #include "Controls/Panel.h"
+#include "Controls/Plot.h"
 #include "Controls/RadioButton.h"
 #include "Controls/ScrollBar.h"
 #include "Controls/ScrollableContainer.h"
@@ -68,22 +72,33 @@ SOFTWARE.
 #include "Dialogs/FileDialog.h"
 #include "DrawCommand.h"
 #include "Event.h"
+#include "EventPlayer.h"
+#include "EventRecorder.h"
 #include "FileSystem.h"
 #include "FlyString.h"
 #include "Font.h"
+#include "FrameCapture.h"
+#include "IdleScheduler.h"
 #include "Json.h"
 #include "Keyboard.h"
 #include "LanguageServer.h"
+#include "LogBuffer.h"
+#include "MappedFile.h"
 #include "Mouse.h"
 #include "Network.h"
 #include "Paint.h"
+#include "PlotData.h"
 #include "Rect.h"
 #include "Socket.h"
 #include "String.h"
+#include "TableData.h"
+#include "Task.h"
 #include "Theme.h"
+#include "ThreadPool.h"
 #include "Timer.h"
 #include "Variant.h"
 #include "Vector2.h"
 #include "Vertex.h"
 #include "VertexBuffer.h"
 #include "Window.h"
+#include "WorkQueue.h"
@@ -27,11 +27,13 @@ SOFTWARE.
 #include "Paint.h"
 #include "Application.h"
 #include "Font.h"
+#include "Profiler.h"
 #include "Rect.h"
 #include "TextSpan.h"
 #include "Texture.h"
 #include "Theme.h"
 
+#include <algorithm>
 #include <cmath>
 
 #define PI 3.14159265358979323846f
@@ -42,40 +44,172 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
-std::vector<Vector2> GetArcPoints(const Vector2& Center, float Radius, float StartAngle, float EndAngle, int Steps)
+// Segment counts with a precomputed unit circle. Counts are multiples of 8 so that the
+// quarter and eighth arcs used by rounded rectangles start and end on table points.
+static constexpr int MinSteps = 8;
+static constexpr int MaxSteps = 256;
+
+// Largest distance in pixels between a circle and the segments approximating it.
+static constexpr float MaxSegmentError = 0.25f;
+
+class UnitCircles
 {
-    const float Rad = PI / 180;
-    const float Delta = Rad * (EndAngle - StartAngle);
-    const float Start = Rad * StartAngle;
+public:
+    static const UnitCircles& Get()
+    {
+        static const UnitCircles Instance;
+        return Instance;
+    }
 
-    std::vector<Vector2> Result;
-    Result.resize(Steps + 1);
+    // Returns Steps + 1 points going clockwise on screen from angle 0, or nullptr if there
+    // is no table for this count.
+    const Vector2* Points(int Steps) const
+    {
+        if (Steps < MinSteps || Steps > MaxSteps || Steps % MinSteps != 0)
+        {
+            return nullptr;
+        }
+
+        return &m_Points[m_Offsets[Steps / MinSteps - 1]];
+    }
 
-    for (int I = 0; I <= Steps; I++)
+private:
+    UnitCircles()
     {
-        const float Pct = ((float)I / (float)(Steps - 1));
-        const float Angle = Pct * Delta + Start;
-        const Vector2 Point { std::roundf(std::cos(Angle) * Radius), std::roundf(std::sin(Angle) * Radius) };
-        Result[I] = Center + Point;
+        for (int Steps = MinSteps; Steps <= MaxSteps; Steps += MinSteps)
+        {
+            m_Offsets.push_back(m_Points.size());
+
+            const float Delta = (2.0f * PI) / Steps;
+            for (int I = 0; I <= Steps; I++)
+            {
+                m_Points.push_back({ std::cos(I * Delta), std::sin(I * Delta) });
+            }
+        }
     }
 
-    return Result;
+    std::vector<Vector2> m_Points {};
+    std::vector<size_t> m_Offsets {};
+};
+
+// Produces the Steps + 1 points of an arc one at a time. Arcs that line up with a unit
+// circle table are read from it, other arcs are walked by rotating the previous point, so
+// no point needs its own sine and cosine.
+class ArcPoints
+{
+public:
+    ArcPoints(const Vector2& Center, float Radius, float StartAngle, float EndAngle, int Steps)
+        : m_Center(Center)
+        , m_Radius(Radius)
+        , m_Steps(std::max(Steps, 1))
+    {
+        const float Span = EndAngle - StartAngle;
+        if (Span != 0.0f)
+        {
+            const float Full = m_Steps * 360.0f / std::abs(Span);
+            const int CircleSteps = (int)std::lround(Full);
+            const float First = StartAngle * CircleSteps / 360.0f;
+            const Vector2* Table = UnitCircles::Get().Points(CircleSteps);
+            if (Table != nullptr && Span > 0.0f && std::abs(Full - CircleSteps) < 1e-3f && std::abs(First - std::round(First)) < 1e-3f)
+            {
+                m_Table = Table;
+                m_TableSteps = CircleSteps;
+                m_Index = ((int)std::lround(First) % CircleSteps + CircleSteps) % CircleSteps;
+                return;
+            }
+        }
+
+        const float Rad = PI / 180.0f;
+        const float Delta = Rad * Span / m_Steps;
+        m_Unit = { std::cos(Rad * StartAngle), std::sin(Rad * StartAngle) };
+        m_Rotation = { std::cos(Delta), std::sin(Delta) };
+    }
+
+    int Count() const
+    {
+        return m_Steps + 1;
+    }
+
+    Vector2 Next()
+    {
+        Vector2 Unit;
+        if (m_Table != nullptr)
+        {
+            Unit = m_Table[m_Index];
+            m_Index = m_Index == m_TableSteps - 1 ? 0 : m_Index + 1;
+        }
+        else
+        {
+            Unit = m_Unit;
+            m_Unit = {
+                m_Unit.X * m_Rotation.X - m_Unit.Y * m_Rotation.Y,
+                m_Unit.X * m_Rotation.Y + m_Unit.Y * m_Rotation.X
+            };
+        }
+
+        return { m_Center.X + std::roundf(Unit.X * m_Radius), m_Center.Y + std::roundf(Unit.Y * m_Radius) };
+    }
+
+private:
+    Vector2 m_Center {};
+    float m_Radius { 0.0f };
+    int m_Steps { 1 };
+
+    const Vector2* m_Table { nullptr };
+    int m_TableSteps { 0 };
+    int m_Index { 0 };
+
+    Vector2 m_Unit {};
+    Vector2 m_Rotation {};
+};
+
+// Number of steps for an arc covering the given number of degrees.
+static int ArcSteps(float Radius, float Degrees, int Steps)
+{
+    if (Steps > 0)
+    {
+        return std::min(Steps, MaxSteps);
+    }
+
+    return std::max(1, (int)std::lround(Paint::CircleSteps(Radius) * std::abs(Degrees) / 360.0f));
+}
+
+// Longest a joint may extend past the line's thickness before it is cut short, relative
+// to half the thickness. Keeps sharp turns from producing long spikes.
+static constexpr float MiterLimit = 2.0f;
+
+static Vector2 SegmentNormal(const Vector2& Start, const Vector2& End)
+{
+    const Vector2 Direction = (End - Start).Unit();
+    return { -Direction.Y, Direction.X };
 }
 
-std::vector<Vector2> GetCirclePoints(const Vector2& Center, float Radius, int Steps)
+// Offset from a polyline's point to the vertex on one side of the line, given the normals
+// of the segments before and after the point.
+static Vector2 JoinOffset(const Vector2& Before, const Vector2& After, float HalfThickness)
 {
-    const float Delta = (2.0f * PI) / Steps;
+    const Vector2 Miter = (Before + After).Unit();
+    const float Cosine = Miter.X * After.X + Miter.Y * After.Y;
+    if (Cosine <= 1.0f / MiterLimit)
+    {
+        return After * HalfThickness;
+    }
 
-    std::vector<Vector2> Result;
-    Result.resize(Steps + 1);
+    return Miter * (HalfThickness / Cosine);
+}
 
-    for (int I = 0; I <= Steps; I++)
+int Paint::CircleSteps(float Radius)
+{
+    if (Radius <= MaxSegmentError)
     {
-        const float Angle = I * Delta;
-        Result[I] = { Center.X + std::roundf(std::cos(Angle) * Radius), Center.Y + std::roundf(std::sin(Angle) * Radius) };
+        return MinSteps;
     }
 
-    return Result;
+    // Each segment may cut at most MaxSegmentError pixels into the circle.
+    const float Angle = 2.0f * std::acos(1.0f - MaxSegmentError / Radius);
+    const int Steps = (int)std::ceil(2.0f * PI / Angle);
+    const int Rounded = (Steps + MinSteps - 1) / MinSteps * MinSteps;
+    return std::clamp(Rounded, MinSteps, MaxSteps);
 }
 
 Paint::Paint()
@@ -174,10 +308,26 @@ void Paint::RectangleRounded(const Rect& Bounds, const Color& Col, const Rect& R
     Vector2 Min {};
     Vector2 Max {};
 
+    // Corners without a radius have no arc.
+    const Vector2 Centers[4] {
+        { Left + RadiusTL, Top + RadiusTL },
+        { Right - RadiusTR, Top + RadiusTR },
+        { Right - RadiusBR, Bottom - RadiusBR },
+        { Left + RadiusBL, Bottom - RadiusBL }
+    };
+    const float Radii[4] { RadiusTL, RadiusTR, RadiusBR, RadiusBL };
+    const float Angles[4] { 180.0f, 270.0f, 0.0f, 90.0f };
+
+    int Steps[4] {};
+    int ArcIndices = 0;
+    for (int I = 0; I < 4; I++)
+    {
+        Steps[I] = Radii[I] > 0.0f ? ArcSteps(Radii[I], 90.0f, 0) : 0;
+        ArcIndices += CIRCLE_INDEX_COUNT(Steps[I]);
+    }
+
     // 5 Rectangles and 4 arcs.
-    const int Steps = 32;
-    uint32_t IndexCount = RECT_INDEX_COUNT(5) + CIRCLE_INDEX_COUNT(Steps) * 4;
-    PushCommand(IndexCount, 0);
+    PushCommand(RECT_INDEX_COUNT(5) + ArcIndices, 0);
 
     // Left Rectangle
     Min = { Left, Top + RadiusTL };
@@ -209,25 +359,18 @@ void Paint::RectangleRounded(const Rect& Bounds, const Color& Col, const Rect& R
     AddTriangles({ Min, Max }, Col, Offset);
     Offset += 4;
 
-    Vector2 Center { Left + RadiusTL, Top + RadiusTL };
-    std::vector<Vector2> Vertices = GetArcPoints(Center, RadiusTL, 180.0f, 270.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
-
-    Center = { Right - RadiusTR, Top + RadiusTR };
-    Vertices = GetArcPoints(Center, RadiusTR, 270.0f, 360.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
-
-    Center = { Right - RadiusBR, Bottom - RadiusBR };
-    Vertices = GetArcPoints(Center, RadiusBR, 0.0f, 90.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
+    for (int I = 0; I < 4; I++)
+    {
+        if (Steps[I] == 0)
+        {
+            continue;
+        }
 
-    Center = { Left + RadiusBL, Bottom - RadiusBL };
-    Vertices = GetArcPoints(Center, RadiusBL, 90.0f, 180.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
+        // Each fan adds its center and Steps + 1 points.
+        ArcPoints Points(Centers[I], Radii[I], Angles[I], Angles[I] + 90.0f, Steps[I]);
+        AddFan(Centers[I], Points, Col, Offset);
+        Offset += Steps[I] + 2;
+    }
 }
 
 void Paint::Text(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const Color& Col)
@@ -322,60 +465,114 @@ void Paint::TextWrapped(const std::shared_ptr<Font>& InFont, const Vector2& Posi
 
 void Paint::Image(const Rect& Bounds, const Rect& TexCoords, const std::shared_ptr<Texture>& InTexture, const Color& Col)
 {
-    if (!InTexture)
+    // Textures that are still loading are skipped.
+    if (!InTexture || !InTexture->IsValid())
     {
         return;
     }
 
     PushCommand(6, InTexture->GetID());
-    AddTriangles(Bounds, TexCoords, Col);
+    AddTriangles(Bounds, InTexture->MapTexCoords(TexCoords), Col);
 }
 
 void Paint::Circle(const Vector2& Center, float Radius, const Color& Tint, int Steps)
 {
-    std::vector<Vector2> Vertices = GetCirclePoints(Center, Radius, Steps);
+    ArcPoints Points(Center, Radius, 0.0f, 360.0f, ArcSteps(Radius, 360.0f, Steps));
 
-    PushCommand(3 * Steps, 0);
-    AddTrianglesCircle(Center, Vertices, Tint, 0);
+    const int Segments = Points.Count() - 1;
+    PushCommand(CIRCLE_INDEX_COUNT(Segments), 0);
+    AddFan(Center, Points, Tint, 0);
 }
 
 void Paint::CircleOutline(const Vector2& Center, float Radius, const Color& Tint, float Thickness, int Steps)
 {
-    std::vector<Vector2> Vertices = GetCirclePoints(Center, Radius, Steps);
+    ArcOutline(Center, Radius, 0.0f, 360.0f, Tint, Thickness, ArcSteps(Radius, 360.0f, Steps));
+}
 
-    Vector2 Start = Vertices[0];
-    for (size_t I = 1; I < Vertices.size(); I++)
+void Paint::Arc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, int Steps)
+{
+    ArcPoints Points(Center, Radius, StartAngle, EndAngle, ArcSteps(Radius, EndAngle - StartAngle, Steps));
+
+    const int Segments = Points.Count() - 1;
+    PushCommand(CIRCLE_INDEX_COUNT(Segments), 0);
+    AddFan(Center, Points, Tint);
+}
+
+void Paint::ArcOutline(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, float Thickness, int Steps)
+{
+    ArcPoints Points(Center, Radius, StartAngle, EndAngle, ArcSteps(Radius, EndAngle - StartAngle, Steps));
+
+    const int Segments = Points.Count() - 1;
+    PushCommand(RECT_INDEX_COUNT(Segments), 0);
+
+    Vector2 Start = Points.Next();
+    for (int I = 0; I < Segments; I++)
     {
-        const Vector2& End = Vertices[I];
-        Line(Start, End, Tint, Thickness);
+        const Vector2 End = Points.Next();
+        AddLine(Start, End, Tint, Thickness, I * 4);
         Start = End;
     }
-
-    Line(Start, Vertices.front(), Tint, Thickness);
 }
 
-void Paint::Arc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, int Steps)
+void Paint::Polyline(const std::vector<Vector2>& Points, const Color& Col, float Thickness)
 {
-    std::vector<Vector2> Vertices = GetArcPoints(Center, Radius, StartAngle, EndAngle, Steps);
+    if (Points.size() < 2)
+    {
+        return;
+    }
+
+    const float HalfThickness = Thickness * 0.5f;
+
+    // Long lines are split so that each command can be addressed by a compact buffer. Each
+    // piece starts at the last point of the previous one.
+    const size_t MaxPoints = VertexBuffer::CompactMaxVertices / 2;
+    for (size_t Start = 0; Start + 1 < Points.size(); Start += MaxPoints - 1)
+    {
+        const size_t End = std::min<size_t>(Points.size(), Start + MaxPoints);
+        PushCommand(RECT_INDEX_COUNT((uint32_t)(End - Start - 1)), 0);
+
+        Vector2 Before = Start > 0 ? SegmentNormal(Points[Start - 1], Points[Start]) : SegmentNormal(Points[Start], Points[Start + 1]);
+        for (size_t I = Start; I < End; I++)
+        {
+            Vector2 After = I + 1 < Points.size() ? SegmentNormal(Points[I], Points[I + 1]) : Before;
+
+            // Segments with no length keep the direction of the previous segment.
+            if (After.X == 0.0f && After.Y == 0.0f)
+            {
+                After = Before;
+            }
+
+            const Vector2 Offset = JoinOffset(Before, After, HalfThickness);
+            m_Buffer.AddVertex(Points[I] + Offset, Col);
+            m_Buffer.AddVertex(Points[I] - Offset, Col);
+            Before = After;
+        }
 
-    PushCommand(3 * Steps, 0);
-    AddTrianglesCircle(Center, Vertices, Tint);
+        AddStripIndices((uint32_t)(End - Start));
+    }
 }
 
-void Paint::ArcOutline(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, float Thickness, int Steps)
+void Paint::Strip(const std::vector<Vector2>& Upper, const std::vector<Vector2>& Lower, const Color& Col)
 {
-    std::vector<Vector2> Vertices = GetArcPoints(Center, Radius, StartAngle, EndAngle, Steps);
-    if (Vertices.empty())
+    const size_t Count = std::min(Upper.size(), Lower.size());
+    if (Count < 2)
     {
         return;
     }
 
-    Vector2 Start = Vertices[0];
-    for (size_t I = 1; I < Vertices.size(); I++)
+    const size_t MaxPoints = VertexBuffer::CompactMaxVertices / 2;
+    for (size_t Start = 0; Start + 1 < Count; Start += MaxPoints - 1)
     {
-        const Vector2& End = Vertices[I];
-        Line(Start, End, Tint, Thickness);
-        Start = End;
+        const size_t End = std::min<size_t>(Count, Start + MaxPoints);
+        PushCommand(RECT_INDEX_COUNT((uint32_t)(End - Start - 1)), 0);
+
+        for (size_t I = Start; I < End; I++)
+        {
+            m_Buffer.AddVertex(Upper[I], Col);
+            m_Buffer.AddVertex(Lower[I], Col);
+        }
+
+        AddStripIndices((uint32_t)(End - Start));
     }
 }
 
@@ -408,11 +605,45 @@ bool Paint::IsClipped(const Rect& Bounds) const
     return !(Clip.Intersects(Bounds) || Clip.Encompasses(Bounds));
 }
 
+void Paint::SetCompact(bool Compact)
+{
+    m_Buffer.SetCompact(Compact);
+}
+
 const VertexBuffer& Paint::GetBuffer() const
 {
     return m_Buffer;
 }
 
+void Paint::SetThreadPool(ThreadPool* Pool, size_t Threshold)
+{
+    m_ThreadPool = Pool;
+    m_SubtreeThreshold = Threshold;
+}
+
+ThreadPool* Paint::GetThreadPool() const
+{
+    return m_ThreadPool;
+}
+
+size_t Paint::SubtreeThreshold() const
+{
+    return m_SubtreeThreshold;
+}
+
+std::unique_ptr<Paint> Paint::CreateSegment() const
+{
+    std::unique_ptr<Paint> Result = std::make_unique<Paint>(m_Theme);
+    Result->m_ClipStack = m_ClipStack;
+    Result->m_Buffer.SetCompact(m_Buffer.IsCompact());
+    return Result;
+}
+
+void Paint::AppendSegment(const Paint& Segment)
+{
+    m_Buffer.Append(Segment.m_Buffer);
+}
+
 std::shared_ptr<Theme> Paint::GetTheme() const
 {
     return m_Theme;
@@ -458,29 +689,41 @@ void Paint::AddTriangles(const std::vector<Rect>& Rects, const std::vector<Rect>
         return;
     }
 
-    PushCommand(6 * (uint32_t)Rects.size(), TextureID);
-
-    uint32_t Offset = 0;
-    for (size_t I = 0; I < Rects.size(); I++)
+    // Split long runs so that each command can be addressed by a compact buffer. The
+    // pieces are merged back together by a regular buffer.
+    const size_t MaxRects = VertexBuffer::CompactMaxVertices / 4;
+    for (size_t Start = 0; Start < Rects.size(); Start += MaxRects)
     {
-        const Rect& Vertices = Rects[I];
-        const Rect& TexCoords = UVs[I];
-        const Color& Color_ = Colors[I];
+        const size_t End = std::min<size_t>(Rects.size(), Start + MaxRects);
+        PushCommand(6 * (uint32_t)(End - Start), TextureID);
 
-        AddTriangles(Vertices, TexCoords, Color_, Offset);
-        Offset += 4;
+        uint32_t Offset = 0;
+        for (size_t I = Start; I < End; I++)
+        {
+            const Rect& Vertices = Rects[I];
+            const Rect& TexCoords = UVs[I];
+            const Color& Color_ = Colors[I];
+
+            AddTriangles(Vertices, TexCoords, Color_, Offset);
+            Offset += 4;
+        }
     }
 }
 
-void Paint::AddTrianglesCircle(const Vector2& Center, const std::vector<Vector2>& Vertices, const Color& Tint, uint32_t Offset)
+void Paint::AddFan(const Vector2& Center, ArcPoints& Points, const Color& Tint, uint32_t Offset)
 {
     m_Buffer.AddVertex(Center, Tint);
-    m_Buffer.AddVertices(Vertices, Tint);
 
-    // We subtract 1 due to the zero-th index being the center.
-    for (size_t I = 0; I < Vertices.size() - 1; I++)
+    const int Count = Points.Count();
+    for (int I = 0; I < Count; I++)
+    {
+        m_Buffer.AddVertex(Points.Next(), Tint);
+    }
+
+    // The first vertex is the center.
+    for (int I = 0; I < Count - 1; I++)
     {
-        m_Buffer.AddIndex(0);
+        m_Buffer.AddIndex(Offset);
         m_Buffer.AddIndex(Offset + (uint32_t)I + 1);
         m_Buffer.AddIndex(Offset + (uint32_t)I + 2);
     }
@@ -496,6 +739,21 @@ void Paint::AddTriangleIndices(uint32_t Offset)
     m_Buffer.AddIndex(Offset + 3);
 }
 
+void Paint::AddStripIndices(uint32_t Count)
+{
+    // Vertices alternate between the two sides of the strip.
+    for (uint32_t I = 0; I + 1 < Count; I++)
+    {
+        const uint32_t Offset = I * 2;
+        m_Buffer.AddIndex(Offset);
+        m_Buffer.AddIndex(Offset + 2);
+        m_Buffer.AddIndex(Offset + 3);
+        m_Buffer.AddIndex(Offset);
+        m_Buffer.AddIndex(Offset + 3);
+        m_Buffer.AddIndex(Offset + 1);
+    }
+}
+
 DrawCommand& Paint::PushCommand(uint32_t IndexCount, uint32_t TextureID)
 {
     return m_Buffer.PushCommand(IndexCount, TextureID, !m_ClipStack.empty() ? m_ClipStack.back() : Rect());
@@ -536,6 +794,8 @@ int Paint::GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position,
         }
     }
 
+    PROFILER_COUNTER(Glyphs, Result);
+
     return Result;
 }
 
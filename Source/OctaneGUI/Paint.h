@@ -38,14 +38,25 @@ namespace OctaneGUI
 {
 
 struct Rect;
+class ArcPoints;
 class Font;
 struct TextSpan;
 class Texture;
 class Theme;
+class ThreadPool;
 
 class Paint
 {
 public:
+    /// @brief The number of steps used for a full circle of the given radius when a
+    /// function is given 0 steps. Enough steps are used to keep each segment within a
+    /// quarter pixel of the circle.
+    static int CircleSteps(float Radius);
+
+    /// @brief The default number of controls a subtree needs before it is painted as a
+    /// separate task.
+    static constexpr size_t DefaultSubtreeThreshold = 512;
+
     Paint();
     Paint(const std::shared_ptr<Theme>& InTheme);
     ~Paint();
@@ -60,25 +71,49 @@ public:
     void Textf(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const std::vector<TextSpan>& Spans);
     void TextWrapped(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const std::vector<TextSpan>& Spans, float Width);
     void Image(const Rect& Bounds, const Rect& TexCoords, const std::shared_ptr<Texture>& InTexture, const Color& Col);
-    void Circle(const Vector2& Center, float Radius, const Color& Tint, int Steps = 64);
-    void CircleOutline(const Vector2& Center, float Radius, const Color& Tint, float Thickness = 1.0f, int Steps = 64);
-    void Arc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, int Steps = 32);
-    void ArcOutline(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, float Thickness = 1.0f, int Steps = 32);
+    void Circle(const Vector2& Center, float Radius, const Color& Tint, int Steps = 0);
+    void CircleOutline(const Vector2& Center, float Radius, const Color& Tint, float Thickness = 1.0f, int Steps = 0);
+    void Arc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, int Steps = 0);
+    void ArcOutline(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, float Thickness = 1.0f, int Steps = 0);
+
+    /// @brief Paints connected line segments through each point as a single strip of
+    /// triangles, with mitered joints.
+    void Polyline(const std::vector<Vector2>& Points, const Color& Col, float Thickness = 1.0f);
+
+    /// @brief Fills the area between two lines of points. Each upper point is joined with
+    /// the lower point at the same index.
+    void Strip(const std::vector<Vector2>& Upper, const std::vector<Vector2>& Lower, const Color& Col);
 
     void PushClip(const Rect& Bounds);
     void PopClip();
     bool IsClipped(const Rect& Bounds) const;
 
+    /// @brief Fills the buffer with compact vertices and 16-bit indices. Must be called
+    /// before anything is painted.
+    void SetCompact(bool Compact);
     const VertexBuffer& GetBuffer() const;
     std::shared_ptr<Theme> GetTheme() const;
 
+    /// @brief Allows containers to paint child subtrees of at least Threshold controls on
+    /// the given pool. Each subtree is painted into a segment which is appended back to
+    /// this brush in paint order. A null pool paints everything on the calling thread.
+    void SetThreadPool(ThreadPool* Pool, size_t Threshold = DefaultSubtreeThreshold);
+    ThreadPool* GetThreadPool() const;
+    size_t SubtreeThreshold() const;
+
+    /// @brief Creates a brush that paints with the same theme, format and clip stack as
+    /// this one. Segments do not split their own subtrees any further.
+    std::unique_ptr<Paint> CreateSegment() const;
+    void AppendSegment(const Paint& Segment);
+
 private:
     void AddLine(const Vector2& Start, const Vector2& End, const Color& Col, float Thickness, uint32_t IndexOffset = 0);
     void AddTriangles(const Rect& Vertices, const Color& Col, uint32_t IndexOffset = 0);
     void AddTriangles(const Rect& Vertices, const Rect& TexCoords, const Color& Col, uint32_t IndexOffset = 0);
     void AddTriangles(const std::vector<Rect>& Rects, const std::vector<Rect>& UVs, const std::vector<Color>& Colors, uint32_t TextureID);
-    void AddTrianglesCircle(const Vector2& Center, const std::vector<Vector2>& Vertices, const Color& Tint, uint32_t Offset = 0);
+    void AddFan(const Vector2& Center, ArcPoints& Points, const Color& Tint, uint32_t Offset = 0);
     void AddTriangleIndices(uint32_t Offset);
+    void AddStripIndices(uint32_t Count);
     DrawCommand& PushCommand(uint32_t IndexCount, uint32_t TextureID);
 
     int GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents, std::vector<Rect>& Rects, std::vector<Rect>& UVs, bool ShouldClip = true);
@@ -86,6 +121,8 @@ private:
     std::shared_ptr<Theme> m_Theme { nullptr };
     std::vector<Rect> m_ClipStack {};
     VertexBuffer m_Buffer {};
+    ThreadPool* m_ThreadPool { nullptr };
+    size_t m_SubtreeThreshold { DefaultSubtreeThreshold };
 };
 
 }
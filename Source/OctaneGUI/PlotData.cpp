@@ -0,0 +1,277 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "PlotData.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace OctaneGUI
+{
+
+// Widens the range to include each value. Min and Max may point to the same values.
+static void Scan(const float* Min, const float* Max, size_t Count, PlotData::Range& Result)
+{
+    // Independent lanes let the compiler keep the loop in vector registers.
+    constexpr size_t Lanes = 8;
+
+    size_t I = 0;
+    if (Count >= Lanes)
+    {
+        float Mins[Lanes];
+        float Maxs[Lanes];
+        for (size_t Lane = 0; Lane < Lanes; Lane++)
+        {
+            Mins[Lane] = Min[Lane];
+            Maxs[Lane] = Max[Lane];
+        }
+
+        for (I = Lanes; I + Lanes <= Count; I += Lanes)
+        {
+            for (size_t Lane = 0; Lane < Lanes; Lane++)
+            {
+                Mins[Lane] = Min[I + Lane] < Mins[Lane] ? Min[I + Lane] : Mins[Lane];
+                Maxs[Lane] = Max[I + Lane] > Maxs[Lane] ? Max[I + Lane] : Maxs[Lane];
+            }
+        }
+
+        for (size_t Lane = 0; Lane < Lanes; Lane++)
+        {
+            Result.Min = std::min(Result.Min, Mins[Lane]);
+            Result.Max = std::max(Result.Max, Maxs[Lane]);
+        }
+    }
+
+    for (; I < Count; I++)
+    {
+        Result.Min = std::min(Result.Min, Min[I]);
+        Result.Max = std::max(Result.Max, Max[I]);
+    }
+}
+
+PlotData::PlotData()
+{
+}
+
+PlotData::~PlotData()
+{
+}
+
+size_t PlotData::AddSeries()
+{
+    Series Item;
+    Item.Values.resize(m_X.size(), 0.0f);
+    UpdateLevels(Item);
+    m_Series.push_back(std::move(Item));
+    return m_Series.size() - 1;
+}
+
+size_t PlotData::SeriesCount() const
+{
+    return m_Series.size();
+}
+
+PlotData& PlotData::Append(double X, const std::vector<float>& Values)
+{
+    m_X.push_back(m_X.empty() ? X : std::max(X, m_X.back()));
+
+    for (size_t I = 0; I < m_Series.size(); I++)
+    {
+        Series& Item = m_Series[I];
+        Item.Values.push_back(I < Values.size() ? Values[I] : 0.0f);
+        UpdateLevels(Item);
+    }
+
+    return *this;
+}
+
+PlotData& PlotData::Append(const std::vector<double>& X, const std::vector<std::vector<float>>& Values)
+{
+    if (X.empty())
+    {
+        return *this;
+    }
+
+    const size_t Start = m_X.size();
+    m_X.insert(m_X.end(), X.begin(), X.end());
+    for (size_t I = std::max<size_t>(Start, 1); I < m_X.size(); I++)
+    {
+        m_X[I] = std::max(m_X[I], m_X[I - 1]);
+    }
+
+    for (size_t I = 0; I < m_Series.size(); I++)
+    {
+        Series& Item = m_Series[I];
+        if (I < Values.size())
+        {
+            const std::vector<float>& Column = Values[I];
+            const size_t Count = std::min(Column.size(), X.size());
+            Item.Values.insert(Item.Values.end(), Column.begin(), Column.begin() + Count);
+        }
+        Item.Values.resize(m_X.size(), 0.0f);
+        UpdateLevels(Item);
+    }
+
+    return *this;
+}
+
+PlotData& PlotData::Clear()
+{
+    m_X.clear();
+    for (Series& Item : m_Series)
+    {
+        Item.Values.clear();
+        Item.Levels.clear();
+    }
+    return *this;
+}
+
+size_t PlotData::Count() const
+{
+    return m_X.size();
+}
+
+double PlotData::X(size_t Index) const
+{
+    return m_X[Index];
+}
+
+float PlotData::Value(size_t Series, size_t Index) const
+{
+    return m_Series[Series].Values[Index];
+}
+
+const std::vector<double>& PlotData::XValues() const
+{
+    return m_X;
+}
+
+const std::vector<float>& PlotData::Values(size_t Series) const
+{
+    return m_Series[Series].Values;
+}
+
+size_t PlotData::LowerBound(double X) const
+{
+    return std::lower_bound(m_X.begin(), m_X.end(), X) - m_X.begin();
+}
+
+PlotData::Range PlotData::MinMax(size_t Series, size_t Begin, size_t End) const
+{
+    Range Result { std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+
+    const PlotData::Series& Item = m_Series[Series];
+    End = std::min(End, Item.Values.size());
+    if (Begin >= End)
+    {
+        return Result;
+    }
+
+    // Scan the partial blocks at either end of the span and move up a level for the whole
+    // blocks in between.
+    const float* Min = Item.Values.data();
+    const float* Max = Item.Values.data();
+    size_t Lo = Begin;
+    size_t Hi = End;
+    for (size_t Level = 0;; Level++)
+    {
+        if (Hi - Lo < Fanout * 2 || Level == Item.Levels.size())
+        {
+            Scan(Min + Lo, Max + Lo, Hi - Lo, Result);
+            break;
+        }
+
+        const size_t AlignedLo = (Lo + Fanout - 1) / Fanout * Fanout;
+        const size_t AlignedHi = Hi / Fanout * Fanout;
+        Scan(Min + Lo, Max + Lo, AlignedLo - Lo, Result);
+        Scan(Min + AlignedHi, Max + AlignedHi, Hi - AlignedHi, Result);
+
+        Lo = AlignedLo / Fanout;
+        Hi = AlignedHi / Fanout;
+        Min = Item.Levels[Level].Min.data();
+        Max = Item.Levels[Level].Max.data();
+    }
+
+    return Result;
+}
+
+void PlotData::Decimate(size_t Series, double XMin, double XMax, size_t Columns, std::vector<Bucket>& Buckets) const
+{
+    Buckets.assign(Columns, { 0.0f, 0.0f, 0.0f, 0.0f, 0 });
+    if (Columns == 0 || XMax <= XMin || m_X.empty())
+    {
+        return;
+    }
+
+    const std::vector<float>& Values = m_Series[Series].Values;
+    const double Width = (XMax - XMin) / (double)Columns;
+    size_t Begin = LowerBound(XMin);
+    for (size_t Column = 0; Column < Columns && Begin < m_X.size(); Column++)
+    {
+        const double Edge = Column + 1 == Columns ? XMax : XMin + Width * (double)(Column + 1);
+        const size_t End = std::lower_bound(m_X.begin() + Begin, m_X.end(), Edge) - m_X.begin();
+        if (End > Begin)
+        {
+            const Range Span = MinMax(Series, Begin, End);
+            Buckets[Column] = { Span.Min, Span.Max, Values[Begin], Values[End - 1], End - Begin };
+        }
+        Begin = End;
+    }
+}
+
+size_t PlotData::Levels() const
+{
+    return m_Series.empty() ? 0 : m_Series.front().Levels.size();
+}
+
+void PlotData::UpdateLevels(Series& Item)
+{
+    // Only whole blocks are summarized, so appending never changes an existing entry.
+    size_t Count = Item.Values.size();
+    for (size_t Index = 0; Count >= Fanout; Index++)
+    {
+        if (Index == Item.Levels.size())
+        {
+            Item.Levels.emplace_back();
+        }
+
+        const float* Min = Index == 0 ? Item.Values.data() : Item.Levels[Index - 1].Min.data();
+        const float* Max = Index == 0 ? Item.Values.data() : Item.Levels[Index - 1].Max.data();
+
+        Level& Current = Item.Levels[Index];
+        for (size_t Block = Current.Min.size(); Block < Count / Fanout; Block++)
+        {
+            Range Span { std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+            Scan(Min + Block * Fanout, Max + Block * Fanout, Fanout, Span);
+            Current.Min.push_back(Span.Min);
+            Current.Max.push_back(Span.Max);
+        }
+
+        Count = Current.Min.size();
+    }
+}
+
+}
@@ -0,0 +1,125 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Samples for a plot stored as columns: one column of X values shared by every
+/// series and one column of Y values per series.
+///
+/// Each series also keeps a pyramid of the minimum and maximum of every block of
+/// samples, with each level combining Fanout blocks of the level below. Finding the range
+/// of any span of samples only reads a few entries from each level, so summarizing the
+/// samples under each pixel column costs about the same no matter how many samples are in
+/// view. Appending only adds to the end of each level.
+///
+/// X values must not decrease from one sample to the next.
+class PlotData
+{
+public:
+    static constexpr size_t Fanout = 8;
+
+    struct Range
+    {
+    public:
+        float Min;
+        float Max;
+    };
+
+    /// @brief Summary of the samples that fall within one column of a decimated view.
+    struct Bucket
+    {
+    public:
+        float Min;
+        float Max;
+        float First;
+        float Last;
+        size_t Count;
+    };
+
+    PlotData();
+    ~PlotData();
+
+    /// @brief Adds a series and returns its index. Samples already appended are given a
+    /// value of 0 in the new series.
+    size_t AddSeries();
+    size_t SeriesCount() const;
+
+    /// @brief Appends one sample to every series. Missing values are 0.
+    PlotData& Append(double X, const std::vector<float>& Values);
+
+    /// @brief Appends a batch of samples. Values holds one column per series, each with
+    /// as many values as there are X values.
+    PlotData& Append(const std::vector<double>& X, const std::vector<std::vector<float>>& Values);
+
+    PlotData& Clear();
+
+    size_t Count() const;
+    double X(size_t Index) const;
+    float Value(size_t Series, size_t Index) const;
+    const std::vector<double>& XValues() const;
+    const std::vector<float>& Values(size_t Series) const;
+
+    /// @brief Index of the first sample with an X value not less than the given one.
+    size_t LowerBound(double X) const;
+
+    /// @brief Minimum and maximum of a series over the samples in [Begin, End).
+    Range MinMax(size_t Series, size_t Begin, size_t End) const;
+
+    /// @brief Splits [XMin, XMax) into equal columns and summarizes the samples of a series
+    /// that fall within each one.
+    void Decimate(size_t Series, double XMin, double XMax, size_t Columns, std::vector<Bucket>& Buckets) const;
+
+    /// @brief Number of levels in each series' pyramid.
+    size_t Levels() const;
+
+private:
+    struct Level
+    {
+    public:
+        std::vector<float> Min {};
+        std::vector<float> Max {};
+    };
+
+    struct Series
+    {
+    public:
+        std::vector<float> Values {};
+        std::vector<Level> Levels {};
+    };
+
+    void UpdateLevels(Series& Item);
+
+    std::vector<double> m_X {};
+    std::vector<Series> m_Series {};
+};
+
+}
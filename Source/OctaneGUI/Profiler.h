@@ -28,19 +28,50 @@ SOFTWARE.
 
 #if TOOLS
     #include "Tools/Profiler.h"
+
+    #include <cstdlib>
+    #include <new>
 #endif
 
 namespace OctaneGUI
 {
 
 #if TOOLS
-    #define PROFILER_SAMPLE(Name) Tools::Profiler::Sample Sample(Name, false)
-    #define PROFILER_SAMPLE_GROUP(Name) Tools::Profiler::Sample SampleGroup(Name, true)
-    #define PROFILER_FRAME() Tools::Profiler::Frame Frame(true)
+    #define PROFILER_SAMPLE(Name) OctaneGUI::Tools::Profiler::Sample Sample(Name, false)
+    #define PROFILER_SAMPLE_GROUP(Name) OctaneGUI::Tools::Profiler::Sample SampleGroup(Name, true)
+    #define PROFILER_FRAME() OctaneGUI::Tools::Profiler::Frame Frame(true)
+    #define PROFILER_COUNTER(Type, Value) OctaneGUI::Tools::Profiler::Get().AddCounter(OctaneGUI::Tools::Profiler::Counter::Type, Value)
 #else
     #define PROFILER_SAMPLE(Name)
     #define PROFILER_SAMPLE_GROUP(Name)
     #define PROFILER_FRAME()
+    #define PROFILER_COUNTER(Type, Value)
 #endif
 
 }
+
+// Replaces the global allocation functions so that the profiler can count heap allocations
+// per frame. This is opt-in and should be placed once at global scope within an application's
+// translation unit.
+#if TOOLS
+    #define PROFILER_TRACK_ALLOCATIONS()                                     \
+        void* operator new(std::size_t Size)                                 \
+        {                                                                    \
+            OctaneGUI::Tools::Profiler::TrackAllocation();                   \
+            if (void* Ptr = std::malloc(Size == 0 ? 1 : Size))               \
+            {                                                                \
+                return Ptr;                                                  \
+            }                                                                \
+            throw std::bad_alloc();                                          \
+        }                                                                    \
+        void operator delete(void* Ptr) noexcept                             \
+        {                                                                    \
+            std::free(Ptr);                                                  \
+        }                                                                    \
+        void operator delete(void* Ptr, std::size_t) noexcept                \
+        {                                                                    \
+            std::free(Ptr);                                                  \
+        }
+#else
+    #define PROFILER_TRACK_ALLOCATIONS()
+#endif
@@ -0,0 +1,253 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "TableData.h"
+#include "Assert.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+namespace OctaneGUI
+{
+
+// Number of code points in a UTF-8 string.
+static size_t Characters(const std::string& Value)
+{
+    size_t Result = 0;
+    for (char Ch : Value)
+    {
+        if (((unsigned char)Ch & 0xC0) != 0x80)
+        {
+            Result++;
+        }
+    }
+    return Result;
+}
+
+TableData::TableData()
+{
+}
+
+TableData::~TableData()
+{
+}
+
+size_t TableData::AddColumn(const char* Label, Type ColumnType)
+{
+    Column Item;
+    Item.Label = Label != nullptr ? Label : "";
+    Item.ColumnType = ColumnType;
+
+    switch (ColumnType)
+    {
+    case Type::Text: Item.Texts.resize(m_Rows); break;
+    case Type::Integer: Item.Integers.resize(m_Rows, 0); break;
+    case Type::Number: Item.Numbers.resize(m_Rows, 0.0); break;
+    default: break;
+    }
+
+    m_Columns.push_back(std::move(Item));
+    return m_Columns.size() - 1;
+}
+
+size_t TableData::Columns() const
+{
+    return m_Columns.size();
+}
+
+const std::string& TableData::Label(size_t Column) const
+{
+    return m_Columns[Column].Label;
+}
+
+TableData::Type TableData::ColumnType(size_t Column) const
+{
+    return m_Columns[Column].ColumnType;
+}
+
+TableData& TableData::SetPrecision(size_t Column, int Digits)
+{
+    GetColumn(Column, Type::Number).Precision = Digits;
+    return *this;
+}
+
+int TableData::Precision(size_t Column) const
+{
+    return m_Columns[Column].Precision;
+}
+
+size_t TableData::AddRow()
+{
+    Resize(m_Rows + 1);
+    return m_Rows - 1;
+}
+
+TableData& TableData::Resize(size_t Rows)
+{
+    for (Column& Item : m_Columns)
+    {
+        switch (Item.ColumnType)
+        {
+        case Type::Text: Item.Texts.resize(Rows); break;
+        case Type::Integer: Item.Integers.resize(Rows, 0); break;
+        case Type::Number: Item.Numbers.resize(Rows, 0.0); break;
+        default: break;
+        }
+
+        if (Item.LongestRow >= Rows)
+        {
+            Remeasure(Item, Rows);
+        }
+    }
+
+    m_Rows = Rows;
+    return *this;
+}
+
+TableData& TableData::Clear()
+{
+    return Resize(0);
+}
+
+size_t TableData::Rows() const
+{
+    return m_Rows;
+}
+
+TableData& TableData::SetText(size_t Row, size_t Column, std::string_view Value)
+{
+    TableData::Column& Item = GetColumn(Column, Type::Text);
+    Item.Texts[Row] = Value;
+    Measured(Item, Row);
+    return *this;
+}
+
+TableData& TableData::SetInteger(size_t Row, size_t Column, int64_t Value)
+{
+    TableData::Column& Item = GetColumn(Column, Type::Integer);
+    Item.Integers[Row] = Value;
+    Measured(Item, Row);
+    return *this;
+}
+
+TableData& TableData::SetNumber(size_t Row, size_t Column, double Value)
+{
+    TableData::Column& Item = GetColumn(Column, Type::Number);
+    Item.Numbers[Row] = Value;
+    Measured(Item, Row);
+    return *this;
+}
+
+const std::string& TableData::Text(size_t Row, size_t Column) const
+{
+    return GetColumn(Column, Type::Text).Texts[Row];
+}
+
+int64_t TableData::Integer(size_t Row, size_t Column) const
+{
+    return GetColumn(Column, Type::Integer).Integers[Row];
+}
+
+double TableData::Number(size_t Row, size_t Column) const
+{
+    return GetColumn(Column, Type::Number).Numbers[Row];
+}
+
+std::string TableData::Format(size_t Row, size_t Column) const
+{
+    return Format(m_Columns[Column], Row);
+}
+
+size_t TableData::LongestRow(size_t Column) const
+{
+    return m_Columns[Column].LongestRow;
+}
+
+const TableData::Column& TableData::GetColumn(size_t Index, [[maybe_unused]] Type Expected) const
+{
+    Assert(Index < m_Columns.size(), "Invalid column given %zu! Number of columns: %zu.\n", Index, m_Columns.size());
+    Assert(m_Columns[Index].ColumnType == Expected, "Column %zu does not hold values of the requested type.\n", Index);
+    return m_Columns[Index];
+}
+
+TableData::Column& TableData::GetColumn(size_t Index, [[maybe_unused]] Type Expected)
+{
+    Assert(Index < m_Columns.size(), "Invalid column given %zu! Number of columns: %zu.\n", Index, m_Columns.size());
+    Assert(m_Columns[Index].ColumnType == Expected, "Column %zu does not hold values of the requested type.\n", Index);
+    return m_Columns[Index];
+}
+
+std::string TableData::Format(const Column& Item, size_t Row)
+{
+    char Buffer[64] {};
+    switch (Item.ColumnType)
+    {
+    case Type::Text: return Item.Texts[Row];
+    case Type::Integer: std::snprintf(Buffer, sizeof(Buffer), "%" PRId64, Item.Integers[Row]); break;
+    case Type::Number: std::snprintf(Buffer, sizeof(Buffer), "%.*f", Item.Precision, Item.Numbers[Row]); break;
+    default: break;
+    }
+
+    return Buffer;
+}
+
+size_t TableData::Length(const Column& Item, size_t Row)
+{
+    return Item.ColumnType == Type::Text ? Characters(Item.Texts[Row]) : Characters(Format(Item, Row));
+}
+
+void TableData::Measured(Column& Item, size_t Row)
+{
+    const size_t Count = Length(Item, Row);
+    if (Count > Item.Longest)
+    {
+        Item.Longest = Count;
+        Item.LongestRow = Row;
+    }
+    else if (Row == Item.LongestRow && Count < Item.Longest)
+    {
+        // The longest value was made shorter so another row may now be the longest.
+        Remeasure(Item, m_Rows);
+    }
+}
+
+void TableData::Remeasure(Column& Item, size_t Rows)
+{
+    Item.Longest = 0;
+    Item.LongestRow = 0;
+
+    for (size_t Row = 0; Row < Rows; Row++)
+    {
+        const size_t Count = Length(Item, Row);
+        if (Count > Item.Longest)
+        {
+            Item.Longest = Count;
+            Item.LongestRow = Row;
+        }
+    }
+}
+
+}
@@ -0,0 +1,111 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Rows of values for a Table, stored as one array per column.
+///
+/// Each column holds values of a single type. The row whose formatted value has the most
+/// characters is tracked for each column as values are set, so a column can be fitted to
+/// its contents by measuring a few rows instead of every row.
+class TableData
+{
+public:
+    enum class Type : uint8_t
+    {
+        Text,
+        Integer,
+        Number,
+    };
+
+    TableData();
+    ~TableData();
+
+    size_t AddColumn(const char* Label, Type ColumnType);
+    size_t Columns() const;
+    const std::string& Label(size_t Column) const;
+    Type ColumnType(size_t Column) const;
+
+    /// @brief Sets the number of digits shown after the decimal point of a Number column.
+    TableData& SetPrecision(size_t Column, int Digits);
+    int Precision(size_t Column) const;
+
+    /// @brief Adds a row with empty values and returns its index.
+    size_t AddRow();
+    TableData& Resize(size_t Rows);
+    TableData& Clear();
+    size_t Rows() const;
+
+    TableData& SetText(size_t Row, size_t Column, std::string_view Value);
+    TableData& SetInteger(size_t Row, size_t Column, int64_t Value);
+    TableData& SetNumber(size_t Row, size_t Column, double Value);
+
+    const std::string& Text(size_t Row, size_t Column) const;
+    int64_t Integer(size_t Row, size_t Column) const;
+    double Number(size_t Row, size_t Column) const;
+
+    /// @brief The value as it is displayed.
+    std::string Format(size_t Row, size_t Column) const;
+
+    /// @brief Row with the most characters in the column. All rows are measured again
+    /// only when the longest value is made shorter or removed.
+    size_t LongestRow(size_t Column) const;
+
+private:
+    struct Column
+    {
+    public:
+        std::string Label {};
+        Type ColumnType { Type::Text };
+        int Precision { 2 };
+        std::vector<std::string> Texts {};
+        std::vector<int64_t> Integers {};
+        std::vector<double> Numbers {};
+        size_t Longest { 0 };
+        size_t LongestRow { 0 };
+    };
+
+    const Column& GetColumn(size_t Index, Type Expected) const;
+    Column& GetColumn(size_t Index, Type Expected);
+    static std::string Format(const Column& Item, size_t Row);
+    static size_t Length(const Column& Item, size_t Row);
+    void Measured(Column& Item, size_t Row);
+    void Remeasure(Column& Item, size_t Rows);
+
+    std::vector<Column> m_Columns {};
+    size_t m_Rows { 0 };
+};
+
+}
@@ -0,0 +1,84 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Task.h"
+#include "Timer.h"
+#include "Window.h"
+
+namespace OctaneGUI
+{
+
+Task<void> Tasks::Delay(Window& InWindow, int Milliseconds)
+{
+    Task<void> Result { InWindow.App() };
+
+    // The window holds on to the timer until it fires. The task does not keep the timer
+    // alive, which would keep both alive forever if the window went away first.
+    std::shared_ptr<Timer> Timer_ = InWindow.CreateTimer(Milliseconds, false, [Result]() -> void
+        {
+            Result.Resolve();
+        });
+    InWindow.StartOwnedTimer(Timer_);
+
+    return Result;
+}
+
+Task<std::string> Tasks::LoadContents(Application& App, const std::u32string& Path)
+{
+    const FileSystem& FS = App.FS();
+    return Run(App, [&FS, Path]() -> std::string
+        {
+            return FS.LoadContents(Path);
+        });
+}
+
+Task<LanguageServer::Notification> Tasks::WaitForNotification(Application& App, LanguageServer::Notification::Type Type)
+{
+    Task<LanguageServer::Notification> Result { App };
+
+    const LanguageServer::ListenerID ID = App.LS().RegisterListener([Result, Type](const LanguageServer::Notification& Notification, const std::shared_ptr<LanguageServer::Server>&) -> void
+        {
+            if (Notification.Type_ == Type)
+            {
+                Result.Resolve(Notification);
+            }
+        });
+
+    // The task releases the registration once it is resolved or cancelled, which removes the
+    // listener. Listeners can't be removed while they are being broadcast to, so the removal
+    // is posted.
+    Result.Keep(std::shared_ptr<void>(nullptr, [&App, ID](void*) -> void
+        {
+            App.Post([&App, ID]() -> void
+                {
+                    App.LS().UnregisterListener(ID);
+                });
+        }));
+
+    return Result;
+}
+
+}
@@ -0,0 +1,332 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "Application.h"
+#include "LanguageServer.h"
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class Window;
+
+/// @brief The result of an operation that completes later, possibly on another thread.
+///
+/// Continuations given to Then are always invoked on the UI thread through
+/// Application::Post, no matter which thread resolves the task. A continuation may
+/// return another Task, in which case the Task returned by Then resolves once that one
+/// does, which allows long operations to be written as a chain of steps:
+///
+///     Tasks::LoadContents(App, Path)
+///         .Then([](std::string Contents) { return Tasks::Run(App, [=]() { return Parse(Contents); }); })
+///         .Then([](Document Result) { Editor->SetDocument(Result); });
+///
+/// A task is a shared handle, so copies refer to the same result. T must be copyable.
+/// A Task<void> only signals completion, so it is resolved without a value and its
+/// continuations take no arguments.
+template <typename T>
+class Task
+{
+public:
+    typedef T ValueType;
+
+    /// @brief Type held while the task waits for its continuation. This is std::monostate
+    /// for a Task<void>.
+    typedef std::conditional_t<std::is_void_v<T>, std::monostate, T> StoredType;
+
+    Task()
+    {
+    }
+
+    explicit Task(Application& App)
+        : m_State(std::make_shared<State>(App))
+    {
+    }
+
+    bool IsValid() const
+    {
+        return m_State != nullptr;
+    }
+
+    bool IsResolved() const
+    {
+        std::lock_guard<std::mutex> Lock { m_State->Mutex };
+        return m_State->Resolved;
+    }
+
+    bool IsCancelled() const
+    {
+        std::lock_guard<std::mutex> Lock { m_State->Mutex };
+        return m_State->Cancelled;
+    }
+
+    /// @brief Completes the task with the given value. Only the first call has any effect.
+    /// This is safe to call from any thread.
+    void Resolve(StoredType Value) const
+    {
+        std::function<void(StoredType)> Continuation;
+        std::vector<std::shared_ptr<void>> Keep;
+        {
+            std::lock_guard<std::mutex> Lock { m_State->Mutex };
+            if (m_State->Resolved || m_State->Cancelled)
+            {
+                return;
+            }
+
+            m_State->Resolved = true;
+            Keep = std::move(m_State->Keep);
+            if (!m_State->Continuation)
+            {
+                m_State->Value = std::move(Value);
+                return;
+            }
+
+            Continuation = std::move(m_State->Continuation);
+        }
+
+        Invoke(m_State, std::move(Continuation), std::move(Value));
+    }
+
+    /// @brief Completes a Task<void>.
+    template <typename U = T, typename = std::enable_if_t<std::is_void_v<U>>>
+    void Resolve() const
+    {
+        Resolve(StoredType {});
+    }
+
+    /// @brief Drops the continuation. Continuations that have already been posted are
+    /// skipped as well.
+    void Cancel() const
+    {
+        std::vector<std::shared_ptr<void>> Keep;
+        {
+            std::lock_guard<std::mutex> Lock { m_State->Mutex };
+            m_State->Cancelled = true;
+            m_State->Continuation = nullptr;
+            Keep = std::move(m_State->Keep);
+        }
+    }
+
+    /// @brief Keeps an object alive until the task is resolved or cancelled. Each call adds
+    /// to the objects that are kept.
+    void Keep(std::shared_ptr<void> Object) const
+    {
+        std::lock_guard<std::mutex> Lock { m_State->Mutex };
+        if (!m_State->Resolved && !m_State->Cancelled)
+        {
+            m_State->Keep.push_back(std::move(Object));
+        }
+    }
+
+    /// @brief Sets the function invoked on the UI thread with the result.
+    /// @return A Task for the continuation's result, or nothing if it returns void.
+    template <typename Fn>
+    auto Then(Fn&& Callback) const
+    {
+        typedef typename ResultOf<Fn, T>::Type Result;
+
+        if constexpr (std::is_void_v<Result>)
+        {
+            SetContinuation([Callback = std::forward<Fn>(Callback)](StoredType Value) -> void
+                {
+                    Call(Callback, std::move(Value));
+                });
+        }
+        else if constexpr (IsTask<Result>::value)
+        {
+            typedef typename Result::ValueType U;
+            Task<U> Next { m_State->App };
+            SetContinuation([Next, Callback = std::forward<Fn>(Callback)](StoredType Value) -> void
+                {
+                    Call(Callback, std::move(Value)).Then([Next](auto&&... Inner) -> void
+                        {
+                            Next.Resolve(std::move(Inner)...);
+                        });
+                });
+            return Next;
+        }
+        else
+        {
+            Task<Result> Next { m_State->App };
+            SetContinuation([Next, Callback = std::forward<Fn>(Callback)](StoredType Value) -> void
+                {
+                    Next.Resolve(Call(Callback, std::move(Value)));
+                });
+            return Next;
+        }
+    }
+
+private:
+    template <typename U>
+    struct IsTask : std::false_type
+    {
+    };
+
+    template <typename U>
+    struct IsTask<Task<U>> : std::true_type
+    {
+    };
+
+    // Continuations of a Task<void> take no arguments.
+    template <typename Fn, typename U>
+    struct ResultOf
+    {
+        typedef std::invoke_result_t<Fn, U> Type;
+    };
+
+    template <typename Fn>
+    struct ResultOf<Fn, void>
+    {
+        typedef std::invoke_result_t<Fn> Type;
+    };
+
+    template <typename Fn>
+    static decltype(auto) Call(Fn& Callback, StoredType&& Value)
+    {
+        if constexpr (std::is_void_v<T>)
+        {
+            return Callback();
+        }
+        else
+        {
+            return Callback(std::move(Value));
+        }
+    }
+
+    struct State
+    {
+    public:
+        explicit State(Application& InApp)
+            : App(InApp)
+        {
+        }
+
+        Application& App;
+        std::mutex Mutex {};
+        std::optional<StoredType> Value {};
+        std::function<void(StoredType)> Continuation { nullptr };
+        std::vector<std::shared_ptr<void>> Keep {};
+        bool Resolved { false };
+        bool Cancelled { false };
+    };
+
+    static void Invoke(const std::shared_ptr<State>& State_, std::function<void(StoredType)>&& Continuation, StoredType&& Value)
+    {
+        State_->App.Post([State_, Continuation = std::move(Continuation), Value = std::move(Value)]() -> void
+            {
+                {
+                    std::lock_guard<std::mutex> Lock { State_->Mutex };
+                    if (State_->Cancelled)
+                    {
+                        return;
+                    }
+                }
+
+                Continuation(Value);
+            });
+    }
+
+    void SetContinuation(std::function<void(StoredType)>&& Continuation) const
+    {
+        std::optional<StoredType> Value;
+        {
+            std::lock_guard<std::mutex> Lock { m_State->Mutex };
+            if (m_State->Cancelled)
+            {
+                return;
+            }
+
+            if (!m_State->Resolved)
+            {
+                m_State->Continuation = std::move(Continuation);
+                return;
+            }
+
+            Value = std::move(m_State->Value);
+            m_State->Value.reset();
+        }
+
+        if (Value.has_value())
+        {
+            Invoke(m_State, std::move(Continuation), std::move(*Value));
+        }
+    }
+
+    std::shared_ptr<State> m_State { nullptr };
+};
+
+/// @brief Functions that create tasks for common long running operations.
+class Tasks
+{
+public:
+    /// @brief Invokes Work on one of the application's task workers. Work must not touch
+    /// any controls. Work that returns void results in a Task<void>.
+    template <typename Fn>
+    static Task<std::invoke_result_t<Fn>> Run(Application& App, Fn&& Work)
+    {
+        typedef std::invoke_result_t<Fn> Result;
+
+        Task<Result> Pending { App };
+        App.GetTaskLoader().Run([Pending, Work = std::forward<Fn>(Work)]() -> void
+            {
+                if constexpr (std::is_void_v<Result>)
+                {
+                    Work();
+                    Pending.Resolve();
+                }
+                else
+                {
+                    Pending.Resolve(Work());
+                }
+            },
+            nullptr);
+        return Pending;
+    }
+
+    /// @brief Resolves after the given number of milliseconds using a window timer. The
+    /// timer belongs to the window, so the task is released without resolving if the
+    /// window is destroyed first.
+    static Task<void> Delay(Window& InWindow, int Milliseconds);
+
+    /// @brief Reads a file's contents on a task worker.
+    static Task<std::string> LoadContents(Application& App, const std::u32string& Path);
+
+    /// @brief Resolves with the next language server notification of the given type. The
+    /// listener is removed once the task is resolved or cancelled, so a caller that gives
+    /// up waiting, such as after a timeout, should cancel the task.
+    static Task<LanguageServer::Notification> WaitForNotification(Application& App, LanguageServer::Notification::Type Type);
+};
+
+}
@@ -43,6 +43,7 @@ SOFTWARE.
 
 #include "External/stb/stb_image.h"
 #include "FileSystem.h"
+#include "FrameCapture.h"
 
 #include <cstring>
 
@@ -70,28 +71,43 @@ std::vector<uint8_t> RasterSVG(NSVGimage* Image, float Width, float Height)
     return Result;
 }
 
+std::vector<uint8_t> DecodePNG(const char* Path, uint32_t& Width, uint32_t& Height)
+{
+    std::vector<uint8_t> Result;
+
+    int W, H, Channels;
+    uint8_t* Data = stbi_load(Path, &W, &H, &Channels, STBI_rgb_alpha);
+    if (Data != nullptr)
+    {
+        Result.resize((size_t)W * H * 4);
+        std::memcpy(&Result[0], Data, Result.size());
+        stbi_image_free(Data);
+        Width = (uint32_t)W;
+        Height = (uint32_t)H;
+    }
+
+    return Result;
+}
+
 Texture::OnLoadSignature Texture::s_OnLoad = nullptr;
+Texture::OnUnloadSignature Texture::s_OnUnload = nullptr;
 
 void Texture::SetOnLoad(OnLoadSignature Fn)
 {
     s_OnLoad = Fn;
 }
 
-std::shared_ptr<Texture> Texture::Load(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
+void Texture::SetOnUnload(OnUnloadSignature Fn)
 {
-    std::shared_ptr<Texture> Result;
+    s_OnUnload = Fn;
+}
 
-    if (s_OnLoad)
+std::shared_ptr<Texture> Texture::Load(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
+{
+    std::shared_ptr<Texture> Result = std::make_shared<Texture>();
+    if (!Result->Upload(Data, Width, Height))
     {
-        uint32_t ID = s_OnLoad(Data, Width, Height);
-
-        if (ID > 0)
-        {
-            Result = std::make_shared<Texture>();
-            Result->m_ID = ID;
-            Result->m_Size.X = (float)Width;
-            Result->m_Size.Y = (float)Height;
-        }
+        return nullptr;
     }
 
     return Result;
@@ -99,16 +115,18 @@ std::shared_ptr<Texture> Texture::Load(const std::vector<uint8_t>& Data, uint32_
 
 std::shared_ptr<Texture> Texture::Load(const char* Path)
 {
-    std::shared_ptr<Texture> Result { nullptr };
-
-    const std::string Extension = FileSystem::Extension(Path);
-    if (Extension == ".png")
+    uint32_t Width = 0;
+    uint32_t Height = 0;
+    const std::vector<uint8_t> Data = Decode(Path, Width, Height);
+    if (Data.empty())
     {
-        Result = LoadPNG(Path);
+        return nullptr;
     }
-    else if (Extension == ".svg")
+
+    std::shared_ptr<Texture> Result = Load(Data, Width, Height);
+    if (Result)
     {
-        Result = LoadSVG(Path);
+        Result->m_Path = Path;
     }
 
     return Result;
@@ -118,17 +136,16 @@ std::shared_ptr<Texture> Texture::LoadPNG(const char* Path)
 {
     std::shared_ptr<Texture> Result;
 
-    int Width, Height, Channels;
-    uint8_t* Data = stbi_load(Path, &Width, &Height, &Channels, 0);
-    if (Data != nullptr)
+    uint32_t Width = 0;
+    uint32_t Height = 0;
+    const std::vector<uint8_t> Data = DecodePNG(Path, Width, Height);
+    if (!Data.empty())
     {
-        std::vector<uint8_t> Buffer;
-        Buffer.resize(Width * Height * Channels);
-        std::memcpy(&Buffer[0], Data, Buffer.size());
-        stbi_image_free(Data);
-
-        Result = Load(Buffer, Width, Height);
-        Result->m_Path = Path;
+        Result = Load(Data, Width, Height);
+        if (Result)
+        {
+            Result->m_Path = Path;
+        }
     }
 
     return Result;
@@ -177,21 +194,94 @@ std::vector<uint8_t> Texture::LoadSVGData(const char* Path, uint32_t Width, uint
     return Result;
 }
 
+std::vector<uint8_t> Texture::Decode(const char* Path, uint32_t& Width, uint32_t& Height)
+{
+    const std::string Extension = FileSystem::Extension(Path);
+    if (Extension == ".png")
+    {
+        return DecodePNG(Path, Width, Height);
+    }
+    else if (Extension == ".svg")
+    {
+        NSVGimage* Image = nsvgParseFromFile(Path, "px", 96);
+        if (Image != nullptr)
+        {
+            Width = (uint32_t)Image->width;
+            Height = (uint32_t)Image->height;
+            return RasterSVG(Image, Image->width, Image->height);
+        }
+    }
+
+    return {};
+}
+
 Texture::Texture()
 {
 }
 
 Texture::~Texture()
 {
+    if (m_ID != 0)
+    {
+        FrameCapture::OnReleased(m_ID);
+
+        if (s_OnUnload)
+        {
+            s_OnUnload(m_ID);
+        }
+    }
 }
 
 bool Texture::IsValid() const
 {
+    if (m_Atlas)
+    {
+        return m_Atlas->IsValid();
+    }
+
     return m_ID != 0;
 }
 
+bool Texture::Upload(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
+{
+    if (!s_OnLoad)
+    {
+        return false;
+    }
+
+    const uint32_t ID = s_OnLoad(Data, Width, Height);
+    if (ID == 0)
+    {
+        return false;
+    }
+
+    FrameCapture::OnUploaded(ID, Data, Width, Height);
+
+    // Release the previous upload only once the new one has succeeded.
+    if (m_ID != 0)
+    {
+        FrameCapture::OnReleased(m_ID);
+
+        if (s_OnUnload)
+        {
+            s_OnUnload(m_ID);
+        }
+    }
+
+    m_ID = ID;
+    m_Bytes = (size_t)Width * Height * 4;
+    m_Size.X = (float)Width;
+    m_Size.Y = (float)Height;
+    return true;
+}
+
 uint32_t Texture::GetID() const
 {
+    if (m_Atlas)
+    {
+        return m_Atlas->GetID();
+    }
+
     return m_ID;
 }
 
@@ -205,4 +295,28 @@ const char* Texture::Path() const
     return m_Path.c_str();
 }
 
+size_t Texture::Bytes() const
+{
+    return m_Bytes;
+}
+
+std::shared_ptr<Texture> Texture::Atlas() const
+{
+    return m_Atlas;
+}
+
+Rect Texture::MapTexCoords(const Rect& TexCoords) const
+{
+    if (!m_Atlas)
+    {
+        return TexCoords;
+    }
+
+    const Vector2 Size = m_Region.GetSize();
+    return {
+        m_Region.Min + TexCoords.Min * Size,
+        m_Region.Min + TexCoords.Max * Size
+    };
+}
+
 }
@@ -26,7 +26,7 @@ SOFTWARE.
 
 #pragma once
 
-#include "Vector2.h"
+#include "Rect.h"
 
 #include <algorithm>
 #include <cstdint>
@@ -42,8 +42,13 @@ class Texture
 {
 public:
     typedef std::function<uint32_t(const std::vector<uint8_t>&, uint32_t, uint32_t)> OnLoadSignature;
+    typedef std::function<void(uint32_t)> OnUnloadSignature;
 
     static void SetOnLoad(OnLoadSignature Fn);
+
+    /// @brief Sets the function that releases a texture ID. It is called when the last
+    /// reference to an uploaded texture goes away or when the texture is uploaded again.
+    static void SetOnUnload(OnUnloadSignature Fn);
     static std::shared_ptr<Texture> Load(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height);
     static std::shared_ptr<Texture> Load(const char* Path);
     static std::shared_ptr<Texture> LoadPNG(const char* Path);
@@ -51,6 +56,10 @@ public:
     static std::shared_ptr<Texture> LoadSVG(const char* Path, uint32_t Width, uint32_t Height);
     static std::vector<uint8_t> LoadSVGData(const char* Path, uint32_t Width, uint32_t Height);
 
+    /// @brief Decodes a PNG or SVG file into RGBA pixels without uploading them.
+    /// Unlike the Load functions, this is safe to call from any thread.
+    static std::vector<uint8_t> Decode(const char* Path, uint32_t& Width, uint32_t& Height);
+
     Texture();
     ~Texture();
 
@@ -59,12 +68,34 @@ public:
     Vector2 GetSize() const;
     const char* Path() const;
 
+    /// @brief The number of bytes uploaded for this texture. Textures packed into an
+    /// atlas report 0, as the memory belongs to their page.
+    size_t Bytes() const;
+
+    /// @brief The page this texture was packed into by a TextureAtlas, if any. The ID
+    /// of a packed texture is the ID of its page.
+    std::shared_ptr<Texture> Atlas() const;
+
+    /// @brief Maps normalized coordinates within this texture to coordinates within
+    /// the texture bound by its ID.
+    Rect MapTexCoords(const Rect& TexCoords) const;
+
 private:
+    friend class Icons;
+    friend class TextureAtlas;
+    friend class TextureCache;
+
     static OnLoadSignature s_OnLoad;
+    static OnUnloadSignature s_OnUnload;
+
+    bool Upload(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height);
 
     uint32_t m_ID { 0 };
+    size_t m_Bytes { 0 };
     Vector2 m_Size {};
     std::string m_Path {};
+    std::shared_ptr<Texture> m_Atlas { nullptr };
+    Rect m_Region {};
 };
 
 }
@@ -0,0 +1,289 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "TextureAtlas.h"
+#include "Texture.h"
+
+#include <cstring>
+#include <limits>
+
+namespace OctaneGUI
+{
+
+// Border around each image filled with a copy of its edge pixels.
+static constexpr uint32_t Border = 1;
+
+TextureAtlas::TextureAtlas()
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+}
+
+TextureAtlas& TextureAtlas::SetPageSize(uint32_t PageSize)
+{
+    // Existing pages keep their layout, so the size can only change before the first one.
+    if (m_Pages.empty())
+    {
+        m_PageSize = PageSize;
+    }
+
+    return *this;
+}
+
+uint32_t TextureAtlas::PageSize() const
+{
+    return m_PageSize;
+}
+
+bool TextureAtlas::Add(Texture& Target, const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
+{
+    const uint32_t PackedW = Width + Border * 2;
+    const uint32_t PackedH = Height + Border * 2;
+    if (Width == 0 || Height == 0 || PackedW > m_PageSize || PackedH > m_PageSize || Data.size() < (size_t)Width * Height * 4)
+    {
+        return false;
+    }
+
+    Page* Destination = nullptr;
+    uint32_t X = 0;
+    uint32_t Y = 0;
+    for (Page& Item : m_Pages)
+    {
+        if (Pack(Item, PackedW, PackedH, m_PageSize, X, Y))
+        {
+            Destination = &Item;
+            break;
+        }
+    }
+
+    if (Destination == nullptr)
+    {
+        Destination = &NewPage();
+        Pack(*Destination, PackedW, PackedH, m_PageSize, X, Y);
+    }
+
+    // Copy each row with its first and last pixel repeated into the border, then
+    // repeat the first and last rows.
+    const size_t Stride = (size_t)m_PageSize * 4;
+    for (uint32_t Row = 0; Row < PackedH; Row++)
+    {
+        const uint32_t SourceRow = Row == 0 ? 0 : std::min<uint32_t>(Row - Border, Height - 1);
+        const uint8_t* Source = &Data[(size_t)SourceRow * Width * 4];
+        uint8_t* Dest = &Destination->Pixels[(Y + Row) * Stride + (size_t)X * 4];
+
+        memcpy(Dest, Source, 4);
+        memcpy(Dest + Border * 4, Source, (size_t)Width * 4);
+        memcpy(Dest + (Border + Width) * 4, Source + (size_t)(Width - 1) * 4, 4);
+    }
+
+    Destination->Dirty = true;
+    Destination->Regions++;
+
+    const float InvSize = 1.0f / (float)m_PageSize;
+    Target.m_Atlas = Destination->Texture_;
+    Target.m_Size = { (float)Width, (float)Height };
+    Target.m_Region = {
+        (float)(X + Border) * InvSize,
+        (float)(Y + Border) * InvSize,
+        (float)(X + Border + Width) * InvSize,
+        (float)(Y + Border + Height) * InvSize
+    };
+
+    return true;
+}
+
+bool TextureAtlas::Remove(const Texture& Target)
+{
+    if (!Target.m_Atlas)
+    {
+        return false;
+    }
+
+    for (std::vector<Page>::iterator It = m_Pages.begin(); It != m_Pages.end(); ++It)
+    {
+        if (It->Texture_ != Target.m_Atlas)
+        {
+            continue;
+        }
+
+        It->Regions--;
+        if (It->Regions == 0)
+        {
+            // Textures removed while still in use keep drawing from the page after it is
+            // released, so its latest pixels must have been uploaded.
+            if (It->Dirty && It->Texture_.use_count() > 1)
+            {
+                It->Texture_->Upload(It->Pixels, m_PageSize, m_PageSize);
+            }
+
+            m_Pages.erase(It);
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+void TextureAtlas::Flush()
+{
+    for (Page& Item : m_Pages)
+    {
+        if (Item.Dirty)
+        {
+            Item.Texture_->Upload(Item.Pixels, m_PageSize, m_PageSize);
+            Item.Dirty = false;
+        }
+    }
+}
+
+size_t TextureAtlas::Pages() const
+{
+    return m_Pages.size();
+}
+
+size_t TextureAtlas::Bytes() const
+{
+    return m_Pages.size() * m_PageSize * m_PageSize * 4;
+}
+
+bool TextureAtlas::Fit(const Page& Target, size_t Index, uint32_t Width, uint32_t Height, uint32_t PageSize, uint32_t& Y)
+{
+    const uint32_t X = Target.Skyline[Index].X;
+    if (X + Width > PageSize)
+    {
+        return false;
+    }
+
+    // The image rests on the highest segment it spans.
+    uint32_t Remaining = Width;
+    Y = 0;
+    for (size_t I = Index; Remaining > 0; I++)
+    {
+        if (I >= Target.Skyline.size())
+        {
+            return false;
+        }
+
+        const Node& Segment = Target.Skyline[I];
+        Y = std::max<uint32_t>(Y, Segment.Y);
+        if (Y + Height > PageSize)
+        {
+            return false;
+        }
+
+        Remaining -= std::min<uint32_t>(Remaining, Segment.Width);
+    }
+
+    return true;
+}
+
+bool TextureAtlas::Pack(Page& Target, uint32_t Width, uint32_t Height, uint32_t PageSize, uint32_t& X, uint32_t& Y)
+{
+    // Bottom-left heuristic: pick the position with the lowest resulting top edge, then
+    // the narrowest segment to keep wide gaps available for wide images.
+    size_t Best = std::numeric_limits<size_t>::max();
+    uint32_t BestBottom = std::numeric_limits<uint32_t>::max();
+    uint32_t BestWidth = std::numeric_limits<uint32_t>::max();
+    for (size_t I = 0; I < Target.Skyline.size(); I++)
+    {
+        uint32_t FitY = 0;
+        if (!Fit(Target, I, Width, Height, PageSize, FitY))
+        {
+            continue;
+        }
+
+        const uint32_t Bottom = FitY + Height;
+        if (Bottom < BestBottom || (Bottom == BestBottom && Target.Skyline[I].Width < BestWidth))
+        {
+            Best = I;
+            BestBottom = Bottom;
+            BestWidth = Target.Skyline[I].Width;
+            Y = FitY;
+        }
+    }
+
+    if (Best == std::numeric_limits<size_t>::max())
+    {
+        return false;
+    }
+
+    X = Target.Skyline[Best].X;
+    Target.Skyline.insert(Target.Skyline.begin() + Best, { X, Y + Height, Width });
+
+    // Shrink or remove the segments now covered by the new one.
+    for (size_t I = Best + 1; I < Target.Skyline.size();)
+    {
+        Node& Previous = Target.Skyline[I - 1];
+        Node& Current = Target.Skyline[I];
+        const uint32_t PreviousEnd = Previous.X + Previous.Width;
+        if (Current.X >= PreviousEnd)
+        {
+            break;
+        }
+
+        const uint32_t Overlap = PreviousEnd - Current.X;
+        if (Overlap >= Current.Width)
+        {
+            Target.Skyline.erase(Target.Skyline.begin() + I);
+            continue;
+        }
+
+        Current.X += Overlap;
+        Current.Width -= Overlap;
+        break;
+    }
+
+    // Merge neighbouring segments at the same height.
+    for (size_t I = 0; I + 1 < Target.Skyline.size();)
+    {
+        if (Target.Skyline[I].Y == Target.Skyline[I + 1].Y)
+        {
+            Target.Skyline[I].Width += Target.Skyline[I + 1].Width;
+            Target.Skyline.erase(Target.Skyline.begin() + I + 1);
+        }
+        else
+        {
+            I++;
+        }
+    }
+
+    return true;
+}
+
+TextureAtlas::Page& TextureAtlas::NewPage()
+{
+    m_Pages.push_back({});
+    Page& Result = m_Pages.back();
+    Result.Texture_ = std::make_shared<Texture>();
+    Result.Pixels.resize((size_t)m_PageSize * m_PageSize * 4);
+    Result.Skyline.push_back({ 0, 0, m_PageSize });
+    return Result;
+}
+
+}
@@ -0,0 +1,103 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class Texture;
+
+/// @brief Packs small images into shared texture pages.
+///
+/// Images are placed with a skyline packer and surrounded by a one pixel border copied
+/// from their edges so that filtering does not bleed between neighbours. A packed
+/// image is returned as a regular Texture that refers to a region of its page, which
+/// lets draws of different images share a draw command. Pages are uploaded in Flush,
+/// so any number of images can be added before a page is sent to the renderer.
+///
+/// Regions are not reused individually. Instead, a page is released once every image
+/// packed into it has been removed.
+class TextureAtlas
+{
+public:
+    TextureAtlas();
+    ~TextureAtlas();
+
+    /// @brief Sets the width and height of the pages. Ignored once a page has been created.
+    TextureAtlas& SetPageSize(uint32_t PageSize);
+    uint32_t PageSize() const;
+
+    /// @brief Packs the pixels into a page and points the target texture at the region.
+    /// @return False if the image does not fit into an empty page.
+    bool Add(Texture& Target, const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height);
+
+    /// @brief Removes an image added with Add. Its page is released once no other images
+    /// are packed into it, though textures still referring to the page keep it alive.
+    /// @return False if the texture was not packed into one of the pages.
+    bool Remove(const Texture& Target);
+
+    /// @brief Uploads every page that has changed since the last flush.
+    void Flush();
+
+    size_t Pages() const;
+
+    /// @brief The number of bytes held by all pages.
+    size_t Bytes() const;
+
+private:
+    struct Node
+    {
+    public:
+        uint32_t X { 0 };
+        uint32_t Y { 0 };
+        uint32_t Width { 0 };
+    };
+
+    struct Page
+    {
+    public:
+        std::shared_ptr<Texture> Texture_ { nullptr };
+        std::vector<uint8_t> Pixels {};
+        std::vector<Node> Skyline {};
+        size_t Regions { 0 };
+        bool Dirty { false };
+    };
+
+    static bool Fit(const Page& Target, size_t Index, uint32_t Width, uint32_t Height, uint32_t PageSize, uint32_t& Y);
+    static bool Pack(Page& Target, uint32_t Width, uint32_t Height, uint32_t PageSize, uint32_t& X, uint32_t& Y);
+
+    Page& NewPage();
+
+    uint32_t m_PageSize { 1024 };
+    std::vector<Page> m_Pages {};
+};
+
+}
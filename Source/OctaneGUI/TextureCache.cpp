@@ -25,9 +25,11 @@ SOFTWARE.
 */
 
 #include "TextureCache.h"
+#include "AssetLoader.h"
 #include "Texture.h"
 
 #include <cstring>
+#include <iterator>
 
 namespace OctaneGUI
 {
@@ -39,32 +41,163 @@ TextureCache::TextureCache()
 TextureCache::~TextureCache()
 {
     m_Cache.clear();
+    m_Used.clear();
+    m_UsedIndex.clear();
+}
+
+TextureCache& TextureCache::SetLoader(AssetLoader* Loader)
+{
+    m_Loader = Loader;
+    return *this;
+}
+
+TextureCache& TextureCache::SetAtlasMaxSize(uint32_t MaxSize)
+{
+    m_AtlasMaxSize = MaxSize;
+    return *this;
+}
+
+uint32_t TextureCache::AtlasMaxSize() const
+{
+    return m_AtlasMaxSize;
+}
+
+const TextureAtlas& TextureCache::Atlas() const
+{
+    return m_Atlas;
+}
+
+TextureCache& TextureCache::SetBudget(size_t Budget)
+{
+    m_Budget = Budget;
+    return *this;
+}
+
+size_t TextureCache::Budget() const
+{
+    return m_Budget;
+}
+
+TextureCache::Stats TextureCache::GetStats() const
+{
+    Stats Result = m_Stats;
+    Result.AtlasBytes = m_Atlas.Bytes();
+    Result.Textures = m_Cache.size();
+    return Result;
 }
 
 std::shared_ptr<Texture> TextureCache::Load(const char* Path)
 {
-    if (m_Cache.find(Path) == m_Cache.end() && std::strlen(Path) > 0)
+    return Load(Path, nullptr);
+}
+
+std::shared_ptr<Texture> TextureCache::Load(const char* Path, OnTextureSignature&& OnLoaded)
+{
+    if (std::strlen(Path) == 0)
     {
-        std::shared_ptr<Texture> Result = Texture::Load(Path);
+        return nullptr;
+    }
 
-        if (Result && Result->IsValid())
+    const CacheMap::const_iterator It = m_Cache.find(Path);
+    if (It != m_Cache.end())
+    {
+        m_Stats.Hits++;
+        Touch(It->first);
+
+        if (IsLoading(Path))
+        {
+            if (OnLoaded)
+            {
+                m_Loading[Path].push_back(std::move(OnLoaded));
+            }
+        }
+        else if (OnLoaded)
         {
-            m_Cache[Path] = Result;
+            OnLoaded(It->second);
         }
+
+        return It->second;
+    }
+
+    m_Stats.Misses++;
+
+    if (m_Loader == nullptr)
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        const std::vector<uint8_t> Data = Texture::Decode(Path, Width, Height);
+
+        std::shared_ptr<Texture> Result = std::make_shared<Texture>();
+        Result->m_Path = Path;
+        if (!Data.empty() && Assign(*Result, Data, Width, Height))
+        {
+            Insert(Path, Result);
+            Flush();
+        }
+        else
+        {
+            Result = nullptr;
+        }
+
+        if (OnLoaded)
+        {
+            OnLoaded(Result);
+        }
+
+        return Result;
     }
 
-    return m_Cache[Path];
+    // Hand out a placeholder that is filled in once the pixels are uploaded.
+    std::shared_ptr<Texture> Result = std::make_shared<Texture>();
+    Result->m_Path = Path;
+    Insert(Path, Result);
+
+    std::vector<OnTextureSignature>& Callbacks = m_Loading[Path];
+    if (OnLoaded)
+    {
+        Callbacks.push_back(std::move(OnLoaded));
+    }
+
+    struct Decoded
+    {
+        std::string Path {};
+        std::vector<uint8_t> Data {};
+        uint32_t Width { 0 };
+        uint32_t Height { 0 };
+    };
+
+    std::shared_ptr<Decoded> Item = std::make_shared<Decoded>();
+    Item->Path = Path;
+    m_Loader->Run([Item]() -> void
+        {
+            Item->Data = Texture::Decode(Item->Path.c_str(), Item->Width, Item->Height);
+        },
+        [this, Item]() -> void
+        {
+            OnDecoded(Item->Path, Item->Data, Item->Width, Item->Height);
+        });
+
+    return Result;
 }
 
 std::shared_ptr<Texture> TextureCache::LoadSVG(const char* Path, uint32_t Width, uint32_t Height)
 {
-    std::shared_ptr<Texture>& Result = m_Cache[Path];
-    if (!Result)
+    const CacheMap::const_iterator It = m_Cache.find(Path);
+    if (It != m_Cache.end())
     {
-        Result = Texture::LoadSVG(Path, Width, Height);
+        m_Stats.Hits++;
+        Touch(It->first);
+        return It->second;
     }
 
-    return m_Cache[Path];
+    m_Stats.Misses++;
+    std::shared_ptr<Texture> Result = Texture::LoadSVG(Path, Width, Height);
+    if (Result)
+    {
+        Insert(Path, Result);
+    }
+
+    return Result;
 }
 
 const TextureCache::CacheMap& TextureCache::Cache() const
@@ -72,4 +205,123 @@ const TextureCache::CacheMap& TextureCache::Cache() const
     return m_Cache;
 }
 
+bool TextureCache::IsLoading(const char* Path) const
+{
+    return m_Loading.find(Path) != m_Loading.end();
+}
+
+void TextureCache::Flush()
+{
+    m_Atlas.Flush();
+    Trim();
+}
+
+void TextureCache::Trim()
+{
+    if (m_Budget == 0)
+    {
+        return;
+    }
+
+    // Textures packed into the atlas free their memory once every other texture on
+    // their page has been released as well.
+    std::list<std::string>::iterator It = m_Used.end();
+    while (m_Stats.Bytes + m_Atlas.Bytes() > m_Budget && It != m_Used.begin())
+    {
+        --It;
+
+        // Releasing a texture that is still referenced would not free any memory. Textures
+        // that are loading have no memory yet.
+        const std::shared_ptr<Texture>& Item = m_Cache[*It];
+        if (Item.use_count() > 1 || IsLoading(It->c_str()))
+        {
+            continue;
+        }
+
+        const std::string Path = *It;
+        It = std::next(It);
+        Erase(Path);
+        m_Stats.Evictions++;
+    }
+}
+
+void TextureCache::OnDecoded(const std::string& Path, const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
+{
+    const std::unordered_map<std::string, std::vector<OnTextureSignature>>::iterator It = m_Loading.find(Path);
+    if (It == m_Loading.end())
+    {
+        return;
+    }
+
+    const std::vector<OnTextureSignature> Callbacks = std::move(It->second);
+    m_Loading.erase(It);
+
+    std::shared_ptr<Texture> Result = m_Cache[Path];
+    if (Result && !Data.empty() && Assign(*Result, Data, Width, Height))
+    {
+        m_Stats.Bytes += Result->Bytes();
+    }
+    else
+    {
+        Erase(Path);
+        Result = nullptr;
+    }
+
+    for (const OnTextureSignature& Callback : Callbacks)
+    {
+        Callback(Result);
+    }
+}
+
+bool TextureCache::Assign(Texture& Target, const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
+{
+    if (Width <= m_AtlasMaxSize && Height <= m_AtlasMaxSize && m_Atlas.Add(Target, Data, Width, Height))
+    {
+        return true;
+    }
+
+    return Target.Upload(Data, Width, Height);
+}
+
+void TextureCache::Insert(const std::string& Path, const std::shared_ptr<Texture>& Item)
+{
+    Erase(Path);
+
+    m_Cache[Path] = Item;
+    m_Used.push_front(Path);
+    m_UsedIndex[Path] = m_Used.begin();
+    m_Stats.Bytes += Item->Bytes();
+}
+
+void TextureCache::Erase(const std::string& Path)
+{
+    const CacheMap::iterator It = m_Cache.find(Path);
+    if (It != m_Cache.end())
+    {
+        if (It->second)
+        {
+            m_Stats.Bytes -= It->second->Bytes();
+            m_Atlas.Remove(*It->second);
+        }
+
+        m_Cache.erase(It);
+    }
+
+    const std::unordered_map<std::string, std::list<std::string>::iterator>::iterator Used = m_UsedIndex.find(Path);
+    if (Used != m_UsedIndex.end())
+    {
+        m_Used.erase(Used->second);
+        m_UsedIndex.erase(Used);
+    }
+}
+
+void TextureCache::Touch(const std::string& Path)
+{
+    const std::unordered_map<std::string, std::list<std::string>::iterator>::iterator It = m_UsedIndex.find(Path);
+    if (It != m_UsedIndex.end())
+    {
+        m_Used.splice(m_Used.begin(), m_Used, It->second);
+    }
+}
+
 }
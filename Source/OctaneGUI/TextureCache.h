@@ -26,29 +26,103 @@ SOFTWARE.
 
 #pragma once
 
+#include "TextureAtlas.h"
+
+#include <functional>
+#include <list>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace OctaneGUI
 {
 
+class AssetLoader;
 class Texture;
 
+/// @brief Shares textures loaded from files.
+///
+/// When an AssetLoader is set, files are decoded on its workers. Load then returns a
+/// placeholder texture that is not valid until the pixels have been uploaded on the
+/// UI thread. Callers that need to react to the upload can pass a callback, which
+/// receives the texture or nullptr if the file could not be loaded.
+///
+/// Images that are no larger than the atlas size in either dimension are packed into
+/// shared atlas pages. Pages are uploaded when the cache is flushed, which the
+/// application does every update.
+///
+/// The cache keeps its textures alive after the last control using them goes away so
+/// they can be reused. Once the textures and atlas pages it holds exceed the budget, the
+/// least recently used textures that nothing else references are released. An atlas page
+/// is released along with the last texture packed into it.
 class TextureCache
 {
 public:
     typedef std::unordered_map<std::string, std::shared_ptr<Texture>> CacheMap;
+    typedef std::function<void(const std::shared_ptr<Texture>&)> OnTextureSignature;
+
+    struct Stats
+    {
+    public:
+        size_t Bytes { 0 };
+        size_t AtlasBytes { 0 };
+        size_t Textures { 0 };
+        uint64_t Hits { 0 };
+        uint64_t Misses { 0 };
+        uint64_t Evictions { 0 };
+    };
 
     TextureCache();
     ~TextureCache();
 
+    TextureCache& SetLoader(AssetLoader* Loader);
+
+    /// @brief Sets the largest width and height of images packed into the atlas. A size
+    /// of 0 gives every image its own texture.
+    TextureCache& SetAtlasMaxSize(uint32_t MaxSize);
+    uint32_t AtlasMaxSize() const;
+    const TextureAtlas& Atlas() const;
+
+    /// @brief Sets the number of bytes of texture memory the cache may hold on to. A
+    /// budget of 0 never releases textures.
+    TextureCache& SetBudget(size_t Budget);
+    size_t Budget() const;
+    Stats GetStats() const;
+
     std::shared_ptr<Texture> Load(const char* Path);
+    std::shared_ptr<Texture> Load(const char* Path, OnTextureSignature&& OnLoaded);
     std::shared_ptr<Texture> LoadSVG(const char* Path, uint32_t Width, uint32_t Height);
     const CacheMap& Cache() const;
+    bool IsLoading(const char* Path) const;
+
+    /// @brief Uploads any atlas pages that changed since the last flush and releases
+    /// textures until the cache is within its budget.
+    void Flush();
+
+    /// @brief Releases unreferenced textures, least recently used first, until the cache
+    /// is within its budget. Textures still in use are kept even if over budget.
+    void Trim();
 
 private:
+    void OnDecoded(const std::string& Path, const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height);
+    bool Assign(Texture& Target, const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height);
+    void Insert(const std::string& Path, const std::shared_ptr<Texture>& Item);
+    void Erase(const std::string& Path);
+    void Touch(const std::string& Path);
+
     CacheMap m_Cache;
+
+    // Most recently used paths are at the front.
+    std::list<std::string> m_Used {};
+    std::unordered_map<std::string, std::list<std::string>::iterator> m_UsedIndex {};
+    size_t m_Budget { 128 * 1024 * 1024 };
+    Stats m_Stats {};
+
+    AssetLoader* m_Loader { nullptr };
+    TextureAtlas m_Atlas {};
+    uint32_t m_AtlasMaxSize { 64 };
+    std::unordered_map<std::string, std::vector<OnTextureSignature>> m_Loading {};
 };
 
 }
@@ -0,0 +1,238 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace OctaneGUI
+{
+
+ThreadPool::ThreadPool()
+{
+    // The calling thread works on each batch, so it counts as one of the cores. Jobs are
+    // still given a worker when this is 0, see Start.
+    const unsigned int Cores = std::thread::hardware_concurrency();
+    m_Threads = std::min<unsigned int>(Cores > 1 ? Cores - 1 : 0, 7);
+}
+
+ThreadPool::~ThreadPool()
+{
+    Stop();
+}
+
+ThreadPool& ThreadPool::SetThreads(unsigned int Count)
+{
+    if (m_Threads != Count)
+    {
+        Stop();
+
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        m_Threads = Count;
+    }
+
+    return *this;
+}
+
+unsigned int ThreadPool::Threads() const
+{
+    return m_Threads;
+}
+
+void ThreadPool::Run(const std::vector<OnEmptySignature>& Tasks)
+{
+    bool Serial = m_Threads == 0 || Tasks.size() < 2;
+    if (!Serial)
+    {
+        // Jobs may run batches of their own, so the batch is claimed under the same lock
+        // that checks for one already running.
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        Serial = m_Tasks != nullptr;
+        if (!Serial)
+        {
+            m_Tasks = &Tasks;
+            m_Next = 0;
+            m_Remaining = Tasks.size();
+        }
+    }
+
+    if (Serial)
+    {
+        for (const OnEmptySignature& Task : Tasks)
+        {
+            Task();
+        }
+        return;
+    }
+
+    Start();
+
+    m_WorkReady.notify_all();
+    RunTasks();
+
+    std::unique_lock<std::mutex> Lock { m_Mutex };
+    m_WorkDone.wait(Lock, [this]() -> bool
+        {
+            return m_Remaining == 0;
+        });
+    m_Tasks = nullptr;
+}
+
+void ThreadPool::Submit(OnEmptySignature&& Job)
+{
+    {
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        m_Jobs.push_back(std::move(Job));
+    }
+
+    Start();
+    m_WorkReady.notify_one();
+}
+
+void ThreadPool::Start()
+{
+    // Jobs may be submitted from any thread, so the workers are only created under the lock.
+    std::lock_guard<std::mutex> Lock { m_Mutex };
+    if (!m_Workers.empty() || m_Stopping)
+    {
+        return;
+    }
+
+    // Background jobs always get a worker, even when there are no cores to spare for batches.
+    const unsigned int Count = std::max<unsigned int>(m_Threads, 1);
+    for (unsigned int I = 0; I < Count; I++)
+    {
+        m_Workers.emplace_back(&ThreadPool::Worker, this);
+    }
+}
+
+void ThreadPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        m_Stopping = true;
+    }
+
+    // Workers finish the queued jobs before exiting. Stop is only called from the thread
+    // that owns the pool, so the list of workers is not changed while they are joined.
+    m_WorkReady.notify_all();
+    for (std::thread& Item : m_Workers)
+    {
+        Item.join();
+    }
+
+    // Jobs submitted by the last running jobs are invoked here instead. The pool is still
+    // stopping while they run, so any jobs they submit are queued rather than starting new
+    // workers and are picked up by the next pass.
+    std::deque<OnEmptySignature> Jobs;
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> Lock { m_Mutex };
+            m_Workers.clear();
+            if (m_Jobs.empty())
+            {
+                m_Stopping = false;
+                break;
+            }
+            Jobs.swap(m_Jobs);
+        }
+
+        for (const OnEmptySignature& Job : Jobs)
+        {
+            Job();
+        }
+        Jobs.clear();
+    }
+}
+
+void ThreadPool::Worker()
+{
+    while (true)
+    {
+        OnEmptySignature Job { nullptr };
+        {
+            std::unique_lock<std::mutex> Lock { m_Mutex };
+            m_WorkReady.wait(Lock, [this]() -> bool
+                {
+                    return m_Stopping || HasTask() || !m_Jobs.empty();
+                });
+
+            if (!HasTask())
+            {
+                if (m_Jobs.empty())
+                {
+                    return;
+                }
+
+                Job = std::move(m_Jobs.front());
+                m_Jobs.pop_front();
+            }
+        }
+
+        if (Job)
+        {
+            Job();
+        }
+        else
+        {
+            RunTasks();
+        }
+    }
+}
+
+void ThreadPool::RunTasks()
+{
+    while (true)
+    {
+        const OnEmptySignature* Task { nullptr };
+        {
+            std::lock_guard<std::mutex> Lock { m_Mutex };
+            if (!HasTask())
+            {
+                return;
+            }
+
+            Task = &(*m_Tasks)[m_Next++];
+        }
+
+        (*Task)();
+
+        std::lock_guard<std::mutex> Lock { m_Mutex };
+        m_Remaining--;
+        if (m_Remaining == 0)
+        {
+            m_WorkDone.notify_all();
+        }
+    }
+}
+
+bool ThreadPool::HasTask() const
+{
+    return m_Tasks != nullptr && m_Next < m_Tasks->size();
+}
+
+}
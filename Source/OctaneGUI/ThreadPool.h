@@ -0,0 +1,90 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "CallbackDefs.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Runs batches of independent tasks in parallel along with queued background jobs.
+///
+/// Run blocks until every task in the batch has finished and the calling thread
+/// takes part in the work, so a pool with no worker threads runs the batch serially.
+/// Workers are started with the first batch or job that can use them. A batch submitted
+/// from within a task of another batch is run serially on the calling thread.
+///
+/// Submit queues a job that runs on the next free worker without waiting for it. A pool
+/// with no worker threads for batches still starts one worker for jobs. Workers always
+/// pick up batch tasks before queued jobs, so background work does not delay a batch for
+/// longer than the jobs that are already running.
+class ThreadPool
+{
+public:
+    ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// @brief Sets the number of worker threads that help the calling thread with batches.
+    ThreadPool& SetThreads(unsigned int Count);
+    unsigned int Threads() const;
+
+    void Run(const std::vector<OnEmptySignature>& Tasks);
+
+    /// @brief Queues a job for a worker thread. This may be called from any thread. Jobs
+    /// that are still queued when the pool is stopped, including any submitted by those
+    /// jobs, are invoked before it finishes stopping.
+    void Submit(OnEmptySignature&& Job);
+
+private:
+    void Start();
+    void Stop();
+    void Worker();
+    void RunTasks();
+    bool HasTask() const;
+
+    unsigned int m_Threads { 0 };
+    std::vector<std::thread> m_Workers {};
+    std::mutex m_Mutex {};
+    std::condition_variable m_WorkReady {};
+    std::condition_variable m_WorkDone {};
+    const std::vector<OnEmptySignature>* m_Tasks { nullptr };
+    size_t m_Next { 0 };
+    size_t m_Remaining { 0 };
+    std::deque<OnEmptySignature> m_Jobs {};
+    bool m_Stopping { false };
+};
+
+}
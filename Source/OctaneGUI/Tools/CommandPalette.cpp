@@ -191,6 +191,12 @@ bool CommandPalette::Process(const std::u32string& Command, const std::vector<st
             {
                 Profiler::Get().Enable();
             }
+            else if (Lower == U"continuous" || Lower == U"c")
+            {
+                const size_t WindowSize = Arguments.size() > 1 ? (size_t)String::ToFloat(Arguments[1]) : 600;
+                const int64_t SlowFrameMS = Arguments.size() > 2 ? (int64_t)String::ToFloat(Arguments[2]) : 16;
+                Profiler::Get().EnableContinuous(WindowSize, SlowFrameMS);
+            }
             else if (Lower == U"disable" || Lower == U"d")
             {
                 if (Profiler::Get().IsEnabled())
@@ -199,9 +205,21 @@ bool CommandPalette::Process(const std::u32string& Command, const std::vector<st
                     Tools_->ShowProfileViewer(GetWindow());
                 }
             }
+            else if (Lower == U"export" || Lower == U"x")
+            {
+                const std::string Location = Arguments.size() > 1 ? String::ToMultiByte(Arguments[1]) : "Profile.json";
+                if (GetWindow()->App().FS().WriteContents(Location, Profiler::Get().Export().ToString()))
+                {
+                    printf("Exported profile to '%s'.\n", Location.c_str());
+                }
+                else
+                {
+                    printf("Failed to export profile to '%s'.\n", Location.c_str());
+                }
+            }
             else
             {
-                printf("No proifle command given. Must be 'enable' or 'disable'.\n");
+                printf("No proifle command given. Must be 'enable', 'continuous', 'disable', or 'export'.\n");
             }
         }
     }
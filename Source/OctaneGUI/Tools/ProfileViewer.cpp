@@ -40,7 +40,6 @@ SOFTWARE.
 #include "../Paint.h"
 #include "../ThemeProperties.h"
 #include "../Window.h"
-#include "Profiler.h"
 
 #include <cassert>
 #include <sstream>
@@ -50,6 +49,11 @@ namespace OctaneGUI
 namespace Tools
 {
 
+const std::vector<Profiler::Frame>& GetFrames(bool SlowFrames)
+{
+    return SlowFrames ? Profiler::Get().SlowFrames() : Profiler::Get().Frames();
+}
+
 class TimelineTrack : public Control
 {
     CLASS(TimelineTrack)
@@ -69,15 +73,39 @@ public:
         SetSelected(0);
     }
 
-    void SetViewMode(ProfileViewer::ViewMode Mode)
+    void SetSlowFrames(bool SlowFrames)
+    {
+        m_SlowFrames = SlowFrames;
+        m_Offset = 0.0f;
+        m_SelectedIndex = -1;
+        Initialize(Profiler::Get());
+        Invalidate();
+    }
+
+    void SetViewMode(ProfileViewer::ViewMode Mode, Profiler::Counter Type)
     {
-        if (m_ViewMode == Mode)
+        if (m_ViewMode == Mode && m_Counter == Type)
         {
             return;
         }
 
         m_ViewMode = Mode;
+        m_Counter = Type;
         UpdateValues(Profiler::Get());
+        Invalidate();
+    }
+
+    int64_t GetValue(const Profiler::Frame& Frame) const
+    {
+        switch (m_ViewMode)
+        {
+        case ProfileViewer::ViewMode::Count: return Frame.InclusiveCount();
+        case ProfileViewer::ViewMode::Counter: return (int64_t)Frame.CounterValue(m_Counter);
+        case ProfileViewer::ViewMode::Elapsed:
+        default: break;
+        }
+
+        return Frame.Elapsed();
     }
 
     TimelineTrack& SetOnSelected(OnIndexSignature&& Fn)
@@ -94,7 +122,7 @@ public:
 
     virtual void OnPaint(Paint& Brush) const override
     {
-        const std::vector<Profiler::Frame>& Frames = Profiler::Get().Frames();
+        const std::vector<Profiler::Frame>& Frames = GetFrames(m_SlowFrames);
         const Color BaseColor = GetProperty(ThemeProperties::Button).ToColor();
         const Color HoveredColor = GetProperty(ThemeProperties::Button_Hovered).ToColor();
         const Color SelectedColor = Color(255, 255, 0, 255);
@@ -116,7 +144,7 @@ public:
 
             const Profiler::Frame& Frame = Frames[I];
 
-            int64_t Value = m_ViewMode == ProfileViewer::ViewMode::Elapsed ? Frame.Elapsed() : Frame.InclusiveCount();
+            const int64_t Value = GetValue(Frame);
             const float Pct = (float)Value / (float)m_MaxValue;
             const float Height = GetSize().Y * Pct;
             const Vector2 Bottom = GetAbsolutePosition() + Vector2(0.0f, GetSize().Y);
@@ -138,7 +166,7 @@ public:
     {
         if (m_Drag)
         {
-            const std::vector<Profiler::Frame>& Frames = Profiler::Get().Frames();
+            const std::vector<Profiler::Frame>& Frames = GetFrames(m_SlowFrames);
 
             const Vector2 Delta = Position - m_Anchor;
             const float TotalSize = (float)Frames.size() * m_ColumnSize;
@@ -214,17 +242,10 @@ private:
     void UpdateValues(Profiler& Profile)
     {
         m_MaxValue = 50;
-        const std::vector<Profiler::Frame>& Frames = Profile.Frames();
+        const std::vector<Profiler::Frame>& Frames = m_SlowFrames ? Profile.SlowFrames() : Profile.Frames();
         for (const Profiler::Frame& Frame : Frames)
         {
-            if (m_ViewMode == ProfileViewer::ViewMode::Elapsed)
-            {
-                m_MaxValue = std::max<int64_t>(m_MaxValue, Frame.Elapsed());
-            }
-            else
-            {
-                m_MaxValue = std::max<int64_t>(m_MaxValue, Frame.InclusiveCount());
-            }
+            m_MaxValue = std::max<int64_t>(m_MaxValue, GetValue(Frame));
         }
     }
 
@@ -236,6 +257,8 @@ private:
     float m_Offset { 0.0f };
     Vector2 m_Anchor {};
     ProfileViewer::ViewMode m_ViewMode { ProfileViewer::ViewMode::Elapsed };
+    Profiler::Counter m_Counter { Profiler::Counter::Count };
+    bool m_SlowFrames { false };
 
     OnIndexSignature m_OnSelected { nullptr };
     OnIndexSignature m_OnHovered { nullptr };
@@ -294,10 +317,22 @@ void ProfileViewer::View(Window* InWindow)
 
     if (m_Window.expired())
     {
-        const char* Stream = R"({"Title": "ProfileViewer", "Width": 800, "Height": 400, "MenuBar": {"Items": [
+        std::string CounterItems;
+        for (size_t I = 0; I < (size_t)Profiler::Counter::Count; I++)
+        {
+            const std::string Name = Profiler::ToString((Profiler::Counter)I);
+            CounterItems += R"(,{"ID": ")" + Name + R"(", "Text": ")" + Name + R"("})";
+        }
+
+        const std::string Stream = R"({"Title": "ProfileViewer", "Width": 800, "Height": 400, "MenuBar": {"Items": [
+    {"ID": "Frames", "Text": "Frames", "Items": [
+        {"ID": "Recent", "Text": "Recent"},
+        {"ID": "Slow", "Text": "Slow"}
+    ]},
     {"ID": "View", "Text": "View", "Items": [
         {"ID": "Elapsed", "Text": "Elapsed Time"},
-        {"ID": "Count", "Text": "Event Count"}
+        {"ID": "Count", "Text": "Event Count"})"
+            + CounterItems + R"(
     ]}]},
     "Body": {"Controls": [
         {"Type": "Panel", "Expand": "Both"},
@@ -307,24 +342,51 @@ void ProfileViewer::View(Window* InWindow)
     ]}
 })";
         ControlList List;
-        m_Window = InWindow->App().NewWindow(ID, Stream, List);
+        m_Window = InWindow->App().NewWindow(ID, Stream.c_str(), List);
+
+        std::shared_ptr<std::vector<std::shared_ptr<MenuItem>>> ViewItems = std::make_shared<std::vector<std::shared_ptr<MenuItem>>>();
+        ViewItems->push_back(List.To<MenuItem>("View.Elapsed"));
+        ViewItems->push_back(List.To<MenuItem>("View.Count"));
+        for (size_t I = 0; I < (size_t)Profiler::Counter::Count; I++)
+        {
+            ViewItems->push_back(List.To<MenuItem>((std::string("View.") + Profiler::ToString((Profiler::Counter)I)).c_str()));
+        }
 
-        std::shared_ptr<MenuItem> ViewElapsed = List.To<MenuItem>("View.Elapsed");
-        std::shared_ptr<MenuItem> ViewCount = List.To<MenuItem>("View.Count");
+        for (size_t I = 0; I < ViewItems->size(); I++)
+        {
+            const std::weak_ptr<MenuItem> Item = (*ViewItems)[I];
+            const ViewMode Mode = I == 0 ? ViewMode::Elapsed : I == 1 ? ViewMode::Count : ViewMode::Counter;
+            const Profiler::Counter Type = Mode == ViewMode::Counter ? (Profiler::Counter)(I - 2) : Profiler::Counter::Count;
 
-        ViewElapsed->SetChecked(true)
-            .SetOnPressed([this, ViewElapsed, ViewCount](const TextSelectable&) -> void
+            Item.lock()->SetOnPressed([this, ViewItems, Item, Mode, Type](const TextSelectable&) -> void
                 {
-                    ViewElapsed->SetChecked(true);
-                    ViewCount->SetChecked(false);
-                    SetViewMode(ViewMode::Elapsed);
+                    for (const std::shared_ptr<MenuItem>& ViewItem : *ViewItems)
+                    {
+                        ViewItem->SetChecked(ViewItem == Item.lock());
+                    }
+
+                    SetViewMode(Mode, Type);
                 });
+        }
+
+        ViewItems->front()->SetChecked(true);
+
+        std::shared_ptr<MenuItem> FramesRecent = List.To<MenuItem>("Frames.Recent");
+        std::shared_ptr<MenuItem> FramesSlow = List.To<MenuItem>("Frames.Slow");
 
-        ViewCount->SetOnPressed([this, ViewElapsed, ViewCount](const TextSelectable&) -> void
+        FramesRecent->SetChecked(true)
+            .SetOnPressed([this, FramesRecent, FramesSlow](const TextSelectable&) -> void
+                {
+                    FramesRecent->SetChecked(true);
+                    FramesSlow->SetChecked(false);
+                    SetSlowFrames(false);
+                });
+
+        FramesSlow->SetOnPressed([this, FramesRecent, FramesSlow](const TextSelectable&) -> void
             {
-                ViewElapsed->SetChecked(false);
-                ViewCount->SetChecked(true);
-                SetViewMode(ViewMode::Count);
+                FramesRecent->SetChecked(false);
+                FramesSlow->SetChecked(true);
+                SetSlowFrames(true);
             });
 
         std::shared_ptr<Container> Root = List.To<Container>("Root");
@@ -332,10 +394,11 @@ void ProfileViewer::View(Window* InWindow)
 
         std::shared_ptr<HorizontalContainer> Info = Root->AddControl<HorizontalContainer>();
         Info->SetSpacing({ 20.0f, 0.0f });
-        std::string TotalFrames = "Frame Count: " + std::to_string(Profiler::Get().Frames().size());
-        Info->AddControl<Text>()->SetText(TotalFrames.c_str());
+        m_FrameCount = Info->AddControl<Text>();
         m_HoveredFrame = Info->AddControl<Text>();
 
+        m_FrameCounters = Root->AddControl<Text>();
+
         std::shared_ptr<Timeline> Timeline_ = Root->AddControl<Timeline>();
         Timeline_->Track()
             ->SetOnSelected([this](int Index) -> void
@@ -344,7 +407,7 @@ void ProfileViewer::View(Window* InWindow)
                 })
             .SetOnHovered([this](int Index)
                 {
-                    const std::vector<Profiler::Frame>& Frames = Profiler::Get().Frames();
+                    const std::vector<Profiler::Frame>& Frames = GetFrames(m_SlowFrames);
                     if (Index < (int)Frames.size())
                     {
                         std::string Contents = std::string("Frame [") + std::to_string(Index) + "]: " + std::to_string(Frames[Index].Elapsed());
@@ -396,14 +459,29 @@ void ProfileViewer::View(Window* InWindow)
     Populate();
 }
 
-void ProfileViewer::SetViewMode(ViewMode Mode)
+void ProfileViewer::SetViewMode(ViewMode Mode, Profiler::Counter Type)
+{
+    m_Timeline.lock()->Track()->SetViewMode(Mode, Type);
+}
+
+void ProfileViewer::SetSlowFrames(bool SlowFrames)
 {
-    m_Timeline.lock()->Track()->SetViewMode(Mode);
+    m_SlowFrames = SlowFrames;
+    // Resetting the track's frames will select the first frame.
+    m_Timeline.lock()->Track()->SetSlowFrames(SlowFrames);
+    UpdateFrameCount();
+}
+
+void ProfileViewer::UpdateFrameCount()
+{
+    const std::string TotalFrames = "Frame Count: " + std::to_string(GetFrames(m_SlowFrames).size());
+    m_FrameCount.lock()->SetText(TotalFrames.c_str());
 }
 
 void ProfileViewer::Populate()
 {
     m_Timeline.lock()->Initialize(Profiler::Get());
+    UpdateFrameCount();
     SetFrame(0);
 }
 
@@ -420,10 +498,10 @@ void AddEvents(const std::shared_ptr<Tree>& Root, const Profiler::Event& Event)
     }
 }
 
-const Profiler::Frame& GetFrame(size_t Index)
+const Profiler::Frame& GetFrame(size_t Index, bool SlowFrames)
 {
-    assert(Index < Profiler::Get().Frames().size());
-    return Profiler::Get().Frames()[Index];
+    assert(Index < GetFrames(SlowFrames).size());
+    return GetFrames(SlowFrames)[Index];
 }
 
 void ProfileViewer::SetFrame(size_t Index)
@@ -432,7 +510,7 @@ void ProfileViewer::SetFrame(size_t Index)
     bool Expanded = Tree_->IsExpanded();
     Tree_->ClearChildren();
 
-    const std::vector<Profiler::Frame>& Frames = Profiler::Get().Frames();
+    const std::vector<Profiler::Frame>& Frames = GetFrames(m_SlowFrames);
     if (Index < Frames.size())
     {
         m_FrameIndex = Index;
@@ -453,6 +531,7 @@ void ProfileViewer::SetFrame(size_t Index)
 
     Tree_->SetExpanded(Expanded);
     UpdateFrameInfo();
+    UpdateFrameCounters();
 }
 
 void AddRow(const std::shared_ptr<Container>& Column, int64_t Value)
@@ -490,12 +569,17 @@ void ProfileViewer::UpdateFrameInfo()
     std::shared_ptr<Container> Inclusive = m_InclusiveEventCount.lock();
     std::shared_ptr<Container> Exclusive = m_ExclusiveEventCount.lock();
 
-    const Profiler::Frame& Frame = GetFrame(m_FrameIndex);
-
     FrameTimes->ClearControls();
     Inclusive->ClearControls();
     Exclusive->ClearControls();
 
+    if (m_FrameIndex >= GetFrames(m_SlowFrames).size())
+    {
+        return;
+    }
+
+    const Profiler::Frame& Frame = GetFrame(m_FrameIndex, m_SlowFrames);
+
     AddRow(FrameTimes, Frame.Elapsed());
     AddRow(Inclusive, Frame.InclusiveCount());
     AddRow(Exclusive, Frame.ExclusiveCount());
@@ -517,5 +601,28 @@ void ProfileViewer::UpdateFrameInfo()
     m_Table.lock()->InvalidateLayout();
 }
 
+void ProfileViewer::UpdateFrameCounters()
+{
+    const std::vector<Profiler::Frame>& Frames = GetFrames(m_SlowFrames);
+    if (m_FrameIndex >= Frames.size())
+    {
+        m_FrameCounters.lock()->SetText("");
+        return;
+    }
+
+    std::string Contents;
+    for (size_t I = 0; I < (size_t)Profiler::Counter::Count; I++)
+    {
+        const Profiler::Counter Type = (Profiler::Counter)I;
+        if (!Contents.empty())
+        {
+            Contents += "  ";
+        }
+        Contents += std::string(Profiler::ToString(Type)) + ": " + std::to_string(Frames[m_FrameIndex].CounterValue(Type));
+    }
+
+    m_FrameCounters.lock()->SetText(Contents.c_str());
+}
+
 }
 }
@@ -26,6 +26,8 @@ SOFTWARE.
 
 #pragma once
 
+#include "Profiler.h"
+
 #include <memory>
 
 namespace OctaneGUI
@@ -40,7 +42,6 @@ class Window;
 namespace Tools
 {
 
-class Profiler;
 class Timeline;
 
 class ProfileViewer
@@ -49,7 +50,8 @@ public:
     enum class ViewMode
     {
         Elapsed,
-        Count
+        Count,
+        Counter
     };
 
     ProfileViewer();
@@ -57,12 +59,16 @@ public:
     void View(Window* InWindow);
 
 private:
-    void SetViewMode(ViewMode Mode);
+    void SetViewMode(ViewMode Mode, Profiler::Counter Type = Profiler::Counter::Count);
+    void SetSlowFrames(bool SlowFrames);
+    void UpdateFrameCount();
     void Populate();
     void SetFrame(size_t Index);
     void UpdateFrameInfo();
+    void UpdateFrameCounters();
 
     size_t m_FrameIndex { 0 };
+    bool m_SlowFrames { false };
 
     std::weak_ptr<Window> m_Window {};
     std::weak_ptr<Container> m_Root {};
@@ -72,7 +78,9 @@ private:
     std::weak_ptr<Container> m_FrameTimes {};
     std::weak_ptr<Container> m_InclusiveEventCount {};
     std::weak_ptr<Container> m_ExclusiveEventCount {};
+    std::weak_ptr<Text> m_FrameCount {};
     std::weak_ptr<Text> m_HoveredFrame {};
+    std::weak_ptr<Text> m_FrameCounters {};
 };
 
 }
@@ -25,14 +25,40 @@ SOFTWARE.
 */
 
 #include "Profiler.h"
+#include "../Json.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdarg>
+#include <cstdio>
+#include <unordered_map>
 
 namespace OctaneGUI
 {
 namespace Tools
 {
 
+std::atomic<uint64_t> Profiler::s_Allocations { 0 };
+
+const char* Profiler::ToString(Counter Type)
+{
+    switch (Type)
+    {
+    case Counter::Vertices: return "Vertices";
+    case Counter::Indices: return "Indices";
+    case Counter::DrawCommands: return "DrawCommands";
+    case Counter::Layouts: return "Layouts";
+    case Counter::HitTests: return "HitTests";
+    case Counter::Glyphs: return "Glyphs";
+    case Counter::Allocations: return "Allocations";
+    case Counter::Posts: return "Posts";
+    case Counter::Count:
+    default: break;
+    }
+
+    return "Unknown";
+}
+
 Profiler::Event::Event()
 {
 }
@@ -125,6 +151,12 @@ const std::vector<Profiler::Event>& Profiler::Frame::Events() const
     return m_Root.Events();
 }
 
+uint64_t Profiler::Frame::CounterValue(Counter Type) const
+{
+    assert(Type < Counter::Count);
+    return m_Counters[(size_t)Type];
+}
+
 void Profiler::Frame::CoalesceEvents()
 {
     CoalesceEvents(m_Root);
@@ -133,30 +165,26 @@ void Profiler::Frame::CoalesceEvents()
 void Profiler::Frame::CoalesceEvents(Profiler::Event& Group)
 {
     std::vector<Event> Events;
+    std::unordered_map<FlyString, size_t> Indices;
 
-    bool Found = false;
     unsigned int InclusiveCount = Group.InclusiveCount();
     for (Event& Event_ : Group.m_Events)
     {
         CoalesceEvents(Event_);
         InclusiveCount += Event_.InclusiveCount();
 
-        Found = false;
-        for (Event& Item : Events)
+        const std::unordered_map<FlyString, size_t>::const_iterator It = Indices.find(Event_.m_Name);
+        if (It != Indices.end())
         {
-            if (Event_.m_Name == Item.m_Name)
-            {
-                Item.m_Elapsed += Event_.m_Elapsed;
-                Item.m_ExclusiveCount++;
-                Item.m_InclusiveCount++;
-                Found = true;
-                break;
-            }
+            Event& Item = Events[It->second];
+            Item.m_Elapsed += Event_.m_Elapsed;
+            Item.m_ExclusiveCount++;
+            Item.m_InclusiveCount++;
         }
-
-        if (!Found)
+        else
         {
-            Events.push_back(Event_);
+            Indices[Event_.m_Name] = Events.size();
+            Events.push_back(std::move(Event_));
         }
     }
 
@@ -177,11 +205,35 @@ void Profiler::Enable()
         return;
     }
 
-    m_Enabled = true;
+    m_Continuous = false;
     m_Clock.Reset();
     m_Frames.clear();
+    m_SlowFrames.clear();
     m_Groups.clear();
-    printf("Profiler is enabled.\n");
+    for (std::atomic<uint64_t>& Pending : m_PendingCounters)
+    {
+        Pending.store(0, std::memory_order_relaxed);
+    }
+    m_Enabled = true;
+    Log("Profiler is enabled.\n");
+}
+
+void Profiler::EnableContinuous(size_t WindowSize, int64_t SlowFrameMS, size_t SlowFrameCapacity)
+{
+    if (m_Enabled)
+    {
+        return;
+    }
+
+    Enable();
+
+    m_Continuous = true;
+    m_WindowSize = std::max<size_t>(WindowSize, 1);
+    m_Head = 0;
+    m_SlowFrameMS = SlowFrameMS;
+    m_SlowFrameCapacity = SlowFrameCapacity;
+    m_Frames.reserve(m_WindowSize);
+    Log("Continuous mode with %d frames. Slow frame threshold: %dms\n", (int)m_WindowSize, (int)m_SlowFrameMS);
 }
 
 void Profiler::Disable()
@@ -192,15 +244,37 @@ void Profiler::Disable()
     }
 
     m_Enabled = false;
+    m_FrameThread = std::thread::id();
     float Elapsed = m_Clock.Measure();
-    printf("Profiler has ended. Elapsed: %f\n", Elapsed);
-    printf("Number of frames captured: %d\n", (int)m_Frames.size());
-    printf("Coalescing samples...\n");
+    Log("Profiler has ended. Elapsed: %f\n", Elapsed);
+    Log("Number of frames captured: %d\n", (int)m_Frames.size());
+
+    if (m_Continuous)
+    {
+        // Frames were coalesced as they completed. Only need to order the ring buffer from oldest to newest.
+        std::rotate(m_Frames.begin(), m_Frames.begin() + m_Head, m_Frames.end());
+        m_Head = 0;
+        Log("Number of slow frames captured: %d\n", (int)m_SlowFrames.size());
+        return;
+    }
+
+    Log("Coalescing samples...\n");
     for (Frame& Frame_ : m_Frames)
     {
         Frame_.CoalesceEvents();
     }
-    printf("Finished coalescing.\n");
+    Log("Finished coalescing.\n");
+}
+
+Profiler& Profiler::SetQuiet(bool Quiet)
+{
+    m_Quiet = Quiet;
+    return *this;
+}
+
+bool Profiler::IsQuiet() const
+{
+    return m_Quiet;
 }
 
 bool Profiler::IsEnabled() const
@@ -208,11 +282,94 @@ bool Profiler::IsEnabled() const
     return m_Enabled;
 }
 
+bool Profiler::IsContinuous() const
+{
+    return m_Continuous;
+}
+
 const std::vector<Profiler::Frame>& Profiler::Frames() const
 {
     return m_Frames;
 }
 
+const std::vector<Profiler::Frame>& Profiler::SlowFrames() const
+{
+    return m_SlowFrames;
+}
+
+void Profiler::AddCounter(Counter Type, uint64_t Value)
+{
+    if (!m_Enabled)
+    {
+        return;
+    }
+
+    // Only the thread running the current frame may touch m_Frames. Everything else, including
+    // counts added between frames, is merged into a frame when it ends.
+    if (!IsFrameThread())
+    {
+        m_PendingCounters[(size_t)Type].fetch_add(Value, std::memory_order_relaxed);
+        return;
+    }
+
+    CurrentFrame().m_Counters[(size_t)Type] += Value;
+}
+
+Json ExportEvent(const Profiler::Event& Event_)
+{
+    Json Result { Json::Type::Object };
+    Result["Name"] = Event_.Name();
+    Result["Elapsed"] = (double)Event_.Elapsed();
+    Result["InclusiveCount"] = (double)Event_.InclusiveCount();
+    Result["ExclusiveCount"] = (double)Event_.ExclusiveCount();
+
+    if (!Event_.Events().empty())
+    {
+        Json Events { Json::Type::Array };
+        for (const Profiler::Event& Item : Event_.Events())
+        {
+            Events.Push(ExportEvent(Item));
+        }
+        Result["Events"] = std::move(Events);
+    }
+
+    return Result;
+}
+
+Json Profiler::Export() const
+{
+    const auto ExportFrames = [](const std::vector<Frame>& Source) -> Json
+    {
+        Json Frames { Json::Type::Array };
+        for (const Frame& Frame_ : Source)
+        {
+            Json Counters { Json::Type::Object };
+            for (size_t I = 0; I < (size_t)Counter::Count; I++)
+            {
+                Counters[ToString((Counter)I)] = (double)Frame_.m_Counters[I];
+            }
+
+            Json Item = ExportEvent(Frame_.m_Root);
+            Item["Counters"] = std::move(Counters);
+            Frames.Push(std::move(Item));
+        }
+        return Frames;
+    };
+
+    Json Result { Json::Type::Object };
+    Result["Frames"] = ExportFrames(m_Frames);
+    if (m_Continuous)
+    {
+        Result["SlowFrames"] = ExportFrames(m_SlowFrames);
+    }
+    return Result;
+}
+
+void Profiler::TrackAllocation()
+{
+    s_Allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
 Profiler::Profiler()
 {
 }
@@ -224,27 +381,72 @@ void Profiler::BeginFrame()
         return;
     }
 
-    m_Frames.emplace_back(false);
-    Frame& Frame_ = m_Frames.back();
+    if (m_Continuous && m_Frames.size() >= m_WindowSize)
+    {
+        // Overwrite the oldest frame in the ring buffer.
+        m_Current = m_Head;
+        m_Head = (m_Head + 1) % m_WindowSize;
+        m_Frames[m_Current] = Frame(false);
+    }
+    else
+    {
+        m_Frames.emplace_back(false);
+        m_Current = m_Frames.size() - 1;
+    }
+
+    m_FrameThread = std::this_thread::get_id();
+
+    Frame& Frame_ = CurrentFrame();
     Frame_.m_Sample.m_Name = "Frame";
     Frame_.m_Sample.m_Group = true;
+    Frame_.m_AllocationsStart = s_Allocations.load(std::memory_order_relaxed);
     BeginSample(Frame_.m_Sample);
 }
 
 void Profiler::EndFrame()
 {
-    if (!m_Enabled || m_Frames.empty())
+    if (!m_Enabled || !IsFrameThread())
     {
         return;
     }
 
-    Frame& Frame_ = m_Frames.back();
+    Frame& Frame_ = CurrentFrame();
     EndSample(Frame_.m_Sample);
+    m_FrameThread = std::thread::id();
+    for (size_t I = 0; I < (size_t)Counter::Count; I++)
+    {
+        Frame_.m_Counters[I] += m_PendingCounters[I].exchange(0, std::memory_order_relaxed);
+    }
+    Frame_.m_Counters[(size_t)Counter::Allocations] = s_Allocations.load(std::memory_order_relaxed) - Frame_.m_AllocationsStart;
+
+    if (m_Continuous)
+    {
+        Frame_.CoalesceEvents();
+
+        if (Frame_.Elapsed() >= m_SlowFrameMS)
+        {
+            if (m_SlowFrames.size() >= m_SlowFrameCapacity && !m_SlowFrames.empty())
+            {
+                m_SlowFrames.erase(m_SlowFrames.begin());
+            }
+
+            if (m_SlowFrameCapacity > 0)
+            {
+                m_SlowFrames.push_back(Frame_);
+            }
+        }
+    }
+}
+
+Profiler::Frame& Profiler::CurrentFrame()
+{
+    assert(m_Current < m_Frames.size());
+    return m_Frames[m_Current];
 }
 
 void Profiler::BeginSample(Sample& Sample_)
 {
-    if (!m_Enabled || m_Frames.empty())
+    if (!m_Enabled || !IsFrameThread())
     {
         return;
     }
@@ -259,7 +461,7 @@ void Profiler::BeginSample(Sample& Sample_)
 
 void Profiler::EndSample(Sample& Sample_)
 {
-    if (!m_Enabled || m_Frames.empty())
+    if (!m_Enabled || !IsFrameThread())
     {
         return;
     }
@@ -267,7 +469,7 @@ void Profiler::EndSample(Sample& Sample_)
     int64_t End = m_Clock.MeasureMS();
     int64_t Elapsed = End - Sample_.m_Start;
 
-    Frame& Frame_ = m_Frames.back();
+    Frame& Frame_ = CurrentFrame();
 
     if (Sample_.m_Group)
     {
@@ -298,5 +500,23 @@ void Profiler::EndSample(Sample& Sample_)
     }
 }
 
+void Profiler::Log(const char* Format, ...) const
+{
+    if (m_Quiet)
+    {
+        return;
+    }
+
+    va_list Args;
+    va_start(Args, Format);
+    vprintf(Format, Args);
+    va_end(Args);
+}
+
+bool Profiler::IsFrameThread() const
+{
+    return m_FrameThread == std::this_thread::get_id();
+}
+
 }
 }
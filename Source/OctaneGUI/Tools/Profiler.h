@@ -29,16 +29,38 @@ SOFTWARE.
 #include "../Clock.h"
 #include "../FlyString.h"
 
+#include <atomic>
+#include <cstdint>
+#include <thread>
 #include <vector>
 
 namespace OctaneGUI
 {
+
+class Json;
+
 namespace Tools
 {
 
 class Profiler
 {
 public:
+    /// @brief Per-frame totals that are accumulated alongside the timed samples.
+    enum class Counter : uint8_t
+    {
+        Vertices,
+        Indices,
+        DrawCommands,
+        Layouts,
+        HitTests,
+        Glyphs,
+        Allocations,
+        Posts,
+        Count
+    };
+
+    static const char* ToString(Counter Type);
+
     class Event
     {
         friend Profiler;
@@ -89,6 +111,7 @@ public:
         unsigned int InclusiveCount() const;
         unsigned int ExclusiveCount() const;
         const std::vector<Event>& Events() const;
+        uint64_t CounterValue(Counter Type) const;
 
     private:
         void CoalesceEvents();
@@ -97,29 +120,80 @@ public:
         Sample m_Sample {};
         Event m_Root {};
         bool m_Begin { false };
+        uint64_t m_Counters[(size_t)Counter::Count] {};
+        uint64_t m_AllocationsStart { 0 };
     };
 
     static Profiler& Get();
 
     void Enable();
+
+    /// @brief Enables profiling with bounded memory usage.
+    ///
+    /// Only the most recent frames are kept in a ring buffer and each frame is coalesced
+    /// as soon as it ends. Any frame that takes at least SlowFrameMS is also copied into
+    /// a separate buffer which can be retrieved with SlowFrames.
+    ///
+    /// @param WindowSize Number of recent frames to keep.
+    /// @param SlowFrameMS Elapsed time in milliseconds for a frame to be considered slow.
+    /// @param SlowFrameCapacity Maximum number of slow frames to keep.
+    void EnableContinuous(size_t WindowSize = 600, int64_t SlowFrameMS = 16, size_t SlowFrameCapacity = 100);
     void Disable();
     bool IsEnabled() const;
 
+    /// @brief Stops the profiler from printing its status when it is enabled or disabled.
+    Profiler& SetQuiet(bool Quiet);
+    bool IsQuiet() const;
+
+    bool IsContinuous() const;
+
     const std::vector<Frame>& Frames() const;
+    const std::vector<Frame>& SlowFrames() const;
+
+    /// @brief Adds to a counter of the current frame. This may be called from worker
+    /// threads, in which case the value is merged into the frame when it ends. Values added
+    /// between frames are counted in the next frame.
+    void AddCounter(Counter Type, uint64_t Value);
+
+    /// @brief Serializes all captured frames, their events and counters.
+    Json Export() const;
+
+    /// @brief Records a single heap allocation. This is thread-safe and is meant to be
+    /// called from an application's allocator, see PROFILER_TRACK_ALLOCATIONS.
+    static void TrackAllocation();
 
 private:
     Profiler();
 
     void BeginFrame();
     void EndFrame();
+    Frame& CurrentFrame();
 
     void BeginSample(Sample& Sample_);
     void EndSample(Sample& Sample_);
-
-    bool m_Enabled { false };
+    bool IsFrameThread() const;
+    void Log(const char* Format, ...) const;
+
+    std::atomic<bool> m_Enabled { false };
+    bool m_Continuous { false };
+    bool m_Quiet { false };
+    size_t m_WindowSize { 0 };
+    size_t m_Head { 0 };
+    size_t m_Current { 0 };
+    int64_t m_SlowFrameMS { 0 };
+    size_t m_SlowFrameCapacity { 0 };
     std::vector<Frame> m_Frames {};
+    std::vector<Frame> m_SlowFrames {};
     std::vector<Event> m_Groups {};
     Clock m_Clock {};
+
+    // Samples are only recorded on the thread running the current frame, which is only set
+    // while a frame is active. Counters from any other thread, or added between frames, are
+    // accumulated here until the next frame ends.
+    std::atomic<std::thread::id> m_FrameThread {};
+    std::atomic<uint64_t> m_PendingCounters[(size_t)Counter::Count] {};
+
+    static std::atomic<uint64_t> s_Allocations;
 };
 
 }
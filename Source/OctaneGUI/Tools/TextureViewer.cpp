@@ -197,8 +197,10 @@ void TextureViewer::Show(Application& App)
                         if (!Path.empty())
                         {
                             const std::string UTF8Path = String::ToMultiByte(Path);
-                            App.GetTextureCache().Load(UTF8Path.c_str());
-                            Refresh(App);
+                            App.GetTextureCache().Load(UTF8Path.c_str(), [&App](const std::shared_ptr<Texture>&) -> void
+                                {
+                                    Refresh(App);
+                                });
                         }
                     });
 
@@ -26,9 +26,16 @@ SOFTWARE.
 
 #include "Vertex.h"
 
+#include <algorithm>
+
 namespace OctaneGUI
 {
 
+static uint16_t ToUNorm16(float Value)
+{
+    return (uint16_t)(std::clamp(Value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
 Vertex::Vertex()
     : Position()
     , TexCoords()
@@ -57,4 +64,33 @@ Vertex::Vertex(const Vector2& InPosition, const Vector2& InTexCoords, const Colo
 {
 }
 
+CompactVertex::CompactVertex()
+    : Position()
+    , U(0)
+    , V(0)
+    , Col()
+{
+}
+
+CompactVertex::CompactVertex(const Vector2& InPosition, const Color& InCol)
+    : Position(InPosition)
+    , U(0)
+    , V(0)
+    , Col(InCol)
+{
+}
+
+CompactVertex::CompactVertex(const Vector2& InPosition, const Vector2& InTexCoords, const Color& InCol)
+    : Position(InPosition)
+    , U(ToUNorm16(InTexCoords.X))
+    , V(ToUNorm16(InTexCoords.Y))
+    , Col(InCol)
+{
+}
+
+Vector2 CompactVertex::TexCoords() const
+{
+    return { (float)U / 65535.0f, (float)V / 65535.0f };
+}
+
 }
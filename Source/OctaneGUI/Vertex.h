@@ -29,6 +29,8 @@ SOFTWARE.
 #include "Color.h"
 #include "Vector2.h"
 
+#include <cstdint>
+
 namespace OctaneGUI
 {
 
@@ -45,4 +47,23 @@ public:
     Vertex(const Vector2& InPosition, const Vector2& InTexCoords, const Color& InCol);
 };
 
+/// @brief A 16 byte vertex with texture coordinates stored as normalized 16-bit values.
+///
+/// Texture coordinates are clamped to [0, 1] and map to [0, 65535]. Renderers should
+/// read them as normalized unsigned shorts.
+struct CompactVertex
+{
+public:
+    Vector2 Position;
+    uint16_t U;
+    uint16_t V;
+    Color Col;
+
+    CompactVertex();
+    CompactVertex(const Vector2& InPosition, const Color& InCol);
+    CompactVertex(const Vector2& InPosition, const Vector2& InTexCoords, const Color& InCol);
+
+    Vector2 TexCoords() const;
+};
+
 }
@@ -26,7 +26,10 @@ SOFTWARE.
 
 #include "VertexBuffer.h"
 
+#include <cassert>
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
 
 namespace OctaneGUI
 {
@@ -39,18 +42,54 @@ VertexBuffer::~VertexBuffer()
 {
 }
 
+VertexBuffer& VertexBuffer::SetCompact(bool Compact)
+{
+    if (m_Commands.empty())
+    {
+        m_Compact = Compact;
+    }
+
+    return *this;
+}
+
+bool VertexBuffer::IsCompact() const
+{
+    return m_Compact;
+}
+
 void VertexBuffer::AddVertex(const Vector2& Point, const Color& Col)
 {
+    if (m_Compact)
+    {
+        m_CompactVertices.emplace_back(Point, Col);
+        return;
+    }
+
     m_Vertices.emplace_back(Point, Col);
 }
 
 void VertexBuffer::AddVertex(const Vector2& Point, const Vector2& TexCoords, const Color& Col)
 {
+    if (m_Compact)
+    {
+        m_CompactVertices.emplace_back(Point, TexCoords, Col);
+        return;
+    }
+
     m_Vertices.emplace_back(Point, TexCoords, Col);
 }
 
 void VertexBuffer::AddVertices(const std::vector<Vector2>& Points, const Color& Col)
 {
+    if (m_Compact)
+    {
+        for (const Vector2& Point : Points)
+        {
+            m_CompactVertices.emplace_back(Point, Col);
+        }
+        return;
+    }
+
     const size_t Index = m_Vertices.size();
     m_Vertices.resize(m_Vertices.size() + Points.size());
 
@@ -63,7 +102,26 @@ void VertexBuffer::AddVertices(const std::vector<Vector2>& Points, const Color&
 
 void VertexBuffer::AddIndex(uint32_t Index)
 {
-    m_Indices.push_back(Index);
+    if (m_Compact)
+    {
+        if (m_IndexBase + Index >= CompactMaxVertices)
+        {
+            SplitCommand();
+        }
+
+        // The caller addresses more vertices than a single command can. This is not only
+        // checked in debug builds since the index would silently wrap around otherwise.
+        if (Index >= CompactMaxVertices)
+        {
+            printf("Index %u exceeds the maximum of %u vertices for a compact command.\n", Index, CompactMaxVertices);
+            std::abort();
+        }
+
+        m_CompactIndices.push_back((uint16_t)(m_IndexBase + Index));
+        return;
+    }
+
+    m_Indices.push_back(m_IndexBase + Index);
 }
 
 const std::vector<Vertex>& VertexBuffer::GetVertices() const
@@ -76,19 +134,63 @@ const std::vector<uint32_t>& VertexBuffer::GetIndices() const
     return m_Indices;
 }
 
+const std::vector<CompactVertex>& VertexBuffer::GetCompactVertices() const
+{
+    return m_CompactVertices;
+}
+
+const std::vector<uint16_t>& VertexBuffer::GetCompactIndices() const
+{
+    return m_CompactIndices;
+}
+
 uint32_t VertexBuffer::GetVertexCount() const
 {
-    return (uint32_t)m_Vertices.size();
+    return m_Compact ? (uint32_t)m_CompactVertices.size() : (uint32_t)m_Vertices.size();
 }
 
 uint32_t VertexBuffer::GetIndexCount() const
 {
-    return (uint32_t)m_Indices.size();
+    return m_Compact ? (uint32_t)m_CompactIndices.size() : (uint32_t)m_Indices.size();
+}
+
+size_t VertexBuffer::GetByteSize() const
+{
+    if (m_Compact)
+    {
+        return m_CompactVertices.size() * sizeof(CompactVertex) + m_CompactIndices.size() * sizeof(uint16_t);
+    }
+
+    return m_Vertices.size() * sizeof(Vertex) + m_Indices.size() * sizeof(uint32_t);
 }
 
 DrawCommand& VertexBuffer::PushCommand(uint32_t IndexCount, uint32_t TextureID, Rect Clip)
 {
-    m_Commands.emplace_back((uint32_t)m_Vertices.size(), (uint32_t)m_Indices.size(), IndexCount, TextureID, Clip);
+    const uint32_t VertexCount = GetVertexCount();
+    const uint32_t Indices = GetIndexCount();
+    m_PushIndexOffset = Indices;
+    m_PushIndexCount = IndexCount;
+    if (!m_Commands.empty())
+    {
+        DrawCommand& Last = m_Commands.back();
+        const uint32_t Base = VertexCount - Last.m_VertexOffset;
+
+        // Paint usually adds fewer vertices than indices, so the index count bounds the
+        // vertices that a compact command would need to address. AddIndex splits the
+        // command again if this does not hold.
+        if (Last.m_TextureID == TextureID
+            && Last.m_Clip == Clip
+            && Last.m_IndexOffset + Last.m_IndexCount == Indices
+            && (!m_Compact || Base + IndexCount <= CompactMaxVertices))
+        {
+            m_IndexBase = Base;
+            Last.m_IndexCount += IndexCount;
+            return Last;
+        }
+    }
+
+    m_IndexBase = 0;
+    m_Commands.emplace_back(VertexCount, Indices, IndexCount, TextureID, Clip);
     return m_Commands.back();
 }
 
@@ -97,4 +199,87 @@ const std::vector<DrawCommand>& VertexBuffer::Commands() const
     return m_Commands;
 }
 
+void VertexBuffer::Append(const VertexBuffer& Segment)
+{
+    assert(m_Compact == Segment.m_Compact);
+
+    const uint32_t VertexCount = GetVertexCount();
+    const uint32_t IndexCount = GetIndexCount();
+    for (size_t I = 0; I < Segment.m_Commands.size(); I++)
+    {
+        const DrawCommand& Command = Segment.m_Commands[I];
+        const uint32_t IndexOffset = IndexCount + Command.m_IndexOffset;
+
+        // Indices are relative to their command, so they are only rebased when the
+        // segment's first command is merged into the last command of this buffer.
+        if (I == 0 && !m_Commands.empty())
+        {
+            DrawCommand& Last = m_Commands.back();
+            const uint32_t Base = VertexCount - Last.m_VertexOffset;
+            const uint32_t End = Segment.m_Commands.size() > 1 ? Segment.m_Commands[1].m_VertexOffset : Segment.GetVertexCount();
+
+            if (Last.m_TextureID == Command.m_TextureID
+                && Last.m_Clip == Command.m_Clip
+                && Last.m_IndexOffset + Last.m_IndexCount == IndexCount
+                && (!m_Compact || Base + End <= CompactMaxVertices))
+            {
+                Append(m_Indices, Segment.m_Indices, Command.m_IndexOffset, Command.m_IndexCount, Base);
+                Append(m_CompactIndices, Segment.m_CompactIndices, Command.m_IndexOffset, Command.m_IndexCount, Base);
+                Last.m_IndexCount += Command.m_IndexCount;
+                m_IndexBase = Base;
+                m_PushIndexOffset = IndexCount;
+                m_PushIndexCount = Command.m_IndexCount;
+                continue;
+            }
+        }
+
+        Append(m_Indices, Segment.m_Indices, Command.m_IndexOffset, Command.m_IndexCount, 0);
+        Append(m_CompactIndices, Segment.m_CompactIndices, Command.m_IndexOffset, Command.m_IndexCount, 0);
+        m_Commands.emplace_back(VertexCount + Command.m_VertexOffset, IndexOffset, Command.m_IndexCount, Command.m_TextureID, Command.m_Clip);
+        m_IndexBase = 0;
+    }
+
+    m_Vertices.insert(m_Vertices.end(), Segment.m_Vertices.begin(), Segment.m_Vertices.end());
+    m_CompactVertices.insert(m_CompactVertices.end(), Segment.m_CompactVertices.begin(), Segment.m_CompactVertices.end());
+}
+
+void VertexBuffer::SplitCommand()
+{
+    if (m_IndexBase == 0 || m_Commands.empty())
+    {
+        return;
+    }
+
+    // Move the indices of the last PushCommand call out of the merged command. They are
+    // rebased onto the first vertex of that call.
+    DrawCommand& Last = m_Commands.back();
+    const uint32_t VertexOffset = Last.m_VertexOffset + m_IndexBase;
+    const uint32_t TextureID = Last.m_TextureID;
+    const Rect Clip = Last.m_Clip;
+    Last.m_IndexCount -= m_PushIndexCount;
+
+    for (size_t I = m_PushIndexOffset; I < m_CompactIndices.size(); I++)
+    {
+        m_CompactIndices[I] = (uint16_t)(m_CompactIndices[I] - m_IndexBase);
+    }
+
+    m_Commands.emplace_back(VertexOffset, m_PushIndexOffset, m_PushIndexCount, TextureID, Clip);
+    m_IndexBase = 0;
+}
+
+template <typename T>
+void VertexBuffer::Append(std::vector<T>& Dest, const std::vector<T>& Source, uint32_t Offset, uint32_t Count, uint32_t Base)
+{
+    if (Source.empty())
+    {
+        return;
+    }
+
+    Dest.reserve(Dest.size() + Count);
+    for (uint32_t I = Offset; I < Offset + Count; I++)
+    {
+        Dest.push_back((T)(Source[I] + Base));
+    }
+}
+
 }
@@ -34,12 +34,24 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+/// @brief Vertices, indices and draw commands produced by a Paint.
+///
+/// A compact buffer stores CompactVertex vertices and 16-bit indices instead, which
+/// are filled through the same functions. Commands are kept small enough that their
+/// indices fit into 16 bits relative to their VertexOffset.
 class VertexBuffer
 {
 public:
+    /// @brief The number of vertices a single command may address in a compact buffer.
+    static constexpr uint32_t CompactMaxVertices = 0x10000;
+
     VertexBuffer();
     ~VertexBuffer();
 
+    /// @brief Selects the compact format. Ignored once anything has been added.
+    VertexBuffer& SetCompact(bool Compact);
+    bool IsCompact() const;
+
     void AddVertex(const Vector2& Point, const Color& Col);
     void AddVertex(const Vector2& Point, const Vector2& TexCoords, const Color& Col);
     void AddVertices(const std::vector<Vector2>& Points, const Color& Tint);
@@ -47,17 +59,49 @@ public:
 
     const std::vector<Vertex>& GetVertices() const;
     const std::vector<uint32_t>& GetIndices() const;
+    const std::vector<CompactVertex>& GetCompactVertices() const;
+    const std::vector<uint16_t>& GetCompactIndices() const;
 
     uint32_t GetVertexCount() const;
     uint32_t GetIndexCount() const;
 
+    /// @brief The number of bytes of vertex and index data a renderer uploads for this buffer.
+    size_t GetByteSize() const;
+
+    /// @brief Starts a command for the next IndexCount indices. Indices added afterwards are
+    /// relative to the first vertex added after this call. Consecutive commands with the
+    /// same texture and clip are merged into a single command. In a compact buffer, a merged
+    /// command is split off again if one of its indices would not fit into 16 bits.
     DrawCommand& PushCommand(uint32_t IndexCount, uint32_t TextureID, Rect Clip);
     const std::vector<DrawCommand>& Commands() const;
 
+    /// @brief Appends the contents of a buffer that was filled separately. The result is
+    /// the same as if the segment's commands had been pushed onto this buffer, including
+    /// merging its first command into the last one. Both buffers must use the same format.
+    void Append(const VertexBuffer& Segment);
+
 private:
+    friend class FrameCapture;
+
+    template <typename T>
+    static void Append(std::vector<T>& Dest, const std::vector<T>& Source, uint32_t Offset, uint32_t Count, uint32_t Base);
+
+    void SplitCommand();
+
     std::vector<Vertex> m_Vertices;
     std::vector<uint32_t> m_Indices;
+    std::vector<CompactVertex> m_CompactVertices;
+    std::vector<uint16_t> m_CompactIndices;
     std::vector<DrawCommand> m_Commands;
+    bool m_Compact { false };
+
+    // Offset added to indices when the current command was merged into the previous one.
+    uint32_t m_IndexBase { 0 };
+
+    // The indices of the most recent PushCommand call, which are moved into their own
+    // command if they were merged but can not be addressed.
+    uint32_t m_PushIndexOffset { 0 };
+    uint32_t m_PushIndexCount { 0 };
 };
 
 }
@@ -43,10 +43,74 @@ SOFTWARE.
 #endif
 
 #include <algorithm>
+#include <atomic>
 
 namespace OctaneGUI
 {
 
+// Shared between the window and the parse thread. A cancelled load only flags this state
+// and lets go of it, so the thread discards its result instead of being waited on.
+struct ParseState
+{
+    std::atomic<bool> Parsed { false };
+    std::atomic<bool> Cancelled { false };
+    bool IsError { false };
+    Json Root {};
+    Json Controls {};
+};
+
+struct Window::PendingLoad
+{
+    std::shared_ptr<ParseState> State { nullptr };
+    bool IsError { false };
+    bool Started { false };
+    Json Root {};
+    Json Controls {};
+    unsigned int Index { 0 };
+    int64_t BudgetMS { 0 };
+    OnLoadedSignature OnLoaded { nullptr };
+};
+
+static bool ValidateControls(const Json& Controls)
+{
+    if (Controls.IsNull())
+    {
+        return true;
+    }
+
+    if (!Controls.IsArray())
+    {
+        return false;
+    }
+
+    for (unsigned int I = 0; I < Controls.Count(); I++)
+    {
+        const Json& Item = Controls[I];
+        if (!Item.IsObject() || !Item["Type"].IsString() || !ValidateControls(Item["Controls"]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool Validate(const Json& Root)
+{
+    if (!Root.IsObject())
+    {
+        return false;
+    }
+
+    const Json& Body = Root["Body"];
+    if (Body.IsNull())
+    {
+        return true;
+    }
+
+    return Body.IsObject() && ValidateControls(Body["Controls"]);
+}
+
 Window::Window(Application* InApplication)
     : m_Application(InApplication)
 {
@@ -75,6 +139,7 @@ Window::Window(Application* InApplication)
 
 Window::~Window()
 {
+    CancelPendingLoad();
     m_Container->SetWindow(nullptr);
     m_Container = nullptr;
 }
@@ -728,6 +793,7 @@ void Window::Update()
 {
     PROFILER_SAMPLE_GROUP((std::string("Window::Update (") + String::ToMultiByte(GetTitle()) + ")").c_str());
 
+    UpdatePendingLoad();
     UpdateTimers();
 
     if (!m_LayoutRequests.empty())
@@ -755,12 +821,8 @@ void Window::DoPaint(Paint& Brush)
 {
     if (m_Repaint)
     {
-        PROFILER_SAMPLE_GROUP((std::string("Window::OnPaint (") + String::ToMultiByte(GetTitle()) + ")").c_str());
-
-        m_Container->OnPaint(Brush);
-        m_Popup.OnPaint(Brush);
-        m_Repaint = false;
-        m_OnPaint(this, Brush.GetBuffer());
+        Tessellate(Brush);
+        Submit(Brush);
     }
 }
 
@@ -769,6 +831,29 @@ void Window::Repaint()
     m_Repaint = true;
 }
 
+bool Window::NeedsRepaint() const
+{
+    return m_Repaint;
+}
+
+void Window::Tessellate(Paint& Brush)
+{
+    PROFILER_SAMPLE_GROUP((std::string("Window::OnPaint (") + String::ToMultiByte(GetTitle()) + ")").c_str());
+
+    m_Container->OnPaint(Brush);
+    m_Popup.OnPaint(Brush);
+    m_Repaint = false;
+
+    PROFILER_COUNTER(Vertices, Brush.GetBuffer().GetVertexCount());
+    PROFILER_COUNTER(Indices, Brush.GetBuffer().GetIndexCount());
+    PROFILER_COUNTER(DrawCommands, Brush.GetBuffer().Commands().size());
+}
+
+void Window::Submit(const Paint& Brush)
+{
+    m_OnPaint(this, Brush.GetBuffer());
+}
+
 void Window::Load(const char* JsonStream)
 {
     Load(Json::Parse(JsonStream));
@@ -825,8 +910,47 @@ void Window::LoadContents(const Json& Root, ControlList& List)
     Populate(List);
 }
 
+Window& Window::LoadAsync(const char* JsonStream, OnLoadedSignature&& OnLoaded, int64_t BudgetMS)
+{
+    CancelPendingLoad();
+
+    m_PendingLoad = std::make_unique<PendingLoad>();
+    m_PendingLoad->BudgetMS = BudgetMS;
+    m_PendingLoad->OnLoaded = std::move(OnLoaded);
+
+    std::shared_ptr<ParseState> State = std::make_shared<ParseState>();
+    m_PendingLoad->State = State;
+    App().GetThreadPool().Submit([State, Stream = std::string(JsonStream)]() -> void
+        {
+            if (State->Cancelled.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            State->Root = Json::Parse(Stream.c_str(), State->IsError);
+            State->IsError = State->IsError || !Validate(State->Root);
+
+            // Hold on to the body controls so they can be created incrementally.
+            const Json& Root = State->Root;
+            if (!State->IsError && Root["Body"].IsObject())
+            {
+                State->Controls = std::move(State->Root["Body"]["Controls"]);
+            }
+
+            State->Parsed.store(true, std::memory_order_release);
+        });
+
+    return *this;
+}
+
+bool Window::IsLoading() const
+{
+    return m_PendingLoad != nullptr;
+}
+
 void Window::Clear()
 {
+    CancelPendingLoad();
     m_Container->Clear();
     m_Popup.Close();
     m_LayoutRequests.clear();
@@ -862,6 +986,20 @@ void Window::StartTimer(const std::shared_ptr<Timer>& Object)
     m_Timers.emplace_back(Object);
 }
 
+void Window::StartOwnedTimer(const std::shared_ptr<Timer>& Object)
+{
+    StartTimer(Object);
+
+    for (TimerHandle& Handle : m_Timers)
+    {
+        if (Handle.Object.lock() == Object)
+        {
+            Handle.Owned = Object;
+            break;
+        }
+    }
+}
+
 bool Window::ClearTimer(const std::shared_ptr<Timer>& Object)
 {
     for (std::vector<TimerHandle>::const_iterator It = m_Timers.begin(); It != m_Timers.end();)
@@ -882,6 +1020,11 @@ bool Window::ClearTimer(const std::shared_ptr<Timer>& Object)
     return false;
 }
 
+IdleScheduler::TaskID Window::AddIdleTask(IdleScheduler::OnStepSignature&& Fn, IdleScheduler::Priority Priority_)
+{
+    return App().GetIdleScheduler().Add(std::move(Fn), Priority_, this);
+}
+
 Window& Window::SetOnPaint(OnPaintSignature&& Fn)
 {
     m_OnPaint = std::move(Fn);
@@ -972,8 +1115,85 @@ void Window::RequestLayout(std::shared_ptr<Container> Request)
     }
 }
 
+void Window::UpdatePendingLoad()
+{
+    if (!m_PendingLoad || !m_PendingLoad->State->Parsed.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    PROFILER_SAMPLE("Window::UpdatePendingLoad");
+
+    PendingLoad& Pending = *m_PendingLoad;
+    if (!Pending.Started)
+    {
+        // The parse thread is done with the state once it is flagged as parsed.
+        ParseState& State = *Pending.State;
+        Pending.IsError = State.IsError;
+        Pending.Root = std::move(State.Root);
+        Pending.Controls = std::move(State.Controls);
+        Pending.Started = true;
+
+        if (!Pending.IsError)
+        {
+            Load(Pending.Root);
+        }
+    }
+
+    if (!Pending.IsError)
+    {
+        const std::shared_ptr<Container> Body = GetContainer();
+        const Clock Budget;
+        while (Pending.Index < Pending.Controls.Count())
+        {
+            Body->LoadControl(Pending.Controls[Pending.Index++]);
+
+            if (Pending.BudgetMS > 0 && Budget.MeasureMS() >= Pending.BudgetMS)
+            {
+                break;
+            }
+        }
+
+        if (Pending.Index < Pending.Controls.Count())
+        {
+            return;
+        }
+    }
+
+    const bool Success = !Pending.IsError;
+    const OnLoadedSignature OnLoaded = std::move(Pending.OnLoaded);
+    m_PendingLoad = nullptr;
+
+    ControlList List;
+    if (Success)
+    {
+        Populate(List);
+    }
+
+    if (OnLoaded)
+    {
+        OnLoaded(*this, List, Success);
+    }
+}
+
+void Window::CancelPendingLoad()
+{
+    if (!m_PendingLoad)
+    {
+        return;
+    }
+
+    m_PendingLoad->State->Cancelled.store(true, std::memory_order_release);
+    m_PendingLoad = nullptr;
+}
+
 void Window::UpdateTimers()
 {
+    // Timers may be started or stopped from within their callbacks, so the list is
+    // updated before any of the due timers are invoked. A callback may also destroy
+    // the owner of another due timer, so expired timers are skipped.
+    std::vector<std::weak_ptr<Timer>> Due;
+    std::vector<std::shared_ptr<Timer>> Released;
     for (std::vector<TimerHandle>::iterator It = m_Timers.begin(); It != m_Timers.end();)
     {
         TimerHandle& Handle = *It;
@@ -987,7 +1207,7 @@ void Window::UpdateTimers()
         std::shared_ptr<Timer> Object = Handle.Object.lock();
         if (Handle.Elapsed.MeasureMS() >= Object->Interval())
         {
-            Object->Invoke();
+            Due.push_back(Handle.Object);
 
             if (Object->Repeat())
             {
@@ -996,6 +1216,11 @@ void Window::UpdateTimers()
             }
             else
             {
+                // Owned timers are kept alive until their callback has been invoked.
+                if (Handle.Owned)
+                {
+                    Released.push_back(std::move(Handle.Owned));
+                }
                 It = m_Timers.erase(It);
             }
         }
@@ -1004,6 +1229,14 @@ void Window::UpdateTimers()
             It++;
         }
     }
+
+    for (const std::weak_ptr<Timer>& Item : Due)
+    {
+        if (std::shared_ptr<Timer> Object = Item.lock())
+        {
+            Object->Invoke();
+        }
+    }
 }
 
 void Window::UpdateFocus(const std::shared_ptr<Control>& Focus)
@@ -27,6 +27,7 @@ SOFTWARE.
 #pragma once
 
 #include "Clock.h"
+#include "IdleScheduler.h"
 #include "Keyboard.h"
 #include "Mouse.h"
 #include "Popup.h"
@@ -79,6 +80,7 @@ public:
     typedef std::function<void(Window*, const VertexBuffer&)> OnPaintSignature;
     typedef std::function<void(Window&, const char32_t*)> OnSetTitleSignature;
     typedef std::function<void(Window&)> OnWindowSignature;
+    typedef std::function<void(Window&, ControlList&, bool)> OnLoadedSignature;
 
     Window(Application* InApplication);
     virtual ~Window();
@@ -194,6 +196,16 @@ public:
     void Update();
     void DoPaint(Paint& Brush);
     void Repaint();
+    bool NeedsRepaint() const;
+
+    /// @brief Paints the window's controls into the given brush without submitting them.
+    ///
+    /// This only reads the control tree and may be called on a worker thread while other
+    /// windows are tessellated. Submit must then be called on the UI thread.
+    void Tessellate(Paint& Brush);
+
+    /// @brief Hands a tessellated buffer to the frontend.
+    void Submit(const Paint& Brush);
 
     void Load(const char* JsonStream);
     void Load(const char* JsonStream, ControlList& List);
@@ -202,12 +214,38 @@ public:
     void LoadRoot(const Json& Root);
     void LoadContents(const Json& Root);
     void LoadContents(const Json& Root, ControlList& List);
+
+    /// @brief Loads the window from a JSON stream without blocking the main thread.
+    ///
+    /// The stream is parsed and validated on the application's thread pool. Once parsing is complete,
+    /// the controls are created on the main thread during Update. If BudgetMS is greater
+    /// than zero, the top-level body controls are created across multiple frames, stopping
+    /// each frame once the budget is spent. Calling Clear or LoadAsync again cancels any
+    /// pending load.
+    ///
+    /// @param JsonStream The JSON string describing the window. The string is copied.
+    /// @param OnLoaded Invoked on the main thread once all controls are created, with the
+    /// list of loaded controls and whether the stream was valid.
+    /// @param BudgetMS Milliseconds to spend creating controls per frame. Zero creates all
+    /// controls in a single frame.
+    /// @return This reference for chaining.
+    Window& LoadAsync(const char* JsonStream, OnLoadedSignature&& OnLoaded, int64_t BudgetMS = 0);
+    bool IsLoading() const;
+
     void Clear();
 
     std::shared_ptr<Timer> CreateTimer(int Interval, bool Repeat, OnEmptySignature&& Callback);
     void StartTimer(const std::shared_ptr<Timer>& Object);
+
+    /// @brief Starts a timer that the window keeps alive until it fires, is cleared or the
+    /// window is destroyed. Repeating timers are kept until they are cleared.
+    void StartOwnedTimer(const std::shared_ptr<Timer>& Object);
     bool ClearTimer(const std::shared_ptr<Timer>& Object);
 
+    /// @brief Same as Application::AddIdleTask, but the task is cancelled when this window
+    /// is destroyed.
+    IdleScheduler::TaskID AddIdleTask(IdleScheduler::OnStepSignature&& Fn, IdleScheduler::Priority Priority_ = IdleScheduler::Priority::Normal);
+
     Window& SetOnPaint(OnPaintSignature&& Fn);
     Window& SetOnSetTitle(OnSetTitleSignature&& Fn);
     Window& SetOnSetPosition(OnWindowSignature&& Fn);
@@ -228,12 +266,17 @@ private:
         }
 
         std::weak_ptr<Timer> Object;
+        std::shared_ptr<Timer> Owned { nullptr };
         Clock Elapsed {};
     };
 
     Window();
 
+    struct PendingLoad;
+
     void Populate(ControlList& List) const;
+    void UpdatePendingLoad();
+    void CancelPendingLoad();
     void RequestLayout(std::shared_ptr<Container> Request);
     void UpdateTimers();
     void UpdateFocus(const std::shared_ptr<Control>& Focus);
@@ -258,6 +301,7 @@ private:
     std::vector<std::weak_ptr<Container>> m_LayoutRequests;
 
     std::vector<TimerHandle> m_Timers {};
+    std::unique_ptr<PendingLoad> m_PendingLoad { nullptr };
 
     OnPaintSignature m_OnPaint { nullptr };
     OnContainerSignature m_OnPopupClose { nullptr };
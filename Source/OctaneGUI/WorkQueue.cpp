@@ -0,0 +1,161 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "WorkQueue.h"
+
+#include <algorithm>
+
+namespace OctaneGUI
+{
+
+WorkQueue::WorkQueue()
+    : m_Head(&m_Stub)
+    , m_Tail(&m_Stub)
+{
+}
+
+WorkQueue::~WorkQueue()
+{
+    while (Node* Item = Pop())
+    {
+        delete Item;
+    }
+}
+
+void WorkQueue::Push(OnEmptySignature&& Fn)
+{
+    Node* Item = new Node();
+    Item->Fn = std::move(Fn);
+    Item->Pushed = std::chrono::steady_clock::now();
+
+    m_Depth.fetch_add(1, std::memory_order_relaxed);
+    m_Pushed.fetch_add(1, std::memory_order_relaxed);
+    Push(Item);
+}
+
+size_t WorkQueue::Drain(std::chrono::microseconds Budget)
+{
+    const std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+    size_t Result = 0;
+
+    while (Node* Item = Pop())
+    {
+        m_Depth.fetch_sub(1, std::memory_order_relaxed);
+
+        const std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+        const int64_t Latency = std::chrono::duration_cast<std::chrono::microseconds>(Now - Item->Pushed).count();
+        m_TotalLatency += Latency;
+        m_MaxLatency = std::max<int64_t>(m_MaxLatency, Latency);
+        m_Processed++;
+        Result++;
+
+        if (Item->Fn)
+        {
+            Item->Fn();
+        }
+        delete Item;
+
+        if (Budget.count() > 0 && std::chrono::steady_clock::now() - Start >= Budget)
+        {
+            if (Depth() > 0)
+            {
+                m_Deferred++;
+            }
+            break;
+        }
+    }
+
+    return Result;
+}
+
+size_t WorkQueue::Depth() const
+{
+    return m_Depth.load(std::memory_order_relaxed);
+}
+
+WorkQueue::Stats WorkQueue::GetStats() const
+{
+    Stats Result;
+    Result.Depth = Depth();
+    Result.Pushed = m_Pushed.load(std::memory_order_relaxed);
+    Result.Processed = m_Processed;
+    Result.Deferred = m_Deferred;
+    Result.AverageLatency = m_Processed > 0 ? m_TotalLatency / (int64_t)m_Processed : 0;
+    Result.MaxLatency = m_MaxLatency;
+    return Result;
+}
+
+void WorkQueue::Push(Node* Item)
+{
+    Item->Next.store(nullptr, std::memory_order_relaxed);
+    Node* Previous = m_Head.exchange(Item, std::memory_order_acq_rel);
+    Previous->Next.store(Item, std::memory_order_release);
+}
+
+// Consumer side of an intrusive MPSC queue. The stub node keeps the list non-empty so
+// producers only ever touch the head. A null result while the depth is non-zero means a
+// producer has swapped the head but not linked its node yet, which is picked up by the
+// next call.
+WorkQueue::Node* WorkQueue::Pop()
+{
+    Node* Tail = m_Tail;
+    Node* Next = Tail->Next.load(std::memory_order_acquire);
+
+    if (Tail == &m_Stub)
+    {
+        if (Next == nullptr)
+        {
+            return nullptr;
+        }
+
+        m_Tail = Next;
+        Tail = Next;
+        Next = Next->Next.load(std::memory_order_acquire);
+    }
+
+    if (Next != nullptr)
+    {
+        m_Tail = Next;
+        return Tail;
+    }
+
+    if (Tail != m_Head.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    Push(&m_Stub);
+    Next = Tail->Next.load(std::memory_order_acquire);
+    if (Next != nullptr)
+    {
+        m_Tail = Next;
+        return Tail;
+    }
+
+    return nullptr;
+}
+
+}
@@ -0,0 +1,103 @@
+/**
+
+MIT License
+
+Copyright (c) 2022-2024 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "CallbackDefs.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace OctaneGUI
+{
+
+/// @brief A lock-free queue of callbacks that any thread may push to and a single
+/// thread drains.
+///
+/// Pushing only swaps the head of an intrusive list, so producers never wait on each
+/// other or on the consumer. Drain is bounded by a time budget so that a flood of
+/// callbacks is spread across several calls.
+class WorkQueue
+{
+public:
+    struct Stats
+    {
+    public:
+        size_t Depth { 0 };
+        uint64_t Pushed { 0 };
+        uint64_t Processed { 0 };
+        // Number of drains that stopped because the budget ran out.
+        uint64_t Deferred { 0 };
+        // Time in microseconds between a callback being pushed and being invoked.
+        int64_t AverageLatency { 0 };
+        int64_t MaxLatency { 0 };
+    };
+
+    WorkQueue();
+    WorkQueue(const WorkQueue&) = delete;
+    ~WorkQueue();
+
+    WorkQueue& operator=(const WorkQueue&) = delete;
+
+    /// @brief Adds a callback to the queue. This is safe to call from any thread.
+    void Push(OnEmptySignature&& Fn);
+
+    /// @brief Invokes queued callbacks in the order they were pushed until the queue is
+    /// empty or the budget is spent. At least one callback is always invoked. This must
+    /// only be called from a single thread.
+    /// @param Budget Time allowed for this call. Zero or less drains the whole queue.
+    /// @return The number of callbacks invoked.
+    size_t Drain(std::chrono::microseconds Budget);
+
+    size_t Depth() const;
+    Stats GetStats() const;
+
+private:
+    struct Node
+    {
+    public:
+        std::atomic<Node*> Next { nullptr };
+        OnEmptySignature Fn { nullptr };
+        std::chrono::steady_clock::time_point Pushed {};
+    };
+
+    void Push(Node* Item);
+    Node* Pop();
+
+    std::atomic<Node*> m_Head { nullptr };
+    Node* m_Tail { nullptr };
+    Node m_Stub {};
+
+    std::atomic<size_t> m_Depth { 0 };
+    std::atomic<uint64_t> m_Pushed { 0 };
+    uint64_t m_Processed { 0 };
+    uint64_t m_Deferred { 0 };
+    int64_t m_TotalLatency { 0 };
+    int64_t m_MaxLatency { 0 };
+};
+
+}